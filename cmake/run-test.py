@@ -30,6 +30,7 @@ Run a SystemC regression test, including "golden log" file comparison,
 logic adopted from tests/scripts/verify.pl
 """
 
+import gzip
 import logging
 import re
 import subprocess
@@ -148,7 +149,9 @@ def strip_trace(trace_file: Path) -> Path:
     stripped_file = Path(f"{trace_file}.stripped")
     logger.debug("stripping trace file '%s' to '%s'", trace_file, stripped_file)
 
-    with trace_file.open() as trace_fd:
+    # compressed trace files are compared after decompression
+    opener = gzip.open if trace_file.suffix == ".gz" else open
+    with opener(trace_file, "rt") as trace_fd:
         # skip the first seven lines, which include SystemC version and date information
         for _ in range(7):
             trace_fd.readline()
@@ -191,7 +194,11 @@ def compare_logfile() -> None:
         ext = trace_test.group(1)
         ext = "awif" if ext == "wif" else ext
         output_file = Path(f"{TEST_LEAFNAME}.{ext}")
-        stripped_file = strip_trace(output_file)
+        compressed_file = Path(f"{output_file}.gz")
+        if not output_file.exists() and compressed_file.exists():
+            stripped_file = strip_trace(compressed_file)
+        else:
+            stripped_file = strip_trace(output_file)
     else:
         output_file = Path(TEST_LOGFILE)
         stripped_file = strip_log(output_file)
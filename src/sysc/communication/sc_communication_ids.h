@@ -107,6 +107,8 @@ SC_DEFINE_MESSAGE( SC_ID_ATTEMPT_TO_BIND_CLOCK_TO_OUTPUT_,  128,
     "attempted to bind sc_clock instance to sc_inout or sc_out" )
 SC_DEFINE_MESSAGE( SC_ID_INSERT_STUB_,  129,
     "insert sc_stub failed" )
+SC_DEFINE_MESSAGE( SC_ID_CONCURRENT_UPDATE_REQUEST_,  130,
+    "update requested by methods evaluated concurrently" )
 
 /* 
 $Log: sc_communication_ids.h,v $
@@ -101,6 +101,9 @@ private:
     sc_export_base(const this_type&);
     this_type& operator = (const this_type& );
 
+private:
+
+    int m_registry_index; // index in the export registry.
 };
 
 //=============================================================================
@@ -242,7 +242,8 @@ sc_port_base::sc_port_base(
     int max_size_, sc_port_policy policy 
 ) : 
     sc_object( sc_gen_unique_name( "port" ) ),
-    m_bind_info(NULL)
+    m_bind_info(NULL),
+    m_registry_index(-1)
 {
     simcontext()->get_port_registry()->insert( this );
     m_bind_info = new sc_bind_info( max_size_, policy );
@@ -252,7 +253,8 @@ sc_port_base::sc_port_base(
     const char* name_, int max_size_, sc_port_policy policy 
 ) : 
     sc_object( name_ ),
-    m_bind_info(NULL)
+    m_bind_info(NULL),
+    m_registry_index(-1)
 {
     simcontext()->get_port_registry()->insert( this );
     m_bind_info = new sc_bind_info( max_size_, policy );
@@ -632,11 +634,10 @@ sc_port_registry::insert( sc_port_base* port_ )
 
 #if defined(DEBUG_SYSTEMC)
     // check if port_ is already inserted
-    for( int i = size() - 1; i >= 0; -- i ) {
-        if( port_ == m_port_vec[i] ) {
-            port_->report_error( SC_ID_INSERT_PORT_, "port already inserted" );
-            return;
-        }
+    int i = port_->m_registry_index;
+    if( i >= 0 && i < size() && port_ == m_port_vec[i] ) {
+        port_->report_error( SC_ID_INSERT_PORT_, "port already inserted" );
+        return;
     }
 #endif
 
@@ -649,26 +650,24 @@ sc_port_registry::insert( sc_port_base* port_ )
     curr_module->append_port( port_ );
 
     // insert
+    port_->m_registry_index = size();
     m_port_vec.push_back( port_ );
 }
 
 void
 sc_port_registry::remove( sc_port_base* port_ )
 {
-    int i;
-    for( i = size() - 1; i >= 0; -- i ) {
-	if( port_ == m_port_vec[i] ) {
-	    break;
-	}
-    }
-    if( i == -1 ) {
+    int i = port_->m_registry_index;
+    if( i < 0 || i >= size() || port_ != m_port_vec[i] ) {
         port_->report_error( SC_ID_REMOVE_PORT_, "port not registered" );
         return;
     }
 
     // remove
     m_port_vec[i] = m_port_vec.back();
+    m_port_vec[i]->m_registry_index = i;
     m_port_vec.pop_back();
+    port_->m_registry_index = -1;
 }
 
 
@@ -183,6 +183,10 @@ protected:
 
     sc_bind_info* m_bind_info;
 
+private:
+
+    int           m_registry_index; // index in the port registry.
+
 private:
 
     // disabled
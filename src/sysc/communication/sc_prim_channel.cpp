@@ -32,13 +32,19 @@
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/kernel/sc_module.h"
 #include "sysc/kernel/sc_object_int.h"
-#include "sysc/communication/sc_host_mutex.h"
 #include "sysc/communication/sc_host_semaphore.h"
 
 #include <algorithm> // std::find
 
 namespace sc_core {
 
+// update request buffer of the current host thread, see
+// sc_prim_channel_registry::set_update_buffer; it is only set while the
+// thread evaluates a chunk of concurrent methods, and 0 otherwise (it is
+// not used outside of a concurrent evaluation, see defer_update)
+static thread_local sc_prim_channel_registry::update_buffer*
+  sc_deferred_update_buffer_p = 0;
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_prim_channel
 //
@@ -50,7 +56,11 @@ namespace sc_core {
 sc_prim_channel::sc_prim_channel()
 : sc_object( 0 ),
   m_registry( simcontext()->get_prim_channel_registry() ),
-  m_update_next_p( 0 ) 
+  m_update_next_p( 0 ),
+  m_async_entry(),
+  m_async_requested( false ),
+  m_deferred_buffer_p( 0 ),
+  m_registry_index( -1 )
 {
     m_registry->insert( *this );
 }
@@ -58,7 +68,11 @@ sc_prim_channel::sc_prim_channel()
 sc_prim_channel::sc_prim_channel( const char* name_ )
 : sc_object( name_ ),
   m_registry( simcontext()->get_prim_channel_registry() ),
-  m_update_next_p( 0 )
+  m_update_next_p( 0 ),
+  m_async_entry(),
+  m_async_requested( false ),
+  m_deferred_buffer_p( 0 ),
+  m_registry_index( -1 )
 {
     m_registry->insert( *this );
 }
@@ -79,6 +93,41 @@ sc_prim_channel::update()
 {}
 
 
+// receives a payload of an external update (deletes it by default)
+
+void
+sc_prim_channel::async_update( sc_async_payload* payload )
+{
+    delete payload;
+}
+
+
+// records an update request in the buffer of the calling host thread,
+// the channel is claimed for the buffer until it is committed or discarded,
+// so that a channel written by methods on different host threads is
+// detected whatever the order of their requests (m_update_next_p is not
+// written while updates are deferred)
+
+void
+sc_prim_channel::defer_update()
+{
+    const sc_prim_channel_registry::update_buffer* buffer_p =
+        sc_deferred_update_buffer_p;
+    if( buffer_p == 0 ) {
+        SC_REPORT_ERROR( SC_ID_CONCURRENT_UPDATE_REQUEST_,
+                         "request_update() from outside the evaluated methods" );
+        return;
+    }
+
+    const void* owner_p = 0;
+    if( m_deferred_buffer_p.compare_exchange_strong( owner_p, buffer_p ) ) {
+        sc_deferred_update_buffer_p->push_back( this );
+    } else if( owner_p != buffer_p ) {
+        SC_REPORT_ERROR( SC_ID_CONCURRENT_UPDATE_REQUEST_, name() );
+    }
+}
+
+
 // called by construction_done (does nothing by default)
 
 void sc_prim_channel::before_end_of_elaboration() 
@@ -139,10 +188,23 @@ sc_prim_channel::simulation_done()
     end_of_simulation();
 }
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_async_payload
+//
+//  Base class of data passed with external update requests.
+// ----------------------------------------------------------------------------
+
+sc_async_payload::~sc_async_payload()
+{}
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_prim_channel_registry::async_update_list
 //
-//  Thread-safe list of pending external updates
+//  Lock-free multi-producer, single-consumer queue of pending external
+//  updates.  Producers push entries onto an intrusive stack; the kernel
+//  takes the whole stack at once and reverses it into request order.
+//  The suspend semaphore is posted only by the request that finds the
+//  queue empty, i.e. once per batch instead of once per request.
 //  FOR INTERNAL USE ONLY!
 // ----------------------------------------------------------------------------
 
@@ -150,10 +212,9 @@ class sc_prim_channel_registry::async_update_list
 {
 public:
 
-    bool pending()
+    bool pending() const
     {
-        sc_scoped_lock lock( m_mutex );
-	return m_push_queue.size() != 0;
+        return m_head.load( std::memory_order_acquire ) != 0;
     }
 
     void suspend()
@@ -164,34 +225,56 @@ public:
         }
     }
 
-    void append( sc_prim_channel& prim_channel_ )
+    void append( sc_prim_channel& prim_channel_, sc_async_payload* entry_ )
     {
-        sc_scoped_lock lock( m_mutex );
-        m_push_queue.push_back( &prim_channel_ );
-        m_suspend_semaphore.post();
-        // return releases the mutex
+        entry_->m_async_channel_p = &prim_channel_;
+        sc_async_payload* head = m_head.load( std::memory_order_relaxed );
+        do {
+            entry_->m_async_next_p = head;
+        } while( ! m_head.compare_exchange_weak( head, entry_,
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed ) );
+        if( ! head )
+            m_suspend_semaphore.post(); // first entry of a new batch
     }
 
     void accept_updates()
     {
-	sc_assert( ! m_pop_queue.size() );
-	{
-	    sc_scoped_lock lock( m_mutex );
-	    m_push_queue.swap( m_pop_queue );
-	    // leaving the block releases the mutex
-	}
-
-	std::vector< sc_prim_channel* >::const_iterator
-	    it = m_pop_queue.begin(), end = m_pop_queue.end();
-	while( it!= end )
-	{
-	    // we use request_update instead of perform_update
-	    // to skip duplicates
-	    (*it++)->request_update();
-	    int sem_trywait = m_suspend_semaphore.trywait(); // this must never block !
-	    sc_assert( sem_trywait == 0 );
-	}
-	m_pop_queue.clear();
+        sc_async_payload* entry = m_head.exchange( 0, std::memory_order_acquire );
+        if( ! entry )
+            return;
+
+        // take the token of this batch, the producer that started it may
+        // not have posted it yet, so wait for it instead of trywait
+        m_suspend_semaphore.wait();
+
+        sc_async_payload* fifo = 0;
+        while( entry ) {
+            sc_async_payload* next = entry->m_async_next_p;
+            entry->m_async_next_p = fifo;
+            fifo = entry;
+            entry = next;
+        }
+
+        while( fifo ) {
+            entry = fifo;
+            fifo = entry->m_async_next_p;
+            sc_prim_channel* prim_channel = entry->m_async_channel_p;
+            entry->m_async_next_p = 0;
+            entry->m_async_channel_p = 0;
+
+            // we use request_update instead of perform_update
+            // to skip duplicates
+            if( entry == &prim_channel->m_async_entry ) {
+                // re-arm before the update runs, so that a request racing
+                // with it is queued again rather than lost
+                prim_channel->m_async_requested.exchange(
+                  false, std::memory_order_acq_rel );
+            } else {
+                prim_channel->async_update( entry );
+            }
+            prim_channel->request_update();
+        }
     }
 
     void attach_suspending( sc_prim_channel& p )
@@ -202,7 +285,6 @@ public:
             m_suspending_channels.push_back(&p);
             m_has_suspending_channels = true;
         }
-        // return releases the mutex
     }
 
     void detach_suspending( sc_prim_channel& p )
@@ -214,16 +296,13 @@ public:
             m_suspending_channels.pop_back();
             m_has_suspending_channels = (m_suspending_channels.size() > 0);
         }
-        // return releases the mutex
     }
 
-    async_update_list() : m_has_suspending_channels() {}
+    async_update_list() : m_head( 0 ), m_has_suspending_channels() {}
 
 private:
-    sc_host_mutex                   m_mutex;
+    std::atomic<sc_async_payload*>  m_head;
     sc_host_semaphore               m_suspend_semaphore;
-    std::vector< sc_prim_channel* > m_push_queue;
-    std::vector< sc_prim_channel* > m_pop_queue;
     std::vector< sc_prim_channel* > m_suspending_channels;
     bool                            m_has_suspending_channels;
 
@@ -251,15 +330,15 @@ sc_prim_channel_registry::insert( sc_prim_channel& prim_channel_ )
 
 #ifdef DEBUG_SYSTEMC
     // check if prim_channel_ is already inserted
-    for( int i = 0; i < size(); ++ i ) {
-        if( &prim_channel_ == m_prim_channel_vec[i] ) {
-            SC_REPORT_ERROR( SC_ID_INSERT_PRIM_CHANNEL_, "already inserted" );
-            return;
-        }
+    int i = prim_channel_.m_registry_index;
+    if( i >= 0 && i < size() && &prim_channel_ == m_prim_channel_vec[i] ) {
+        SC_REPORT_ERROR( SC_ID_INSERT_PRIM_CHANNEL_, "already inserted" );
+        return;
     }
 #endif
 
     // insert
+    prim_channel_.m_registry_index = size();
     m_prim_channel_vec.push_back( &prim_channel_ );
 
 }
@@ -267,20 +346,17 @@ sc_prim_channel_registry::insert( sc_prim_channel& prim_channel_ )
 void
 sc_prim_channel_registry::remove( sc_prim_channel& prim_channel_ )
 {
-    int i;
-    for( i = 0; i < size(); ++ i ) {
-	if( &prim_channel_ == m_prim_channel_vec[i] ) {
-	    break;
-	}
-    }
-    if( i == size() ) {
+    int i = prim_channel_.m_registry_index;
+    if( i < 0 || i >= size() || &prim_channel_ != m_prim_channel_vec[i] ) {
         SC_REPORT_ERROR( SC_ID_REMOVE_PRIM_CHANNEL_, 0 );
         return;
     }
 
     // remove
     m_prim_channel_vec[i] = m_prim_channel_vec.back();
+    m_prim_channel_vec[i]->m_registry_index = i;
     m_prim_channel_vec.pop_back();
+    prim_channel_.m_registry_index = -1;
 
     m_async_update_list_p->detach_suspending(prim_channel_);
 }
@@ -301,7 +377,19 @@ sc_prim_channel_registry::async_suspend()
 void
 sc_prim_channel_registry::async_request_update( sc_prim_channel& prim_channel_ )
 {
-    m_async_update_list_p->append( prim_channel_ );
+    // requests are coalesced until the kernel has accepted the queued one
+    if( ! prim_channel_.m_async_requested.exchange( true,
+                                                    std::memory_order_acq_rel ) )
+        m_async_update_list_p->append( prim_channel_,
+                                       &prim_channel_.m_async_entry );
+}
+
+void
+sc_prim_channel_registry::async_request_update( sc_prim_channel& prim_channel_,
+                                                sc_async_payload* payload_ )
+{
+    sc_assert( payload_ != 0 );
+    m_async_update_list_p->append( prim_channel_, payload_ );
 }
 
 void
@@ -316,6 +404,61 @@ sc_prim_channel_registry::async_detach_suspending(sc_prim_channel& p)
     m_async_update_list_p->detach_suspending( p );
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_prim_channel_registry::set_update_buffer"
+// |
+// | This method installs the buffer that receives the update requests of the
+// | calling host thread while updates are deferred. Passing NULL removes the
+// | current buffer.
+// +----------------------------------------------------------------------------
+void
+sc_prim_channel_registry::set_update_buffer( update_buffer* buffer_p )
+{
+    sc_deferred_update_buffer_p = buffer_p;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_prim_channel_registry::commit_updates"
+// |
+// | This method moves deferred update requests to the update list. The list
+// | is built exactly as if the requests had been made by request_update()
+// | in buffer order. Each channel has been claimed by this buffer, see
+// | sc_prim_channel::defer_update.
+// +----------------------------------------------------------------------------
+void
+sc_prim_channel_registry::commit_updates( const update_buffer& buffer )
+{
+    update_buffer::const_iterator it = buffer.begin();
+    for( ; it != buffer.end(); ++it )
+    {
+        const void* owner_p = &buffer;
+        if( !(*it)->m_deferred_buffer_p.compare_exchange_strong( owner_p, 0 )
+            || (*it)->m_update_next_p != 0 ) {
+            SC_REPORT_ERROR( SC_ID_INTERNAL_ERROR_,
+                             "deferred update request not owned by its buffer" );
+            continue;
+        }
+        (*it)->m_update_next_p = m_update_list_p;
+        m_update_list_p = *it;
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_prim_channel_registry::discard_updates"
+// |
+// | This method drops deferred update requests, e.g. of methods evaluated
+// | after a failing one, and releases the claims on their channels.
+// +----------------------------------------------------------------------------
+void
+sc_prim_channel_registry::discard_updates( const update_buffer& buffer )
+{
+    update_buffer::const_iterator it = buffer.begin();
+    for( ; it != buffer.end(); ++it )
+    {
+        (*it)->m_deferred_buffer_p.store( 0 );
+    }
+}
+
 // +----------------------------------------------------------------------------
 // |"sc_prim_channel_registry::perform_update"
 // |
@@ -369,6 +512,7 @@ sc_prim_channel_registry::sc_prim_channel_registry( sc_simcontext& simc_ )
   ,  m_simc( &simc_ )
   ,  m_update_list_end((sc_prim_channel*)(void*)this)
   ,  m_update_list_p((sc_prim_channel*)this)
+  ,  m_defer_updates(false)
 {
     m_async_update_list_p = new async_update_list();
 }
@@ -33,8 +33,39 @@
 #include "sysc/kernel/sc_wait.h"
 #include "sysc/kernel/sc_wait_cthread.h"
 
+#include <atomic>
+
 namespace sc_core {
 
+class sc_prim_channel;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_async_payload
+//
+//  Base class of data passed from a process external to the simulator to a
+//  primitive channel with sc_prim_channel::async_request_update( payload ).
+//  The payload carries its own link in the kernel's queue of external
+//  updates, so posting it neither allocates nor locks.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_async_payload
+{
+    friend class sc_prim_channel_registry;
+
+public:
+    sc_async_payload()
+      : m_async_next_p(), m_async_channel_p() {}
+    sc_async_payload( const sc_async_payload& )
+      : m_async_next_p(), m_async_channel_p() {}
+    sc_async_payload& operator = ( const sc_async_payload& )
+      { return *this; }
+    virtual ~sc_async_payload();
+
+private:
+    sc_async_payload* m_async_next_p;    // Next entry in async update queue.
+    sc_prim_channel*  m_async_channel_p; // Channel receiving this payload.
+};
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_prim_channel
 //
@@ -52,7 +83,7 @@ public:
         { return "sc_prim_channel"; }
 
     inline bool update_requested() 
-	{ return m_update_next_p != NULL; }
+	{ return m_update_next_p != NULL || m_deferred_buffer_p.load() != NULL; }
 
     // request the update method to be executed during the update phase
     inline void request_update();
@@ -61,6 +92,10 @@ public:
     // from a process external to the simulator.
     void async_request_update();
 
+    // as above, handing the payload to async_update() before the update
+    // phase; payloads are delivered in the order they were posted
+    void async_request_update( sc_async_payload* payload );
+
 protected:
 
     // constructors
@@ -73,6 +108,10 @@ protected:
     // the update method (does nothing by default)
     virtual void update();
 
+    // receives a payload posted by async_request_update( payload ); the
+    // channel takes ownership of it (deletes the payload by default)
+    virtual void async_update( sc_async_payload* payload );
+
     // called by construction_done (does nothing by default)
     virtual void before_end_of_elaboration();
 
@@ -196,6 +235,9 @@ private:
     // called during the update phase of a delta cycle (if requested)
     void perform_update();
 
+    // records an update request while the registry defers updates
+    void defer_update();
+
     // called when construction is done
     void construction_done();
 
@@ -216,6 +258,10 @@ private:
 
     sc_prim_channel_registry* m_registry;          // Update list manager.
     sc_prim_channel*          m_update_next_p;     // Next entry in update list.
+    sc_async_payload          m_async_entry;       // Entry in async update queue.
+    std::atomic<bool>         m_async_requested;   // Async update is queued.
+    std::atomic<const void*>  m_deferred_buffer_p; // Buffer of deferred request.
+    int                       m_registry_index;    // Index in the registry.
 };
 
 
@@ -228,6 +274,7 @@ private:
 
 class sc_prim_channel_registry
 {
+    friend class sc_prim_channel;
     friend class sc_simcontext;
 
 public:
@@ -241,6 +288,20 @@ public:
 
     inline void request_update( sc_prim_channel& );
     void async_request_update( sc_prim_channel& );
+    void async_request_update( sc_prim_channel&, sc_async_payload* );
+
+    // deferral of update requests from concurrently evaluated processes
+    //  - while deferred, each host thread records its requests in the
+    //    buffer installed by set_update_buffer()
+    //  - commit_updates() appends a buffer to the update list in the
+    //    order the requests have been made, discard_updates() drops it
+    typedef std::vector<sc_prim_channel*> update_buffer;
+
+    void defer_updates( bool defer )
+        { m_defer_updates = defer; }
+    static void set_update_buffer( update_buffer* );
+    void commit_updates( const update_buffer& );
+    void discard_updates( const update_buffer& );
 
     bool pending_updates() const
     { 
@@ -300,6 +361,7 @@ private:
     sc_simcontext*                m_simc;                // simulator context.
     sc_prim_channel*              m_update_list_end;     // update list terminator.
     sc_prim_channel*              m_update_list_p;       // internal updates.
+    bool                          m_defer_updates;       // see defer_updates.
 };
 
 
@@ -316,6 +378,10 @@ inline
 void
 sc_prim_channel_registry::request_update( sc_prim_channel& prim_channel_ )
 {
+    if( SC_UNLIKELY_(m_defer_updates) ) {
+        prim_channel_.defer_update();
+        return;
+    }
     prim_channel_.m_update_next_p = m_update_list_p;
     m_update_list_p = &prim_channel_;
 }
@@ -347,6 +413,13 @@ sc_prim_channel::async_request_update()
     m_registry->async_request_update(*this);
 }
 
+inline
+void
+sc_prim_channel::async_request_update( sc_async_payload* payload )
+{
+    m_registry->async_request_update(*this, payload);
+}
+
 inline
 void
 sc_prim_channel::async_attach_suspending()
@@ -96,6 +96,7 @@ sc_writer_policy_check_port::
 sc_signal_channel::~sc_signal_channel()
 {
     delete m_change_event_p;
+    delete m_trace_changes_p;
 }
 
 void
@@ -161,6 +162,35 @@ sc_signal_channel::do_update()
 {
     notify_next_delta( m_change_event_p );
     m_change_stamp = simcontext()->change_stamp();
+
+    if( SC_UNLIKELY_( m_trace_changes_p != 0 ) ) {
+        for( std::size_t i = 0; i < m_trace_changes_p->size(); ++i ) {
+            (*m_trace_changes_p)[i].first->mark( (*m_trace_changes_p)[i].second );
+        }
+    }
+}
+
+// register the trace just added as `name' for change-driven tracing
+
+void
+sc_trace_changes_of( sc_trace_file* tf,
+                     const sc_interface& object,
+                     const std::string& name )
+{
+    const sc_signal_channel* channel_p =
+      dynamic_cast<const sc_signal_channel*>( &object );
+    if( tf == 0 || channel_p == 0 )
+        return;
+
+    int index = 0;
+    sc_trace_changes_ptr changes = tf->trace_changes( name, index );
+    if( !changes )
+        return;
+
+    if( channel_p->m_trace_changes_p == 0 ) {
+        channel_p->m_trace_changes_p = new sc_signal_channel::trace_changes_vec;
+    }
+    channel_p->m_trace_changes_p->push_back( std::make_pair( changes, index ) );
 }
 
 // IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
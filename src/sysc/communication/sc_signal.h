@@ -89,6 +89,7 @@ protected:
       : sc_prim_channel( name_ )
       , m_change_event_p( 0 )
       , m_change_stamp( ~sc_dt::UINT64_ONE )
+      , m_trace_changes_p( 0 )
     {}
 
 public:
@@ -128,6 +129,17 @@ protected:
     mutable sc_event* m_change_event_p;  // value change event if present.
     sc_dt::uint64     m_change_stamp;    // delta of last event
 
+private:
+    friend SC_API void sc_trace_changes_of( sc_trace_file*,
+                                            const sc_interface&,
+                                            const std::string& );
+
+    typedef std::vector< std::pair<sc_trace_changes_ptr, int> >
+            trace_changes_vec;
+
+    // traces to mark on value changes (change-driven tracing)
+    mutable trace_changes_vec* m_trace_changes_p;
+
 private:
     // disabled
     sc_signal_channel( const sc_signal_channel& ) /* = delete */;
@@ -73,11 +73,22 @@ sc_logic_resolve( sc_dt::sc_logic& result_,
 	return;
     }
 
-    sc_dt::sc_logic_value_t res = values_[0].value();
-    for( int i = sz - 1; i > 0 && res != sc_dt::Log_X; -- i ) {
-       res = sc_logic_resolution_tbl[res][values_[i].value()];
+    // same algebra as sc_lv_resolve<W>, on the data (bit 0) and control
+    // (bit 1) bits of the values
+
+    unsigned any_0 = 0;
+    unsigned any_1 = 0;
+    unsigned any_x = 0;
+    for( int i = sz - 1; i >= 0 && ! any_x; -- i ) {
+	unsigned data = values_[i].value() & 1;
+	unsigned ctrl = values_[i].value() >> 1;
+	any_0 |= ~( data | ctrl ) & 1;
+	any_1 |= data & ~ctrl;
+	any_x |= data & ctrl;
     }
-    result_ = res;
+    any_x |= any_0 & any_1;
+    result_ = sc_dt::sc_logic_value_t( ( any_x | any_1 ) |
+                                       ( ( any_x | ! ( any_0 | any_1 ) ) << 1 ) );
 }
 
 
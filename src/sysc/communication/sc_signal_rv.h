@@ -74,13 +74,27 @@ sc_lv_resolve<W>::resolve( sc_dt::sc_lv<W>& result_,
 	return;
     }
 
-    for( int j = result_.length() - 1; j >= 0; -- j ) {
-	sc_dt::sc_logic_value_t res = (*values_[0])[j].value();
-	for( int i = sz - 1; i > 0 && res != 3; -- i ) {
-	    res = sc_logic_resolution_tbl[res][(*values_[i])[j].value()];
+    // resolve a word of bits at a time, using the data and control planes
+    // of the values (0 = 00, 1 = 01, Z = 10, X = 11): a bit is X if any
+    // value is X or the values contain both 0 and 1, and Z if all values
+    // are Z.
+
+    for( int wi = result_.size() - 1; wi >= 0; -- wi ) {
+	sc_dt::sc_digit any_0 = 0;
+	sc_dt::sc_digit any_1 = 0;
+	sc_dt::sc_digit any_x = 0;
+	for( int i = sz - 1; i >= 0; -- i ) {
+	    sc_dt::sc_digit data = values_[i]->get_word( wi );
+	    sc_dt::sc_digit ctrl = values_[i]->get_cword( wi );
+	    any_0 |= ~( data | ctrl );
+	    any_1 |= data & ~ctrl;
+	    any_x |= data & ctrl;
 	}
-	result_[j] = res;
+	any_x |= any_0 & any_1;
+	result_.set_word( wi, any_x | any_1 );
+	result_.set_cword( wi, any_x | ~( any_0 | any_1 ) );
     }
+    result_.clean_tail();
 }
 
 
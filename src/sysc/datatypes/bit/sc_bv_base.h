@@ -78,6 +78,7 @@ class SC_API sc_bv_base
     : public sc_proxy<sc_bv_base>
 {
     friend class sc_lv_base;
+    friend struct sc_proxy_words<sc_bv_base>;
 
 
     void init( int length_, bool init_value = false );
@@ -272,6 +273,14 @@ sc_bv_base::clean_tail()
 	if ( bi != 0 ) m_data[wi] &= ~SC_DIGIT_ZERO >> (SC_DIGIT_SIZE - bi);
 }
 
+
+inline
+sc_digit*
+sc_proxy_words<sc_bv_base>::data( const sc_bv_base& x )
+{
+    return x.m_data;
+}
+
 } // namespace sc_dt
 
 
@@ -88,6 +88,7 @@ class SC_API sc_lv_base
     : public sc_proxy<sc_lv_base>
 {
     friend class sc_bv_base;
+    friend struct sc_proxy_words<sc_lv_base>;
 
 
     void init( int length_, const sc_logic& init_value = SC_LOGIC_X );
@@ -311,6 +312,21 @@ sc_lv_base::clean_tail()
 }
 
 
+inline
+sc_digit*
+sc_proxy_words<sc_lv_base>::data( const sc_lv_base& x )
+{
+    return x.m_data;
+}
+
+inline
+sc_digit*
+sc_proxy_words<sc_lv_base>::ctrl( const sc_lv_base& x )
+{
+    return x.m_ctrl;
+}
+
+
 // ----------------------------------------------------------------------------
 //  CLASS TEMPLATE : sc_proxy
 //
@@ -340,8 +356,15 @@ X&
 operator &= ( sc_proxy<X>& px, const sc_proxy<Y>& py )
 {
     X& x = px.back_cast();
+    const Y& y = py.back_cast();
+    // in place only if both are plain vectors: a word can then only alias
+    // the word at the same position of the other operand
+    if( sc_proxy_is_vector<X>::value && sc_proxy_is_vector<Y>::value &&
+        x.length() == y.length() ) {
+	return b_and_assign_( x, y );
+    }
     sc_lv_base a( x.length() );
-    a = py.back_cast();
+    a = y;
     return b_and_assign_( x, a );
 }
 
@@ -474,8 +497,15 @@ X&
 operator |= ( sc_proxy<X>& px, const sc_proxy<Y>& py )
 {
     X& x = px.back_cast();
+    const Y& y = py.back_cast();
+    // in place only if both are plain vectors: a word can then only alias
+    // the word at the same position of the other operand
+    if( sc_proxy_is_vector<X>::value && sc_proxy_is_vector<Y>::value &&
+        x.length() == y.length() ) {
+	return b_or_assign_( x, y );
+    }
     sc_lv_base a( x.length() );
-    a = py.back_cast();
+    a = y;
     return b_or_assign_( x, a );
 }
 
@@ -613,8 +643,15 @@ X&
 operator ^= ( sc_proxy<X>& px, const sc_proxy<Y>& py )
 {
     X& x = px.back_cast();
+    const Y& y = py.back_cast();
+    // in place only if both are plain vectors: a word can then only alias
+    // the word at the same position of the other operand
+    if( sc_proxy_is_vector<X>::value && sc_proxy_is_vector<Y>::value &&
+        x.length() == y.length() ) {
+	return b_xor_assign_( x, y );
+    }
     sc_lv_base a( x.length() );
-    a = py.back_cast();
+    a = y;
     return b_xor_assign_( x, a );
 }
 
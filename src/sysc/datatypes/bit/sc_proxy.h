@@ -74,6 +74,15 @@
 #include "sysc/datatypes/bit/sc_logic.h"
 #include "sysc/kernel/sc_macros.h"
 
+// With 64-bit limbs on x86-64 (see sc_nbdefs.h and sc_vector_utils.h), the
+// reductions and bitwise assignments of plain vectors process four words at
+// a time with SSE2.
+
+#if defined(SC_LIMB64) && defined(__x86_64__)
+#   include <x86intrin.h>
+#   define SC_PROXY_SSE2
+#endif
+
 
 namespace sc_dt
 {
@@ -186,6 +195,57 @@ template<typename X, typename Y> struct sc_proxy_traits<sc_concref<X,Y> >
 {};
 
 
+// ----------------------------------------------------------------------------
+//  CLASS TEMPLATE : sc_proxy_is_vector
+//
+// Template traits helper to select the fast paths for operands that are
+// plain bit/logic vectors, whose words are stored in digit arrays, rather
+// than bit-selects, part-selects or concatenations.
+// ----------------------------------------------------------------------------
+
+template<typename X> struct sc_proxy_is_vector
+{
+    static const bool value = false;
+};
+
+template<> struct sc_proxy_is_vector<sc_bv_base>
+{
+    static const bool value = true;
+};
+
+template<> struct sc_proxy_is_vector<sc_lv_base>
+{
+    static const bool value = true;
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS TEMPLATE : sc_proxy_words
+//
+// Template traits helper giving the word-parallel paths access to the data
+// and control word arrays of plain vectors. Other proxies, and the control
+// words of bit vectors, have no arrays (0).
+// ----------------------------------------------------------------------------
+
+template<typename X> struct sc_proxy_words
+{
+    static sc_digit* data( const X& ) { return 0; }
+    static sc_digit* ctrl( const X& ) { return 0; }
+};
+
+template<> struct sc_proxy_words<sc_bv_base>
+{
+    static sc_digit* data( const sc_bv_base& x );
+    static sc_digit* ctrl( const sc_bv_base& ) { return 0; }
+};
+
+template<> struct sc_proxy_words<sc_lv_base>
+{
+    static sc_digit* data( const sc_lv_base& x );
+    static sc_digit* ctrl( const sc_lv_base& x );
+};
+
+
 // ----------------------------------------------------------------------------
 //  CLASS TEMPLATE : sc_proxy
 //
@@ -725,6 +785,173 @@ set_words_( X& x, int wi, sc_digit x_dw, sc_digit x_cw )
     x.set_cword( wi, x_cw );
 }
 
+#if defined(SC_PROXY_SSE2)
+
+// SSE2 kernels of the plain vector operations. They process the words from
+// i up to n four at a time, and advance i past the words done; the scalar
+// loops of the callers do the rest. Missing arrays (0) are read as zeros.
+
+inline
+__m128i
+sse2_load_( const sc_digit* p, int i )
+{
+    return p ? _mm_loadu_si128( reinterpret_cast<const __m128i*>( p + i ) )
+             : _mm_setzero_si128();
+}
+
+inline
+void
+sse2_store_( sc_digit* p, int i, __m128i v )
+{
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( p + i ), v );
+}
+
+inline
+bool
+sse2_any_( __m128i v )
+{
+    return _mm_movemask_epi8( _mm_cmpeq_epi32( v, _mm_setzero_si128() ) )
+           != 0xffff;
+}
+
+// returns true at the first 0, collects the Z and X bits in unknown
+inline
+bool
+sse2_and_reduce_( const sc_digit* dw, const sc_digit* cw, int& i, int n,
+                  sc_digit& unknown )
+{
+    __m128i ones = _mm_set1_epi32( -1 );
+    __m128i u = _mm_setzero_si128();
+    for( ; i + 4 <= n; i += 4 ) {
+	__m128i d = sse2_load_( dw, i );
+	__m128i c = sse2_load_( cw, i );
+	if( sse2_any_( _mm_andnot_si128( _mm_or_si128( d, c ), ones ) ) ) {
+	    return true;
+	}
+	u = _mm_or_si128( u, c );
+    }
+    if( sse2_any_( u ) ) {
+	unknown |= SC_DIGIT_ONE;
+    }
+    return false;
+}
+
+// returns true at the first 1, collects the Z and X bits in unknown
+inline
+bool
+sse2_or_reduce_( const sc_digit* dw, const sc_digit* cw, int& i, int n,
+                 sc_digit& unknown )
+{
+    __m128i u = _mm_setzero_si128();
+    for( ; i + 4 <= n; i += 4 ) {
+	__m128i d = sse2_load_( dw, i );
+	__m128i c = sse2_load_( cw, i );
+	if( sse2_any_( _mm_andnot_si128( c, d ) ) ) {
+	    return true;
+	}
+	u = _mm_or_si128( u, c );
+    }
+    if( sse2_any_( u ) ) {
+	unknown |= SC_DIGIT_ONE;
+    }
+    return false;
+}
+
+// returns true at the first Z or X, xors the data words into parity
+inline
+bool
+sse2_xor_reduce_( const sc_digit* dw, const sc_digit* cw, int& i, int n,
+                  sc_digit& parity )
+{
+    __m128i p = _mm_setzero_si128();
+    for( ; i + 4 <= n; i += 4 ) {
+	__m128i c = sse2_load_( cw, i );
+	if( sse2_any_( c ) ) {
+	    return true;
+	}
+	p = _mm_xor_si128( p, sse2_load_( dw, i ) );
+    }
+    p = _mm_xor_si128( p, _mm_shuffle_epi32( p, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+    p = _mm_xor_si128( p, _mm_shuffle_epi32( p, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    parity ^= static_cast<sc_digit>( _mm_cvtsi128_si32( p ) );
+    return false;
+}
+
+// the bitwise assignments compute the same words as b_and_assign_ etc.;
+// nothing is done unless both operands are plain vectors, or if Z and X
+// values would be assigned to a bit vector (warned about by set_cword)
+
+inline
+bool
+sse2_assignable_( const sc_digit* x_dp, const sc_digit* x_cp,
+                  const sc_digit* y_dp, const sc_digit* y_cp )
+{
+    return x_dp && y_dp && ( x_cp || !y_cp );
+}
+
+inline
+void
+sse2_and_assign_( sc_digit* x_dp, sc_digit* x_cp,
+                  const sc_digit* y_dp, const sc_digit* y_cp, int& i, int n )
+{
+    if( !sse2_assignable_( x_dp, x_cp, y_dp, y_cp ) ) {
+	return;
+    }
+    for( ; i + 4 <= n; i += 4 ) {
+	__m128i x_dw = sse2_load_( x_dp, i ), x_cw = sse2_load_( x_cp, i );
+	__m128i y_dw = sse2_load_( y_dp, i ), y_cw = sse2_load_( y_cp, i );
+	__m128i cw = _mm_or_si128( _mm_or_si128( _mm_and_si128( x_dw, y_cw ),
+	                                         _mm_and_si128( x_cw, y_dw ) ),
+	                           _mm_and_si128( x_cw, y_cw ) );
+	sse2_store_( x_dp, i, _mm_or_si128( cw, _mm_and_si128( x_dw, y_dw ) ) );
+	if( x_cp ) {
+	    sse2_store_( x_cp, i, cw );
+	}
+    }
+}
+
+inline
+void
+sse2_or_assign_( sc_digit* x_dp, sc_digit* x_cp,
+                 const sc_digit* y_dp, const sc_digit* y_cp, int& i, int n )
+{
+    if( !sse2_assignable_( x_dp, x_cp, y_dp, y_cp ) ) {
+	return;
+    }
+    for( ; i + 4 <= n; i += 4 ) {
+	__m128i x_dw = sse2_load_( x_dp, i ), x_cw = sse2_load_( x_cp, i );
+	__m128i y_dw = sse2_load_( y_dp, i ), y_cw = sse2_load_( y_cp, i );
+	__m128i cw = _mm_or_si128( _mm_or_si128( _mm_and_si128( x_cw, y_cw ),
+	                                         _mm_andnot_si128( y_dw, x_cw ) ),
+	                           _mm_andnot_si128( x_dw, y_cw ) );
+	sse2_store_( x_dp, i, _mm_or_si128( cw, _mm_or_si128( x_dw, y_dw ) ) );
+	if( x_cp ) {
+	    sse2_store_( x_cp, i, cw );
+	}
+    }
+}
+
+inline
+void
+sse2_xor_assign_( sc_digit* x_dp, sc_digit* x_cp,
+                  const sc_digit* y_dp, const sc_digit* y_cp, int& i, int n )
+{
+    if( !sse2_assignable_( x_dp, x_cp, y_dp, y_cp ) ) {
+	return;
+    }
+    for( ; i + 4 <= n; i += 4 ) {
+	__m128i x_dw = sse2_load_( x_dp, i ), x_cw = sse2_load_( x_cp, i );
+	__m128i y_dw = sse2_load_( y_dp, i ), y_cw = sse2_load_( y_cp, i );
+	__m128i cw = _mm_or_si128( x_cw, y_cw );
+	sse2_store_( x_dp, i, _mm_or_si128( cw, _mm_xor_si128( x_dw, y_dw ) ) );
+	if( x_cp ) {
+	    sse2_store_( x_cp, i, cw );
+	}
+    }
+}
+
+#endif // SC_PROXY_SSE2
+
 template <class X>
 inline
 void
@@ -1072,7 +1299,13 @@ b_and_assign_( sc_proxy<X>& px, const sc_proxy<Y>& py )
     const Y& y = py.back_cast();
     sc_assert( x.length() == y.length() );
     int sz = x.size();
-    for( int i = 0; i < sz; ++ i ) {
+    int i = 0;
+#if defined(SC_PROXY_SSE2)
+    sse2_and_assign_( sc_proxy_words<X>::data( x ), sc_proxy_words<X>::ctrl( x ),
+                      sc_proxy_words<Y>::data( y ), sc_proxy_words<Y>::ctrl( y ),
+                      i, sz );
+#endif
+    for( ; i < sz; ++ i ) {
 	sc_digit x_dw, x_cw, y_dw, y_cw;
 	get_words_( x, i, x_dw, x_cw );
 	get_words_( y, i, y_dw, y_cw );
@@ -1096,7 +1329,13 @@ b_or_assign_( sc_proxy<X>& px, const sc_proxy<Y>& py )
     const Y& y = py.back_cast();
     sc_assert( x.length() == y.length() );
     int sz = x.size();
-    for( int i = 0; i < sz; ++ i ) {
+    int i = 0;
+#if defined(SC_PROXY_SSE2)
+    sse2_or_assign_( sc_proxy_words<X>::data( x ), sc_proxy_words<X>::ctrl( x ),
+                     sc_proxy_words<Y>::data( y ), sc_proxy_words<Y>::ctrl( y ),
+                     i, sz );
+#endif
+    for( ; i < sz; ++ i ) {
 	sc_digit x_dw, x_cw, y_dw, y_cw;
 	get_words_( x, i, x_dw, x_cw );
 	get_words_( y, i, y_dw, y_cw );
@@ -1120,7 +1359,13 @@ b_xor_assign_( sc_proxy<X>& a, const sc_proxy<Y>& b )
     const Y& y = b.back_cast();
     sc_assert( x.length() == y.length() );
     int sz = x.size();
-    for( int i = 0; i < sz; ++ i ) {
+    int i = 0;
+#if defined(SC_PROXY_SSE2)
+    sse2_xor_assign_( sc_proxy_words<X>::data( x ), sc_proxy_words<X>::ctrl( x ),
+                      sc_proxy_words<Y>::data( y ), sc_proxy_words<Y>::ctrl( y ),
+                      i, sz );
+#endif
+    for( ; i < sz; ++ i ) {
 	sc_digit x_dw, x_cw, y_dw, y_cw;
 	get_words_( x, i, x_dw, x_cw );
 	get_words_( y, i, y_dw, y_cw );
@@ -1282,12 +1527,50 @@ reverse( const sc_proxy<X>& a );
 
 // reduce functions
 
+// Plain vectors are reduced a word at a time, returning as soon as a word
+// determines the result. The bits beyond the length are masked off.
+
+template <class X>
+inline
+sc_digit
+tail_mask_( const X& x, int wi )
+{
+    int bi = x.length() % SC_DIGIT_SIZE;
+    if( wi != x.size() - 1 || bi == 0 ) {
+	return ~SC_DIGIT_ZERO;
+    }
+    return ~SC_DIGIT_ZERO >> (SC_DIGIT_SIZE - bi);
+}
+
 template <class X>
 inline
 typename sc_proxy<X>::value_type
 sc_proxy<X>::and_reduce() const
 {
     const X& x = back_cast();
+    if( sc_proxy_is_vector<X>::value ) {
+	// any 0 gives 0, otherwise any Z or X gives X
+	sc_digit unknown = SC_DIGIT_ZERO;
+	int sz = x.size();
+	int i = 0;
+#if defined(SC_PROXY_SSE2)
+	// all but the last word, which is masked
+	if( sse2_and_reduce_( sc_proxy_words<X>::data( x ),
+	                      sc_proxy_words<X>::ctrl( x ), i, sz - 1, unknown ) ) {
+	    return value_type( Log_0 );
+	}
+#endif
+	for( ; i < sz; ++ i ) {
+	    sc_digit x_dw, x_cw;
+	    get_words_( x, i, x_dw, x_cw );
+	    sc_digit mask = tail_mask_( x, i );
+	    if( ~x_dw & ~x_cw & mask ) {
+		return value_type( Log_0 );
+	    }
+	    unknown |= x_cw & mask;
+	}
+	return value_type( unknown ? Log_X : Log_1 );
+    }
     value_type result = value_type( 1 );
     int len = x.length();
     for( int i = 0; i < len; ++ i ) {
@@ -1302,6 +1585,28 @@ typename sc_proxy<X>::value_type
 sc_proxy<X>::or_reduce() const
 {
     const X& x = back_cast();
+    if( sc_proxy_is_vector<X>::value ) {
+	// any 1 gives 1, otherwise any Z or X gives X
+	sc_digit unknown = SC_DIGIT_ZERO;
+	int sz = x.size();
+	int i = 0;
+#if defined(SC_PROXY_SSE2)
+	if( sse2_or_reduce_( sc_proxy_words<X>::data( x ),
+	                     sc_proxy_words<X>::ctrl( x ), i, sz - 1, unknown ) ) {
+	    return value_type( Log_1 );
+	}
+#endif
+	for( ; i < sz; ++ i ) {
+	    sc_digit x_dw, x_cw;
+	    get_words_( x, i, x_dw, x_cw );
+	    sc_digit mask = tail_mask_( x, i );
+	    if( x_dw & ~x_cw & mask ) {
+		return value_type( Log_1 );
+	    }
+	    unknown |= x_cw & mask;
+	}
+	return value_type( unknown ? Log_X : Log_0 );
+    }
     value_type result = value_type( 0 );
     int len = x.length();
     for( int i = 0; i < len; ++ i ) {
@@ -1316,6 +1621,31 @@ typename sc_proxy<X>::value_type
 sc_proxy<X>::xor_reduce() const
 {
     const X& x = back_cast();
+    if( sc_proxy_is_vector<X>::value ) {
+	// any Z or X gives X, otherwise the parity of the 1s
+	sc_digit parity = SC_DIGIT_ZERO;
+	int sz = x.size();
+	int i = 0;
+#if defined(SC_PROXY_SSE2)
+	if( sse2_xor_reduce_( sc_proxy_words<X>::data( x ),
+	                      sc_proxy_words<X>::ctrl( x ), i, sz - 1, parity ) ) {
+	    return value_type( Log_X );
+	}
+#endif
+	for( ; i < sz; ++ i ) {
+	    sc_digit x_dw, x_cw;
+	    get_words_( x, i, x_dw, x_cw );
+	    sc_digit mask = tail_mask_( x, i );
+	    if( x_cw & mask ) {
+		return value_type( Log_X );
+	    }
+	    parity ^= x_dw & mask;
+	}
+	for( int shift = SC_DIGIT_SIZE / 2; shift > 0; shift /= 2 ) {
+	    parity ^= parity >> shift;
+	}
+	return value_type( parity & SC_DIGIT_ONE ? Log_1 : Log_0 );
+    }
     value_type result = value_type( 0 );
     int len = x.length();
     for( int i = 0; i < len; ++ i ) {
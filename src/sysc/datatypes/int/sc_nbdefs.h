@@ -130,6 +130,24 @@ namespace sc_dt
 #error no SC_BASE_VEC_DIGITS specified!
 #endif
 
+// SC_ENABLE_64BIT_LIMBS - if defined, the sc_digit vector arithmetic (see sc_vector_utils.h)
+// processes pairs of 32-bit sc_digits as 64-bit limbs, using 128-bit carries and the compiler's
+// add-with-carry builtins. The storage of values is not affected, so SC_LIMB64 is only defined
+// if the compiler provides a 128-bit integer type.
+
+#if defined(SC_ENABLE_64BIT_LIMBS) && defined(__SIZEOF_INT128__)
+#   define SC_LIMB64
+#endif
+
+// SC_KARATSUBA_WORDS - the number of words in the shorter operand at which vector_multiply (see
+// sc_vector_utils.h) switches from long multiplication to the Karatsuba algorithm. A word is an
+// sc_digit, or a 64-bit limb if SC_LIMB64 is defined. The default may be overridden on the
+// command line.
+
+#if !defined(SC_KARATSUBA_WORDS)
+#   define SC_KARATSUBA_WORDS 32
+#endif
+
 typedef unsigned char uchar;
 
 // A small_type number is at least a char. Defining an int is probably
@@ -225,6 +243,11 @@ constexpr uint64 UINT64_32ONES = 0x00000000ffffffffULL;
     typedef uint64       sc_carry;    // type of carry temporaries.
 #endif
 
+#if defined(SC_LIMB64)
+    typedef uint64                        sc_limb;       // pair of sc_digits.
+    __extension__ typedef unsigned __int128 sc_limb_carry; // type of limb carry temporaries.
+#endif
+
 // Bits per ...
 // will be deleted in the future. Use numeric_limits instead
 #define BITS_PER_CHAR    8
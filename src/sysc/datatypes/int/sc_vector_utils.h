@@ -22,6 +22,13 @@
 #include "sc_nbdefs.h"
 #include "sc_nbutils.h"
 
+#if defined(SC_LIMB64)
+#   include <cstring>
+#   if defined(__x86_64__)
+#       include <x86intrin.h>
+#   endif
+#endif
+
 namespace sc_dt {
 
 #define VEC_MIN(A,B) ( (A) <= (B) ? A : B )
@@ -397,7 +404,516 @@ inline int vector_find_significant_hod( int hod, const sc_digit* digits )
     }
     return result_hod;
 }
-    
+
+// +----------------------------------------------------------------------------
+// |"vector_buffer"
+// |
+// | Scratch storage for word vectors, on the stack unless more than
+// | SMALL_N words are requested.
+// +----------------------------------------------------------------------------
+template<typename W>
+class vector_buffer
+{
+  public:
+    enum { SMALL_N = 256 };
+
+    explicit vector_buffer( int words_n ) :
+        m_words_p( words_n <= SMALL_N ? m_small : new W[words_n] )
+    {}
+    ~vector_buffer()
+    {
+        if ( m_words_p != m_small ) { delete [] m_words_p; }
+    }
+    W* get() { return m_words_p; }
+
+  private:
+    vector_buffer( const vector_buffer& );
+    vector_buffer& operator = ( const vector_buffer& );
+
+  private:
+    W* m_words_p;
+    W  m_small[SMALL_N];
+};
+
+// +----------------------------------------------------------------------------
+// |"Unsigned word vectors"
+// |
+// | The templates below operate on vectors of unsigned words of type W, using
+// | the type D, which is twice as wide as W, for products and carries. They
+// | implement the multiplication of wide magnitudes, with W = sc_digit, and
+// | if SC_LIMB64 is defined, with W = sc_limb.
+// +----------------------------------------------------------------------------
+
+// Returns the number of words in the shorter operand at which the Karatsuba
+// algorithm is used, see SC_KARATSUBA_WORDS in sc_nbdefs.h.
+
+inline
+int
+vector_karatsuba_words()
+{
+    return SC_KARATSUBA_WORDS < 4 ? 4 : SC_KARATSUBA_WORDS;
+}
+
+// +----------------------------------------------------------------------------
+// |"vector_add_words"
+// |
+// | This function adds a vector of unsigned words to another one in place.
+// |
+// | Arguments:
+// |     target_n = number of words in 'target_p'.
+// |     target_p = words to be added to.
+// |     source_n = number of words in 'source_p', not more than target_n.
+// |     source_p = words to be added.
+// | Result:
+// |     carry out of the high order word of 'target_p'.
+// +----------------------------------------------------------------------------
+template<typename W, typename D>
+inline
+W
+vector_add_words( const int target_n,
+                  W*        target_p,
+                  const int source_n,
+                  const W*  source_p )
+{
+    D   carry = 0;
+    int word_i;
+
+    for ( word_i = 0; word_i < source_n; ++word_i ) {
+        carry += (D)target_p[word_i] + source_p[word_i];
+	target_p[word_i] = (W)carry;
+	carry >>= CHAR_BIT*sizeof(W);
+    }
+    for ( ; carry && word_i < target_n; ++word_i ) {
+        carry += target_p[word_i];
+	target_p[word_i] = (W)carry;
+	carry >>= CHAR_BIT*sizeof(W);
+    }
+    return (W)carry;
+}
+
+// +----------------------------------------------------------------------------
+// |"vector_subtract_words"
+// |
+// | This function subtracts a vector of unsigned words from another one in
+// | place.
+// |
+// | Arguments:
+// |     target_n = number of words in 'target_p'.
+// |     target_p = words to be subtracted from.
+// |     source_n = number of words in 'source_p', not more than target_n.
+// |     source_p = words to be subtracted.
+// | Result:
+// |     borrow out of the high order word of 'target_p', 0 or 1.
+// +----------------------------------------------------------------------------
+template<typename W, typename D>
+inline
+W
+vector_subtract_words( const int target_n,
+                       W*        target_p,
+                       const int source_n,
+                       const W*  source_p )
+{
+    D   borrow = 0;
+    int word_i;
+
+    for ( word_i = 0; word_i < source_n; ++word_i ) {
+        D difference = (D)target_p[word_i] - source_p[word_i] - borrow;
+	target_p[word_i] = (W)difference;
+	borrow = (difference >> CHAR_BIT*sizeof(W)) & 1;
+    }
+    for ( ; borrow && word_i < target_n; ++word_i ) {
+        borrow = !target_p[word_i];
+	--target_p[word_i];
+    }
+    return (W)borrow;
+}
+
+// +----------------------------------------------------------------------------
+// |"vector_multiply_words"
+// |
+// | This function multiplies two vectors of unsigned words using long
+// | multiplication. The result is calculated a column at a time, with the
+// | products of a column accumulated in a D value and the carries out of it
+// | counted in a W value, so each result word is stored only once.
+// |
+// | Arguments:
+// |     left_n   = number of words in 'left_p'.
+// |     left_p   = words of the left operand.
+// |     right_n  = number of words in 'right_p'.
+// |     right_p  = words of the right operand.
+// |     result_p = words to be filled in, left_n+right_n entries.
+// +----------------------------------------------------------------------------
+template<typename W, typename D>
+inline
+void
+vector_multiply_words( const int left_n,
+                       const W*  left_p,
+                       const int right_n,
+                       const W*  right_p,
+                       W*        result_p )
+{
+    const int result_n = left_n + right_n;
+    D         accumulator = 0;
+    W         overflow = 0;
+
+    for ( int result_i = 0; result_i < result_n-1; ++result_i ) {
+        const int left_low = result_i < right_n ? 0 : result_i-right_n+1;
+        const int left_high = result_i < left_n ? result_i : left_n-1;
+        for ( int left_i = left_low; left_i <= left_high; ++left_i ) {
+            D product = (D)left_p[left_i] * right_p[result_i-left_i];
+            accumulator += product;
+            overflow += accumulator < product;
+        }
+        result_p[result_i] = (W)accumulator;
+        accumulator = ( accumulator >> CHAR_BIT*sizeof(W) ) |
+                      ( (D)overflow << CHAR_BIT*sizeof(W) );
+        overflow = 0;
+    }
+    result_p[result_n-1] = (W)accumulator;
+}
+
+// +----------------------------------------------------------------------------
+// |"vector_karatsuba_scratch_n"
+// |
+// | This function returns the number of scratch words needed by
+// | vector_multiply_karatsuba for operands of the supplied length.
+// +----------------------------------------------------------------------------
+inline
+int
+vector_karatsuba_scratch_n( int words_n )
+{
+    int scratch_n = 0;
+    while ( words_n >= vector_karatsuba_words() ) {
+        words_n = words_n - words_n/2 + 1;
+	scratch_n += 4*words_n;
+    }
+    return scratch_n;
+}
+
+// +----------------------------------------------------------------------------
+// |"vector_multiply_karatsuba"
+// |
+// | This function multiplies two vectors of unsigned words of the same length
+// | using the Karatsuba algorithm. Each operand is split into a low order half
+// | (L) and a high order half (H), of B words, and the product is assembled
+// | from three half-sized products:
+// |
+// |     low    = Ll * Rl
+// |     high   = Lh * Rh
+// |     middle = (Ll + Lh) * (Rl + Rh) - low - high
+// |     result = high * B^2 + middle * B + low
+// |
+// | Operands shorter than vector_karatsuba_words() are multiplied with
+// | vector_multiply_words.
+// |
+// | Arguments:
+// |     words_n   = number of words in each operand.
+// |     left_p    = words of the left operand.
+// |     right_p   = words of the right operand.
+// |     result_p  = words to be filled in, 2*words_n entries.
+// |     scratch_p = vector_karatsuba_scratch_n(words_n) words of storage.
+// +----------------------------------------------------------------------------
+template<typename W, typename D>
+inline
+void
+vector_multiply_karatsuba( const int words_n,
+                           const W*  left_p,
+                           const W*  right_p,
+                           W*        result_p,
+                           W*        scratch_p )
+{
+    if ( words_n < vector_karatsuba_words() ) {
+        vector_multiply_words<W,D>( words_n, left_p, words_n, right_p,
+	                            result_p );
+        return;
+    }
+
+    const int low_n = words_n / 2;
+    const int high_n = words_n - low_n;
+    const int sum_n = high_n + 1;
+    W*        left_sum_p = scratch_p;
+    W*        right_sum_p = left_sum_p + sum_n;
+    W*        middle_p = right_sum_p + sum_n;
+
+    scratch_p = middle_p + 2*sum_n;
+
+    // Place the low and high products in the result:
+
+    vector_multiply_karatsuba<W,D>( low_n, left_p, right_p, result_p,
+                                    scratch_p );
+    vector_multiply_karatsuba<W,D>( high_n, left_p+low_n, right_p+low_n,
+                                    result_p+2*low_n, scratch_p );
+
+    // Calculate the middle product from the sums of the halves:
+
+    for ( int word_i = 0; word_i < high_n; ++word_i ) {
+        left_sum_p[word_i] = left_p[low_n+word_i];
+        right_sum_p[word_i] = right_p[low_n+word_i];
+    }
+    left_sum_p[high_n] =
+        vector_add_words<W,D>( high_n, left_sum_p, low_n, left_p );
+    right_sum_p[high_n] =
+        vector_add_words<W,D>( high_n, right_sum_p, low_n, right_p );
+    vector_multiply_karatsuba<W,D>( sum_n, left_sum_p, right_sum_p, middle_p,
+                                    scratch_p );
+    vector_subtract_words<W,D>( 2*sum_n, middle_p, 2*low_n, result_p );
+    vector_subtract_words<W,D>( 2*sum_n, middle_p, 2*high_n,
+                                result_p+2*low_n );
+
+    // Add in the middle product, which fits into words_n+1 words:
+
+    vector_add_words<W,D>( low_n+2*high_n, result_p+low_n, words_n+1,
+                           middle_p );
+}
+
+// +----------------------------------------------------------------------------
+// |"vector_multiply_magnitudes"
+// |
+// | This function multiplies two vectors of unsigned words. If the shorter
+// | operand has at least vector_karatsuba_words() words the longer operand is
+// | processed in pieces the size of the shorter one, each multiplied using
+// | vector_multiply_karatsuba, otherwise long multiplication is used.
+// |
+// | Arguments:
+// |     left_n   = number of words in 'left_p'.
+// |     left_p   = words of the left operand.
+// |     right_n  = number of words in 'right_p'.
+// |     right_p  = words of the right operand.
+// |     result_p = words to be filled in, left_n+right_n entries.
+// +----------------------------------------------------------------------------
+template<typename W, typename D>
+inline
+void
+vector_multiply_magnitudes( int       left_n,
+                            const W*  left_p,
+                            int       right_n,
+                            const W*  right_p,
+                            W*        result_p )
+{
+    if ( left_n < right_n ) {
+        const W* swap_p = left_p;
+	left_p = right_p;
+	right_p = swap_p;
+	const int swap_n = left_n;
+	left_n = right_n;
+	right_n = swap_n;
+    }
+    if ( right_n < vector_karatsuba_words() ) {
+        vector_multiply_words<W,D>( left_n, left_p, right_n, right_p,
+	                            result_p );
+        return;
+    }
+
+    vector_buffer<W> buffer( 2*right_n + vector_karatsuba_scratch_n(right_n) );
+    W*               product_p = buffer.get();
+    W*               scratch_p = product_p + 2*right_n;
+    const int        result_n = left_n + right_n;
+    int              left_i;
+
+    for ( int result_i = 0; result_i < result_n; ++result_i ) {
+        result_p[result_i] = 0;
+    }
+    for ( left_i = 0; left_i + right_n <= left_n; left_i += right_n ) {
+        vector_multiply_karatsuba<W,D>( right_n, left_p+left_i, right_p,
+	                                product_p, scratch_p );
+	vector_add_words<W,D>( result_n-left_i, result_p+left_i, 2*right_n,
+	                       product_p );
+    }
+    if ( left_i < left_n ) {
+	vector_multiply_magnitudes<W,D>( left_n-left_i, left_p+left_i,
+	                                 right_n, right_p, product_p );
+	vector_add_words<W,D>( result_n-left_i, result_p+left_i,
+	                       result_n-left_i, product_p );
+    }
+}
+
+#if defined(SC_LIMB64)
+
+#if defined(__x86_64__)
+#   define SC_LIMB64_CARRY_INTRINSICS
+#elif defined(__has_builtin)
+#   if __has_builtin(__builtin_addcll) && __has_builtin(__builtin_subcll)
+#       define SC_LIMB64_CARRY_BUILTINS
+#   endif
+#endif
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#   define SC_LIMB64_LITTLE_ENDIAN
+#endif
+
+// +----------------------------------------------------------------------------
+// |"64-bit limb support"
+// |
+// | With SC_LIMB64 defined (see sc_nbdefs.h) the inner loops of the arithmetic
+// | functions below process pairs of sc_digits as one 64-bit limb. The low
+// | order digit of a pair is the low order half of its limb, independent of
+// | the byte order of the host.
+// +----------------------------------------------------------------------------
+inline
+sc_limb
+vector_get_limb( const sc_digit* digits_p )
+{
+#if defined(SC_LIMB64_LITTLE_ENDIAN)
+    sc_limb limb;
+    std::memcpy( &limb, digits_p, sizeof(limb) );
+    return limb;
+#else
+    return (sc_limb)digits_p[0] | ((sc_limb)digits_p[1] << BITS_PER_DIGIT);
+#endif
+}
+
+inline
+void
+vector_set_limb( sc_digit* digits_p, sc_limb limb )
+{
+#if defined(SC_LIMB64_LITTLE_ENDIAN)
+    std::memcpy( digits_p, &limb, sizeof(limb) );
+#else
+    digits_p[0] = (sc_digit)limb;
+    digits_p[1] = (sc_digit)(limb >> BITS_PER_DIGIT);
+#endif
+}
+
+// Returns left + right + carry, 'carry' is 0 or 1 on entry and on exit.
+
+inline
+sc_limb
+vector_add_limbs( sc_limb left, sc_limb right, sc_limb& carry )
+{
+#if defined(SC_LIMB64_CARRY_INTRINSICS)
+    unsigned long long sum;
+    carry = _addcarry_u64( (unsigned char)carry, left, right, &sum );
+    return sum;
+#elif defined(SC_LIMB64_CARRY_BUILTINS)
+    return __builtin_addcll( left, right, carry, &carry );
+#else
+    sc_limb_carry sum = (sc_limb_carry)left + right + carry;
+    carry = (sc_limb)(sum >> 64);
+    return (sc_limb)sum;
+#endif
+}
+
+// Returns left - right - borrow, 'borrow' is 0 or 1 on entry and on exit.
+
+inline
+sc_limb
+vector_subtract_limbs( sc_limb left, sc_limb right, sc_limb& borrow )
+{
+#if defined(SC_LIMB64_CARRY_INTRINSICS)
+    unsigned long long difference;
+    borrow = _subborrow_u64( (unsigned char)borrow, left, right, &difference );
+    return difference;
+#elif defined(SC_LIMB64_CARRY_BUILTINS)
+    return __builtin_subcll( left, right, borrow, &borrow );
+#else
+    sc_limb_carry difference = (sc_limb_carry)left - right - borrow;
+    borrow = (sc_limb)(difference >> 64) & 1;
+    return (sc_limb)difference;
+#endif
+}
+
+// +----------------------------------------------------------------------------
+// |"vector_load_magnitude"
+// |
+// | This function loads the magnitude of a signed sc_digit vector into a vector
+// | of limbs.
+// |
+// | Arguments:
+// |     hod      = index of high order digit in 'digits_p'.
+// |     digits_p = digits of the value.
+// |     limbs_p  = limbs to be filled in, (hod+2)/2 entries.
+// | Result:
+// |     true if the value is negative.
+// +----------------------------------------------------------------------------
+inline
+bool
+vector_load_magnitude( int hod, const sc_digit* digits_p, sc_limb* limbs_p )
+{
+    const int limbs_n = (hod+2) / 2;
+    int       limb_i;
+
+    for ( limb_i = 0; limb_i < hod/2; ++limb_i ) {
+        limbs_p[limb_i] = vector_get_limb( &digits_p[2*limb_i] );
+    }
+    limbs_p[limb_i] = ( hod & 1 ) ? vector_get_limb( &digits_p[hod-1] )
+                                  : (sc_limb)digits_p[hod];
+
+    if ( (int)digits_p[hod] >= 0 ) {
+        return false;
+    }
+
+    // Negative value: take the two's complement, the magnitude fits into
+    // hod+1 digits.
+
+    sc_limb borrow = 0;
+    for ( limb_i = 0; limb_i < limbs_n; ++limb_i ) {
+        limbs_p[limb_i] = vector_subtract_limbs( 0, limbs_p[limb_i], borrow );
+    }
+    if ( !(hod & 1) ) {
+        limbs_p[limbs_n-1] &= DIGIT_MASK;
+    }
+    return true;
+}
+
+// +----------------------------------------------------------------------------
+// |"vector_multiply_limb64"
+// |
+// | This function multiplies two signed sc_digit vectors by multiplying their
+// | magnitudes as 64-bit limbs. The result digits are identical to those of
+// | vector_multiply below: digits 0 through max(result_hod,
+// | left_hod+right_hod) are set.
+// |
+// | Arguments:
+// |     left_hod   = index of high order digit in 'left_p'.
+// |     left_p     = digits of the left operand.
+// |     right_hod  = index of high order digit in 'right_p'.
+// |     right_p    = digits of the right operand.
+// |     result_hod = index of high order digit in 'result_p'.
+// |     result_p   = digits to be filled in in the result.
+// +----------------------------------------------------------------------------
+inline
+void
+vector_multiply_limb64( const int       left_hod,
+                        const sc_digit* left_p,
+                        const int       right_hod,
+                        const sc_digit* right_p,
+                        const int       result_hod,
+                        sc_digit*       result_p )
+{
+    const int left_n = (left_hod+2) / 2;
+    const int right_n = (right_hod+2) / 2;
+    const int product_n = left_n + right_n;
+    const int result_n = VEC_MAX( result_hod, left_hod+right_hod ) + 1;
+
+    vector_buffer<sc_limb> buffer( 2*product_n );
+    sc_limb* left_limbs_p = buffer.get();
+    sc_limb* right_limbs_p = left_limbs_p + left_n;
+    sc_limb* product_p = right_limbs_p + right_n;
+
+    bool negative = vector_load_magnitude( left_hod, left_p, left_limbs_p ) !=
+                    vector_load_magnitude( right_hod, right_p, right_limbs_p );
+    vector_multiply_magnitudes<sc_limb,sc_limb_carry>( left_n, left_limbs_p,
+                                                       right_n, right_limbs_p,
+                                                       product_p );
+
+    // Store the product, negated if the operand signs differ:
+
+    sc_limb borrow = 0;
+    for ( int digit_i = 0; digit_i < result_n; digit_i += 2 ) {
+        const int limb_i = digit_i / 2;
+        sc_limb limb = limb_i < product_n ? product_p[limb_i] : 0;
+        if ( negative ) {
+            limb = vector_subtract_limbs( 0, limb, borrow );
+        }
+        result_p[digit_i] = (sc_digit)limb;
+        if ( digit_i+1 < result_n ) {
+            result_p[digit_i+1] = (sc_digit)(limb >> BITS_PER_DIGIT);
+        }
+    }
+}
+
+#endif // defined(SC_LIMB64)
+
 // +----------------------------------------------------------------------------
 // |"vector_add"
 // |
@@ -454,11 +970,26 @@ vector_add( const int       longer_hod,
     }
 
     int64 carry = 0;
-    int   digit_i;
+    int   digit_i = 0;
 
     // Add the low order unsigned parts of the operands:
 
-    for ( digit_i = 0; digit_i < shorter_hod; ++digit_i ) {
+#if defined(SC_LIMB64)
+    if ( shorter_hod > 1 ) {
+        sc_limb limb_carry = 0;
+	for ( ; digit_i+1 < shorter_hod; digit_i += 2 ) {
+	    vector_set_limb( result_p,
+	                     vector_add_limbs( vector_get_limb(longer_p),
+			                       vector_get_limb(shorter_p),
+					       limb_carry ) );
+	    longer_p += 2;
+	    shorter_p += 2;
+	    result_p += 2;
+	}
+	carry = limb_carry;
+    }
+#endif
+    for ( ; digit_i < shorter_hod; ++digit_i ) {
         carry += *shorter_p++;
         carry += *longer_p++;
 	*result_p++ = (sc_digit)carry;
@@ -1323,6 +1854,81 @@ class vector_mac
     }
 };
 
+// +----------------------------------------------------------------------------
+// |"vector_multiply_wide"
+// |
+// | This function multiplies two signed sc_digit vectors by multiplying their
+// | magnitudes with vector_multiply_magnitudes. It is used by vector_multiply
+// | for operands too wide for long multiplication. The result digits are
+// | identical to those of vector_multiply: digits 0 through max(result_hod,
+// | left_hod+right_hod) are set.
+// |
+// | Arguments:
+// |     left_hod   = index of high order digit in 'left_p'.
+// |     left_p     = digits of the left operand.
+// |     right_hod  = index of high order digit in 'right_p'.
+// |     right_p    = digits of the right operand.
+// |     result_hod = index of high order digit in 'result_p'.
+// |     result_p   = digits to be filled in in the result.
+// +----------------------------------------------------------------------------
+inline
+void
+vector_multiply_wide( const int       left_hod,
+                      const sc_digit* left_p,
+                      const int       right_hod,
+                      const sc_digit* right_p,
+                      const int       result_hod,
+                      sc_digit*       result_p )
+{
+    const int left_n = left_hod + 1;
+    const int right_n = right_hod + 1;
+    const int product_n = left_n + right_n;
+    const int result_n = VEC_MAX( result_hod, left_hod+right_hod ) + 1;
+
+    vector_buffer<sc_digit> buffer( 2*product_n );
+    sc_digit* left_magnitude_p = buffer.get();
+    sc_digit* right_magnitude_p = left_magnitude_p + left_n;
+    sc_digit* product_p = right_magnitude_p + right_n;
+
+    // Load the magnitudes of the operands, for a negative operand the
+    // magnitude fits into hod+1 digits:
+
+    const bool left_negative = 0 > (int)left_p[left_hod];
+    const bool right_negative = 0 > (int)right_p[right_hod];
+    int64      carry = 0;
+
+    for ( int digit_i = 0; digit_i < left_n; ++digit_i ) {
+        carry = left_negative ? carry - left_p[digit_i] : left_p[digit_i];
+	left_magnitude_p[digit_i] = (sc_digit)carry;
+	carry >>= BITS_PER_DIGIT;
+    }
+    carry = 0;
+    for ( int digit_i = 0; digit_i < right_n; ++digit_i ) {
+        carry = right_negative ? carry - right_p[digit_i] : right_p[digit_i];
+	right_magnitude_p[digit_i] = (sc_digit)carry;
+	carry >>= BITS_PER_DIGIT;
+    }
+
+    vector_multiply_magnitudes<sc_digit,uint64>( left_n, left_magnitude_p,
+                                                 right_n, right_magnitude_p,
+                                                 product_p );
+
+    // Store the product, negated if the operand signs differ:
+
+    const bool negative = left_negative != right_negative;
+
+    carry = 0;
+    for ( int digit_i = 0; digit_i < result_n; ++digit_i ) {
+        sc_digit digit = digit_i < product_n ? product_p[digit_i] : 0;
+	if ( negative ) {
+	    carry -= digit;
+	    digit = (sc_digit)carry;
+	    carry >>= BITS_PER_DIGIT;
+	}
+	result_p[digit_i] = digit;
+    }
+}
+
 // +----------------------------------------------------------------------------
 // |"vector_multiply"
 // |
@@ -1418,6 +2024,18 @@ vector_multiply( int             left_hod,
 	shorter_p = left_p; 
     } 
 
+#if defined(SC_LIMB64)
+    if ( shorter_hod > 0 ) {
+        vector_multiply_limb64( longer_hod, longer_p, shorter_hod, shorter_p,
+	                        result_hod, result_p );
+	return;
+    }
+#endif
+    if ( shorter_hod+1 >= vector_karatsuba_words() ) {
+        vector_multiply_wide( longer_hod, longer_p, shorter_hod, shorter_p,
+	                      result_hod, result_p );
+	return;
+    }
 
     // Set the low order digits in the result that are the product of unsigned digits from both 
     // operands. For the example in note (1) this is:
@@ -1755,6 +2373,17 @@ vector_shift_left( const int       from_digits_n,
     else {
         from_i = 0;
         sc_digit carry = 0; 
+#if defined(SC_LIMB64)
+        if ( to_end_hod - to_i > 1 ) {
+            sc_limb limb_carry = 0;
+            for ( ; to_i < to_end_hod; from_i += 2, to_i += 2 ) {
+                sc_limb from_limb = vector_get_limb( &from_p[from_i] );
+                vector_set_limb( &to_p[to_i], (from_limb << from_shift_n) | limb_carry );
+                limb_carry = from_limb >> (carry_shift_n + BITS_PER_DIGIT);
+            }
+            carry = (sc_digit)limb_carry;
+        }
+#endif
         for ( ; to_i <= to_end_hod; ++from_i, ++to_i ) {
 	    sc_digit from_digit = from_p[from_i];
             to_p[to_i] = (from_digit << from_shift_n) | carry;
@@ -1842,6 +2471,18 @@ vector_shift_left( const int target_n,
 
     sc_carry carry = 0;
 
+#if defined(SC_LIMB64)
+    if (target_n > 2) {
+      const int limb_carry_shift = 2 * BITS_PER_DIGIT - shift_remaining;
+      sc_limb   limb_carry = 0;
+      for ( ; target_iter_p + 1 < target_end_p; target_iter_p += 2) {
+        sc_limb target_limb = vector_get_limb(target_iter_p);
+        vector_set_limb(target_iter_p, (target_limb << shift_remaining) | limb_carry);
+        limb_carry = target_limb >> limb_carry_shift;
+      }
+      carry = limb_carry;
+    }
+#endif
     while (target_iter_p < target_end_p) {
       sc_digit target_value = (*target_iter_p);
       (*target_iter_p++) = (sc_digit)(((target_value & mask) << shift_remaining) | carry);
@@ -1923,6 +2564,26 @@ vector_shift_right( const int       target_n,
     sc_digit carry = fill << other_shift_n;
     sc_digit *target_iter_p = (target_p + target_n );
 
+#if defined(SC_LIMB64)
+    // (3) With 64-bit limbs the odd high order digit, if any, is shifted
+    //     alone, and the remaining digits a pair at a time.
+
+    if (target_n > 2) {
+        if (target_n & 1) {
+            sc_digit target_val = *--target_iter_p;
+            (*target_iter_p) = (target_val >> bits_n) | carry;
+            carry = target_val << other_shift_n;
+        }
+        sc_limb limb_carry = (sc_limb)carry << BITS_PER_DIGIT;
+        while (target_p < target_iter_p) {
+            target_iter_p -= 2;
+            sc_limb target_limb = vector_get_limb(target_iter_p);
+            vector_set_limb(target_iter_p, (target_limb >> bits_n) | limb_carry);
+            limb_carry = target_limb << (other_shift_n + BITS_PER_DIGIT);
+        }
+        return;
+    }
+#endif
     while (target_p < target_iter_p) {
         sc_digit target_val = *--target_iter_p;
         (*target_iter_p) = (target_val >> bits_n) | carry;
@@ -1982,11 +2643,26 @@ vector_subtract_longer( const int       longer_hod,
     }
 
     int64 borrow = 0;
-    int   digit_i;
+    int   digit_i = 0;
 
     // Subtract the low-order unsigned parts of the operands:
 
-    for ( digit_i = 0; digit_i < shorter_hod; ++digit_i ) {
+#if defined(SC_LIMB64)
+    if ( shorter_hod > 1 ) {
+        sc_limb limb_borrow = 0;
+	for ( ; digit_i+1 < shorter_hod; digit_i += 2 ) {
+	    vector_set_limb( result_p,
+	                     vector_subtract_limbs( vector_get_limb(shorter_p),
+			                            vector_get_limb(longer_p),
+					            limb_borrow ) );
+	    longer_p += 2;
+	    shorter_p += 2;
+	    result_p += 2;
+	}
+	borrow = -(int64)limb_borrow;
+    }
+#endif
+    for ( ; digit_i < shorter_hod; ++digit_i ) {
         borrow += *shorter_p++;
         borrow -= *longer_p++;
 	*result_p++ = (sc_digit)borrow;
@@ -2087,11 +2763,26 @@ vector_subtract_shorter( const int       longer_hod,
     }
 
     int64 borrow = 0;
-    int   digit_i;
+    int   digit_i = 0;
 
     // Subtract the low-order unsigned parts of the operands:
 
-    for ( digit_i = 0; digit_i < shorter_hod; ++digit_i ) {
+#if defined(SC_LIMB64)
+    if ( shorter_hod > 1 ) {
+        sc_limb limb_borrow = 0;
+	for ( ; digit_i+1 < shorter_hod; digit_i += 2 ) {
+	    vector_set_limb( result_p,
+	                     vector_subtract_limbs( vector_get_limb(longer_p),
+			                            vector_get_limb(shorter_p),
+					            limb_borrow ) );
+	    longer_p += 2;
+	    shorter_p += 2;
+	    result_p += 2;
+	}
+	borrow = -(int64)limb_borrow;
+    }
+#endif
+    for ( ; digit_i < shorter_hod; ++digit_i ) {
         borrow -= *shorter_p++;
         borrow += *longer_p++;
 	*result_p++ = (sc_digit)borrow;
@@ -2190,50 +2881,38 @@ vector_twos_complement( const int       source_hod,
 // |"vector_divide"
 // |
 // | This function implements division of the supplied numerator by the
-// | supplied denominator. Both are vectors of sc_digit (radix32) values, but
-// | are accessed at times as if they were vectors of radix16 values. Either
-// | the quotient of the division, or the remainder, or both may be returned
-// | depending upon the caller's arguments.
-// |
+// | supplied denominator. Both are vectors of sc_digit (radix32) values.
+// | Either the quotient of the division, or the remainder, or both may be
+// | returned depending upon the caller's arguments.
 // |
 // | Notes:
 // |   (1) The division is always performed using non-negative values.
 // |       Conversion of negative values, as well as conversion to negative
 // |       results is performed to allow the use of non-negative values.
 // |
-// |   (2) The quotient and remainder values are treated as radix-16 values
-// |       at times.
-// |
-// |   (3) The algorithm is basically "long division" from grade school:
-// |
-// |                     X   Y   Z
-// |         +--------------------
-// |     abc |   A   B   C   D   E
-// |       -   X*a X*b X*c
-// |           -----------
-// |           r1A r1B r1C   D
-// |       -       Y*a Y*b Y*c
-// |           ---------------
-// |	           r2B r2C r2D   E
-// |       -           Z*a Z*b Z*c
-// |	           ---------------
-// |	               r3C r3D r3E
-// |
-// |       The algorithm consists of:
-// |         (a) Creating a remainder vector that initially is the numerator
-// |             for the division operation.
-// |         (b) Calculating a potential quotient radix16 digit using 64-bit
-// |             native division hardware. So divide the high-order 4 radix16
-// |             digits of the current remainder by the the high-order 3
-// |             radix16 digits of the denominator.
-// |         (c) The potential quotient digit is then multiplied by the
-// |             denominator and that value is subtracted from the remainder.
+// |   (2) A single digit denominator is handled by short division, dividing
+// |       the numerator a digit at a time with 64-bit native division
+// |       hardware.
+// |
+// |   (3) Otherwise the algorithm is Knuth's Algorithm D (The Art of Computer
+// |       Programming, Vol. 2, 4.3.1), long division on radix32 digits:
+// |         (a) Normalize the operands by shifting them left until the high
+// |             order bit of the denominator is one. The shifted numerator
+// |             becomes the remainder vector, with an extra high order digit.
+// |         (b) Estimate the next quotient digit by dividing the high order
+// |             two digits of the remainder by the high order digit of the
+// |             denominator, and correct the estimate using the second digit
+// |             of the denominator. The estimate is then at most one too
+// |             large.
+// |         (c) The quotient digit is multiplied by the denominator and that
+// |             value is subtracted from the remainder.
 // |         (d) If the result is negative then the quotient digit was too
 // |             large by one, so adjust the remainder by adding the
 // |             denominator, and decrement the quotient digit by one.
 // |         (e) Store the quotient digit into the quotient vector.
 // |         (f) Steps (b) through (e) are repeated until all the digits in
-// |             the quotient have been calculated.
+// |             the quotient have been calculated, then the remainder is
+// |             shifted back right.
 // |
 // | Template arguments:
 // |     SN = true if numerator is signed, false if not.
@@ -2303,24 +2982,18 @@ vector_divide( const int       numerator_n,
 
     // SET UP FOR THE CALCULATION:
     //
-    // (1) Trim the numerator and denominator to highest order non-zero value.
-    // (2) Create the denominator value to use in guesses at the quotient
-    //     digit.
-    // (3) Initialize the remainder array to the value of the numerator.
+    // Trim the numerator and denominator to highest order non-zero value.
 
     int       denom_32_hod;     // high order radix32 denominator digit.
     int       numer_32_hod;     // most significant radix32 numerator digit.
 
     denom_32_hod = vector_skip_leading_zeros( denominator_n-1, denominator_p );
-    bool denom_16_hod_odd = (bool)(denominator_p[denom_32_hod] >> 16);
-    int  denom_16_hod= 2*denom_32_hod + denom_16_hod_odd;
 
     for ( numer_32_hod = numerator_n-1;
           numer_32_hod > 0 && !numerator_p[numer_32_hod];
           --numer_32_hod ) {
         continue;
     }
-    int  numer_16_hod = 2*numer_32_hod + (bool)(numerator_p[numer_32_hod]>>16);
 
     // If the denom is zero we are in trouble...
 
@@ -2331,163 +3004,165 @@ vector_divide( const int       numerator_n,
     // If the numerator was smaller than the denominator return a zero
     // quotient and the numerator as the remainder:
 
-    if ( numer_16_hod < denom_16_hod ) {
+    if ( numer_32_hod < denom_32_hod ) {
 	return true;
     }
 
+    sc_digit* remain_work_p = sc_temporary_digits.allocate( numerator_n+denominator_n+2 );
+
+    // SINGLE DIGIT DENOMINATOR:
+    //
+    // Divide the numerator a digit at a time, from the high order digit down,
+    // carrying the remainder of each step into the next one.
 
-    // We will estimate the quotient digits by dividing the the first four
-    // radix-16 digits of the current "remainder" value by the first three
-    // radix-16 digits of the denominator, so assemble those three denominator
-    // digits as a value we can use over and over. Use zeros for any missing
-    // low order digits so that we have three properly aligned radix-16 digits.
+    if ( !denom_32_hod ) {
+        const uint64 denom_value = denominator_p[0];
+        uint64       remain_value = 0;
 
-    uint64 denom_value = (uint64)denominator_p[denom_32_hod] <<
-                  (16 << (int)!denom_16_hod_odd);
-    if ( denom_32_hod ) {
-        denom_value |= denominator_p[denom_32_hod-1] >>
-	               (denom_16_hod_odd ? 16 : 0);
+        for ( int numer_i = numer_32_hod; numer_i >= 0; --numer_i ) {
+            remain_value = ( remain_value << BITS_PER_DIGIT ) | numerator_p[numer_i];
+            if ( numer_i < quotient_n ) {
+                quotient_p[numer_i] = (sc_digit)( remain_value / denom_value );
+            }
+            remain_value %= denom_value;
+            remain_work_p[numer_i] = 0;
+        }
+        remain_work_p[0] = (sc_digit)remain_value;
     }
 
-    // Copy the numerator into the remainder to start off the division process
-    // and zero the extra high order radix32 digit of the remainder:
+    // MULTIPLE DIGIT DENOMINATOR:
 
-    sc_digit* remain_work_p = sc_temporary_digits.allocate( numerator_n+10 ); 
+    else {
 
-    for (int remain_32_i = 0; remain_32_i <= numer_32_hod; ++remain_32_i ) {
-	remain_work_p[remain_32_i] = numerator_p[remain_32_i];
-    }
-    remain_work_p[numer_32_hod+1] = 0;
+        // Normalize the operands, so the high order bit of the denominator
+        // is one. The remainder gets an extra high order digit to receive the
+        // bits shifted out of the numerator.
 
-    // CALCULATE THE QUOTIENT AND REMAINDER:
-    //
-    // This is done with a pair of nested loops that are applied to the radix-16
-    // representation of the numerator and denominator:
-    //   (a) The outer loop runs downwards from the most significant radix-16
-    //       digit in the numerator through the most significant radix-16 in
-    //       the denominator, effectively the values that will contribute to an
-    //       integer result (the quotient). It calculates the next guess at
-    //       a quotient radix16 digit.
-    //   (b) The inner loop runs upwards from the least significant radix32
-    //       digit in the denominator up through the most significant radix32
-    //       digit in the denominator. It subtracts the product of the
-    //       quotient digit times the denominator from the remainder.
-
-    for ( int quot_16_i = numer_16_hod - denom_16_hod; quot_16_i >= 0;
-	  --quot_16_i ) {
-
-	// Calculate some values we need to navigate our vectors:
-
-	bool quot_16_odd   = quot_16_i & 1;
-	int  quot_32_i     = quot_16_i >> 1;
-	int  remain_16_i   = quot_16_i + denom_16_hod;
-	int  remain_32_i   = remain_16_i >> 1;
-	bool remain_16_odd = remain_16_i & 1;
-
-	// Make an educated guess at the next quotient digit by dividing
-	// the current high-order 4 radix-16 digits of the remainder by the
-	// 3 high-order radix-16 digits of the denominator. Potentially the
-	// result can be larger than the radix, so adjust it down by 1
-	// if necessary.
-
-	sc_digit low_order_bits = remain_32_i > 0 ? remain_work_p[remain_32_i-1] :
-						    (sc_digit) 0;
-	uint64 numer_value;
-	if ( remain_16_odd ) {
-            numer_value = ( (uint64)remain_work_p[remain_32_i+1] << 48 ) |
-	                  ( (uint64)remain_work_p[remain_32_i] << 16 ) |
-			  ( low_order_bits >> 16 );
-	}
-	else {
-	    numer_value = ( (uint64)remain_work_p[remain_32_i] << 32 ) |
-	                    low_order_bits;
-	}
+        const int denom_n = denom_32_hod + 1;
+        int       shift = 0;
+        sc_digit* denom_work_p = remain_work_p + numer_32_hod + 2;
 
-	sc_digit quot_guess = (sc_digit)(numer_value / denom_value);
-	if ( quot_guess >> 16 ) {
-	    quot_guess--;
-	}
+        while ( !( ( denominator_p[denom_32_hod] << shift ) & 0x80000000U ) ) {
+            ++shift;
+        }
+        for ( int denom_i = denom_32_hod; denom_i > 0; --denom_i ) {
+            denom_work_p[denom_i] = shift ?
+                ( denominator_p[denom_i] << shift ) |
+                ( denominator_p[denom_i-1] >> (BITS_PER_DIGIT-shift) ) :
+                denominator_p[denom_i];
+        }
+        denom_work_p[0] = denominator_p[0] << shift;
+
+        remain_work_p[numer_32_hod+1] = shift ?
+            numerator_p[numer_32_hod] >> (BITS_PER_DIGIT-shift) : 0;
+        for ( int numer_i = numer_32_hod; numer_i > 0; --numer_i ) {
+            remain_work_p[numer_i] = shift ?
+                ( numerator_p[numer_i] << shift ) |
+                ( numerator_p[numer_i-1] >> (BITS_PER_DIGIT-shift) ) :
+                numerator_p[numer_i];
+        }
+        remain_work_p[0] = numerator_p[0] << shift;
 
-	// Subtract off the product of the current guess at the quotient
-	// times the denominator vector from the remainder working vector.
-
-	int64  carry = 0;
-	int64  product;
-	uint64 quot_term = quot_guess << (quot_16_odd ? 16:0);
-
-	for ( int denom_32_i = 0; denom_32_i <= denom_32_hod; ++denom_32_i) {
-	    carry += remain_work_p[quot_32_i + denom_32_i];
-	    bool carry_was_minus = carry < 0;
-	    product = denominator_p[denom_32_i] * quot_term;
-	    bool product_hob_one = (product < 0);
-	    carry -= product;
-	    remain_work_p[quot_32_i + denom_32_i] = (sc_digit)carry;
-	    bool carry_is_minus = carry < 0;
-	    carry >>= 32;
-
-	    // Because we are subtracting two 64-bit numbers to generate the
-	    // remainder values an overflow is possible. If an overflow does
-	    // occur the upper bits of the carry value will not be correct
-	    // after it was shifted down by 32 bits. There are two cases
-	    // requiring correction:
-	    //   (1) If the carry is non-negative, and either it was negative
-	    //       before the addition of the quotient-denominator product,
-	    //       or the high order bit of the quotient-denominator product
-	    //       is one, an overflow occurred and the high order bits of
-	    //       the carry should have become ones when it was shifted down
-	    //       by 32 bits, so set those bits to one.
-	    //   (2) If the carry is negative, and it was negative before
-	    //       the addition of the quotient-denominator product and the
-	    //       high order bit of the quotient-denominator product is one,
-	    //       then the low order bit of the shifted carry has the wrong
-	    //       sense, so flip it.
-
-	    if ( !carry_is_minus && (product_hob_one || carry_was_minus ) ) {
-		carry |= (std::numeric_limits<uint64_t>::max() << 32);
-	    }
-	    else if ( carry_is_minus && product_hob_one && carry_was_minus ) {
-		carry ^= (1LL << 32);
-	    }
-	}
+        // Calculate the quotient digits from the high order one down:
 
-	// If there are an odd number of digits in either the quotient or
-	// denominator there is an extra digit to be processed, so add the
-	// current carry to the remainder for that digit.
+        const uint64 denom_high = denom_work_p[denom_32_hod];
+        const uint64 denom_next = denom_work_p[denom_32_hod-1];
 
-	if ( quot_16_odd || denom_16_hod_odd ) {
-	    carry += remain_work_p[quot_32_i + denom_32_hod + 1];
-	    remain_work_p[quot_32_i + denom_32_hod + 1] = (sc_digit)carry;
-	}
+        for ( int quot_i = numer_32_hod - denom_32_hod; quot_i >= 0; --quot_i ) {
+            sc_digit* window_p = &remain_work_p[quot_i];
 
-	// If the carry is negative we overshot by one in our approximation
-	// of the quotient digit, so add back in the denominator once and
-	// decrement the quotient guess by one:
-
-	if(carry < 0) {
-	    carry = 0;
-	    for(int restore_i = 0; restore_i <= denom_32_hod; ++restore_i) {
-		carry += (int64)denominator_p[restore_i] <<
-		                 (quot_16_odd ? 16:0);
-		carry += remain_work_p[quot_32_i + restore_i];
-		remain_work_p[quot_32_i + restore_i] = (sc_digit)carry;
-		carry >>= BITS_PER_DIGIT;
-	    }
-	    if ( quot_16_odd | denom_16_hod_odd ) {
-		remain_work_p[quot_32_i+denom_32_hod+1] += (sc_digit)carry;
-	    }
-	    quot_guess--;
-	}
+            // Estimate the quotient digit and correct the estimate, so it is
+            // exact or one too large:
 
-	// Assign the next quotient digit, if we are returning it:
+            uint64 numer_value = ( (uint64)window_p[denom_n] << BITS_PER_DIGIT ) |
+                                 window_p[denom_n-1];
+            uint64 quot_guess = numer_value / denom_high;
+            uint64 remain_guess = numer_value % denom_high;
 
-	if( quotient_n && quot_32_i < quotient_n ) { 
-	    if(quot_16_odd) {
-		quotient_p[quot_32_i] = quot_guess << 16;
-	    }
-	    else {
-		quotient_p[quot_32_i] |= quot_guess;
-	    }
-	}
+            while ( ( quot_guess >> BITS_PER_DIGIT ) ||
+                    quot_guess * denom_next >
+                    ( ( remain_guess << BITS_PER_DIGIT ) | window_p[denom_n-2] ) ) {
+                --quot_guess;
+                remain_guess += denom_high;
+                if ( remain_guess >> BITS_PER_DIGIT ) {
+                    break;
+                }
+            }
+
+            // Subtract off the product of the quotient digit times the
+            // denominator from the remainder:
+
+            uint64 carry = 0;
+            int64  borrow = 0;
+            int    denom_i = 0;
+#if defined(SC_LIMB64)
+            if ( denom_n > 2 ) {
+                sc_limb limb_borrow = 0;
+                for ( ; denom_i+1 < denom_n; denom_i += 2 ) {
+                    sc_limb_carry product = (sc_limb_carry)quot_guess *
+                        vector_get_limb( &denom_work_p[denom_i] ) + carry;
+                    carry = (uint64)( product >> 64 );
+                    vector_set_limb( &window_p[denom_i],
+                        vector_subtract_limbs( vector_get_limb( &window_p[denom_i] ),
+                                               (sc_limb)product, limb_borrow ) );
+                }
+                borrow = -(int64)limb_borrow;
+            }
+#endif
+            for ( ; denom_i < denom_n; ++denom_i ) {
+                uint64 product = quot_guess * denom_work_p[denom_i] + carry;
+                carry = product >> BITS_PER_DIGIT;
+                borrow += (int64)window_p[denom_i] - (sc_digit)product;
+                window_p[denom_i] = (sc_digit)borrow;
+                borrow >>= BITS_PER_DIGIT;
+            }
+            borrow += (int64)window_p[denom_n] - (int64)carry;
+            window_p[denom_n] = (sc_digit)borrow;
+
+            // If the result is negative we overshot by one, so add back in
+            // the denominator once and decrement the quotient digit by one:
+
+            if ( borrow < 0 ) {
+                carry = 0;
+                denom_i = 0;
+#if defined(SC_LIMB64)
+                if ( denom_n > 2 ) {
+                    sc_limb limb_carry = 0;
+                    for ( ; denom_i+1 < denom_n; denom_i += 2 ) {
+                        vector_set_limb( &window_p[denom_i],
+                            vector_add_limbs( vector_get_limb( &window_p[denom_i] ),
+                                              vector_get_limb( &denom_work_p[denom_i] ),
+                                              limb_carry ) );
+                    }
+                    carry = limb_carry;
+                }
+#endif
+                for ( ; denom_i < denom_n; ++denom_i ) {
+                    carry += (uint64)window_p[denom_i] + denom_work_p[denom_i];
+                    window_p[denom_i] = (sc_digit)carry;
+                    carry >>= BITS_PER_DIGIT;
+                }
+                window_p[denom_n] += (sc_digit)carry;
+                --quot_guess;
+            }
+
+            // Assign the next quotient digit, if we are returning it:
+
+            if ( quot_i < quotient_n ) {
+                quotient_p[quot_i] = (sc_digit)quot_guess;
+            }
+        }
+
+        // Undo the normalization of the remainder, its digits above the
+        // denominator's high order digit are zero:
+
+        if ( shift ) {
+            for ( int remain_i = 0; remain_i < denom_32_hod; ++remain_i ) {
+                remain_work_p[remain_i] = ( remain_work_p[remain_i] >> shift ) |
+                    ( remain_work_p[remain_i+1] << (BITS_PER_DIGIT-shift) );
+            }
+            remain_work_p[denom_32_hod] >>= shift;
+        }
     }
 
     // RETURN THE QUOTIENT AND REMAINDER IF REQUESTED:
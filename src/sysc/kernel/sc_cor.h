@@ -107,6 +107,9 @@ public:
     // get the main coroutine
     virtual sc_cor* get_main() = 0;
 
+    // the simulation has ended (e.g. to report statistics)
+    virtual void simulation_done() {}
+
     // get the simulation context
     sc_simcontext* simcontext()
         { return m_simc; }
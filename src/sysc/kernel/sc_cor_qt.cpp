@@ -34,9 +34,12 @@
 #include <cerrno>
 #include <cstring>
 #include <cstdlib>
+#include <map>
 #include <sstream>
+#include <vector>
 
 #include "sysc/kernel/sc_cor_qt.h"
+#include "sysc/kernel/sc_profiler.h"
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/utils/sc_report.h"
 
@@ -75,6 +78,116 @@ static std::size_t sc_pagesize()
     return pagesize;
 }
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_cor_qt_stack_pool
+//
+//  Stacks of deleted coroutines are kept per size class, with their red
+//  zone still in place, and are handed out again to new coroutines of the
+//  same class.  This saves the mmap/mprotect/munmap calls for short-lived
+//  (e.g. spawned) threads.  Stack sizes are rounded up to a class of whole
+//  pages, with at most a quarter of unused pages, so that slightly
+//  different requested sizes share their stacks.  Putting a stack back
+//  into the pool costs no system call: the unused stacks of a class are
+//  only trimmed to half when their number reaches SC_STACK_POOL_SIZE
+//  (default: 64, 0 disables the pool), and the trimmed stacks are
+//  unmapped.  The pool is shared by all simulation contexts.
+// ----------------------------------------------------------------------------
+
+class sc_cor_qt_stack_pool
+{
+public:
+
+    // default number of unused stacks kept per stack size
+    static const std::size_t default_max_unused = 64;
+
+    sc_cor_qt_stack_pool()
+      : m_max_unused( default_max_unused ), m_unused(), m_stats()
+    {
+        // invalid values are ignored
+        const char* max_unused = std::getenv( "SC_STACK_POOL_SIZE" );
+        if( max_unused != NULL && *max_unused != '\0' ) {
+            char* end = NULL;
+            unsigned long value = std::strtoul( max_unused, &end, 10 );
+            if( *end == '\0' ) {
+                m_max_unused = value;
+            }
+        }
+    }
+
+    // the size class of a stack of the given size (a multiple of pagesize):
+    // up to 8 pages exact, above in 4 steps per power of two
+    static std::size_t size_class( std::size_t size, std::size_t pagesize )
+    {
+        std::size_t pages = size / pagesize;
+        std::size_t step = 1;
+        while( ( step << 3 ) < pages )
+            step <<= 1;
+        return ( ( pages + step - 1 ) & ~( step - 1 ) ) * pagesize;
+    }
+
+    // get a stack of the given size class, returns false if none is available
+    bool get( std::size_t size, void** stack, bool* protect )
+    {
+        m_stats.requests++;
+        std::vector<entry>& unused = m_unused[size];
+        if( unused.empty() )
+            return false;
+
+        *stack   = unused.back().stack;
+        *protect = unused.back().protect;
+        unused.pop_back();
+        m_stats.hits++;
+        m_stats.pooled--;
+        return true;
+    }
+
+    // give back the stack of a deleted coroutine
+    void put( std::size_t size, void* stack, bool protect )
+    {
+        m_stats.released++;
+        if( m_max_unused == 0 ) {
+            ::munmap( stack, size );
+            return;
+        }
+        std::vector<entry>& unused = m_unused[size];
+        if( unused.size() >= m_max_unused ) {
+            // high-water mark: unmap the least recently pooled half
+            std::size_t trimmed = unused.size() - m_max_unused / 2;
+            for( std::size_t i = 0; i < trimmed; ++i )
+                ::munmap( unused[i].stack, size );
+            unused.erase( unused.begin(), unused.begin() + trimmed );
+            m_stats.pooled -= trimmed;
+            m_stats.trimmed += trimmed;
+        }
+        entry e = { stack, protect };
+        unused.push_back( e );
+        m_stats.pooled++;
+    }
+
+    const sc_cor_qt_stack_stats& stats() const
+        { return m_stats; }
+
+private:
+
+    struct entry
+    {
+        void* stack;
+        bool  protect;  // red zone enabled
+    };
+
+    std::size_t                                m_max_unused;
+    std::map<std::size_t, std::vector<entry> > m_unused;  // per size class
+    sc_cor_qt_stack_stats                      m_stats;
+};
+
+static sc_cor_qt_stack_pool&
+sc_cor_qt_stacks()
+{
+    // never destroyed, coroutines may outlive their package
+    static sc_cor_qt_stack_pool* pool = new sc_cor_qt_stack_pool;
+    return *pool;
+}
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_cor_qt
 //
@@ -87,7 +200,7 @@ sc_cor_qt::~sc_cor_qt()
         return; // don't delete main stack
     }
     if ( m_stack ) {
-        ::munmap( m_stack, m_stack_size );
+        sc_cor_qt_stacks().put( m_stack_size, m_stack, m_stack_protected );
     }
     if (m_fake_stack) { // cleanup fake stack, when running under Asan
         void* save_fake_stack;
@@ -110,6 +223,12 @@ sc_cor_qt::stack_protect( bool enable )
     // Code needs to be tested on HP-UX and disabled if it doesn't work there
     // Code still needs to be ported to WIN32
 
+    // pooled stacks keep their red zone
+    if( enable == m_stack_protected ) {
+        return;
+    }
+    m_stack_protected = enable;
+
     const std::size_t pagesize = sc_pagesize();
     sc_assert( m_stack_size > ( 2 * pagesize ) );
 
@@ -169,19 +288,34 @@ sc_cor_qt::stack_protect( bool enable )
 
 // allocate aligned stack memory
 static inline void*
-stack_alloc( void** buf, std::size_t* stack_size )
+stack_alloc( void** buf, std::size_t* stack_size, bool* protected_ )
 {
     const std::size_t alignment     = sc_pagesize();
     const std::size_t round_up_mask = alignment - 1;
     sc_assert( 0 == ( alignment & round_up_mask ) ); // power of 2
     sc_assert( buf );
 
-    // round up to multiple of alignment
+    // round up to multiple of alignment, and to its size class
     *stack_size = (*stack_size + round_up_mask) & ~round_up_mask;
+    *stack_size = sc_cor_qt_stack_pool::size_class( *stack_size, alignment );
     sc_assert( *stack_size > (alignment * 2) );
 
+    // reuse a stack of the same size class, if possible
+    bool protect = false;
+    if( sc_cor_qt_stacks().get( *stack_size, buf, &protect ) ) {
+        *protected_ = protect;
+        return *buf;
+    }
+
+#ifdef MAP_NORESERVE
+    // stack pages are committed only when they are used
+    const int flags = MAP_PRIVATE | MAP_ANON | MAP_NORESERVE;
+#else
+    const int flags = MAP_PRIVATE | MAP_ANON;
+#endif
     *buf = ::mmap( NULL, *stack_size, PROT_READ | PROT_WRITE,
-                   MAP_PRIVATE | MAP_ANON, -1, 0 );
+                   flags, -1, 0 );
+    *protected_ = false;
     if ( *buf == MAP_FAILED ) {
         *buf = NULL;
     }
@@ -218,6 +352,43 @@ sc_cor_pkg_qt::~sc_cor_pkg_qt()
 }
 
 
+// statistics of the stack pool
+
+sc_cor_qt_stack_stats
+sc_cor_pkg_qt::stack_pool_stats()
+{
+    return sc_cor_qt_stacks().stats();
+}
+
+
+// report the statistics of the stack pool, if requested by SC_STACK_POOL_STATS
+// or when the simulation is profiled
+
+void
+sc_cor_pkg_qt::simulation_done()
+{
+    bool report = std::getenv( "SC_STACK_POOL_STATS" ) != NULL;
+#if defined(SC_ENABLE_PROFILING)
+    report = report || sc_profiler::instance() != 0;
+#endif
+    if( !report ) {
+        return;
+    }
+
+    const sc_cor_qt_stack_stats& stats = sc_cor_qt_stacks().stats();
+    std::stringstream sstr;
+    sstr << "requests: " << stats.requests
+         << ", hits: " << stats.hits;
+    if( stats.requests ) {
+        sstr << " (" << ( 100.0 * stats.hits / stats.requests ) << "%)";
+    }
+    sstr << ", released: " << stats.released
+         << ", trimmed: " << stats.trimmed
+         << ", pooled: " << stats.pooled;
+    SC_REPORT_INFO( SC_ID_STACK_POOL_STATS_, sstr.str().c_str() );
+}
+
+
 // create a new coroutine
 
 extern "C"
@@ -238,7 +409,8 @@ sc_cor_pkg_qt::create( std::size_t stack_size, sc_cor_fn* fn, void* arg )
     cor->m_pkg = this;
     cor->m_stack_size = stack_size;
 
-    void* aligned_sp = stack_alloc( &cor->m_stack, &cor->m_stack_size );
+    void* aligned_sp = stack_alloc( &cor->m_stack, &cor->m_stack_size,
+                                    &cor->m_stack_protected );
     if( aligned_sp == NULL )
     {
         SC_REPORT_ERROR( SC_ID_COROUTINE_ERROR_
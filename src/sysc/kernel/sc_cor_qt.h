@@ -68,6 +68,7 @@ public:
     void*          m_stack = nullptr;      // stack
     qt_t*          m_sp = nullptr;         // stack pointer
     void*          m_fake_stack = nullptr; // used by Asan
+    bool           m_stack_protected = false; // red zone enabled
 
     sc_cor_pkg_qt* m_pkg = nullptr;    // the creating coroutine package
 
@@ -81,6 +82,18 @@ private:
 //  Coroutine package class implemented with QuickThreads.
 // ----------------------------------------------------------------------------
 
+// statistics of the pool of coroutine stacks (shared by all packages)
+
+struct sc_cor_qt_stack_stats
+{
+    std::size_t requests = 0U;  // stacks requested by create()
+    std::size_t hits = 0U;      // requests served from the pool
+    std::size_t released = 0U;  // stacks given back by deleted coroutines
+    std::size_t trimmed = 0U;   // pooled stacks unmapped above the limit
+    std::size_t pooled = 0U;    // stacks currently kept in the pool
+};
+
+
 class sc_cor_pkg_qt
   : public sc_cor_pkg
 {
@@ -107,6 +120,13 @@ public:
     // set the current coroutine (internal helper)
     inline sc_cor_qt* set_current( sc_cor_qt* );
 
+    // report the stack pool statistics, if requested by SC_STACK_POOL_STATS
+    // or when the simulation is profiled (SC_PROFILE)
+    virtual void simulation_done();
+
+    // statistics of the stack pool
+    static sc_cor_qt_stack_stats stack_pool_stats();
+
 private:
     sc_cor_qt  m_main_cor; // main coroutine
     sc_cor_qt* m_curr_cor; // current coroutine
@@ -39,12 +39,89 @@
 #include "sysc/utils/sc_utils_ids.h"
 
 #include <sstream>
+#include <unordered_set>
 
 namespace sc_core {
 
 using std::malloc;
 using std::strrchr;
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_event_static_group
+//
+//  Static sensitivity shared by all events that wake the same processes (in
+//  the same order).  The group records the batch of delta notifications in
+//  which all of its processes have become runnable.
+//  FOR INTERNAL USE ONLY!
+// ----------------------------------------------------------------------------
+
+class sc_event_static_group
+{
+public:
+    sc_event_static_group( const sc_event_waiters<sc_method_handle>& methods_,
+                           const sc_event_waiters<sc_thread_handle>& threads_ )
+      : m_methods( methods_.static_data(),
+                   methods_.static_data() + methods_.static_size() ),
+        m_threads( threads_.static_data(),
+                   threads_.static_data() + threads_.static_size() ),
+        m_hash( 0 ),
+        m_refs( 0 ), m_runnable_batch( 0 )
+    {
+        for( std::size_t i = 0; i < m_methods.size(); ++i )
+            m_hash = m_hash * 31 + reinterpret_cast<std::size_t>( m_methods[i] );
+        for( std::size_t i = 0; i < m_threads.size(); ++i )
+            m_hash = m_hash * 37 + reinterpret_cast<std::size_t>( m_threads[i] );
+    }
+
+    struct hash
+    {
+        std::size_t operator()( const sc_event_static_group* g ) const
+            { return g->m_hash; }
+    };
+
+    struct equal
+    {
+        bool operator()( const sc_event_static_group* a,
+                         const sc_event_static_group* b ) const
+            { return a->m_methods == b->m_methods &&
+                     a->m_threads == b->m_threads; }
+    };
+
+    typedef std::unordered_set<sc_event_static_group*, hash, equal> table;
+
+    // never destroyed, events may be released during static destruction
+    static table& groups()
+    {
+        static table* groups_p = new table;
+        return *groups_p;
+    }
+
+    std::vector<sc_method_handle> m_methods;
+    std::vector<sc_thread_handle> m_threads;
+    std::size_t                   m_hash;
+    int                           m_refs;
+    sc_dt::uint64                 m_runnable_batch;
+};
+
+// larger static sensitivities are not grouped, they are rarely shared
+static const std::size_t SC_EVENT_STATIC_GROUP_MAX = 64;
+
+// number of the last batch of delta notifications
+static sc_dt::uint64 sc_event_trigger_batch = 0;
+
+// events are kernel state, they must not be notified or cancelled by
+// methods evaluated concurrently, see sc_set_parallel_method_workers()
+// (false, if the error is only displayed and the call has to be ignored)
+static inline bool
+sc_event_check_concurrent( const sc_simcontext* simc, const sc_event* e )
+{
+    if( SC_UNLIKELY_( simc->concurrent_evaluation() ) ) {
+        SC_REPORT_ERROR( SC_ID_CONCURRENT_NOTIFICATION_, e->name() );
+        return false;
+    }
+    return true;
+}
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_event
 //
@@ -54,13 +131,16 @@ using std::strrchr;
 const char*
 sc_event::basename() const
 {
-    const char* p = strrchr( m_name.c_str(), SC_HIERARCHY_CHAR );
-    return p ? (p + 1) : m_name.c_str();
+    const char* name_p = name();
+    const char* p = strrchr( name_p, SC_HIERARCHY_CHAR );
+    return p ? (p + 1) : name_p;
 }
 
 void
 sc_event::cancel()
 {
+    if( !sc_event_check_concurrent( m_simc, this ) )
+        return;
     // cancel a delta or timed notification
     switch( m_notify_type ) {
     case DELTA: {
@@ -72,7 +152,7 @@ sc_event::cancel()
     case TIMED: {
         // remove this event from the timed events set
         sc_assert( m_timed != 0 );
-        m_timed->m_event = 0;
+        m_simc->remove_timed_event( m_timed );
         m_timed = 0;
         m_notify_type = NONE;
         break;
@@ -86,6 +166,8 @@ sc_event::cancel()
 void
 sc_event::notify()
 {
+    if( !sc_event_check_concurrent( m_simc, this ) )
+        return;
     // immediate notification
     if( !m_simc->evaluation_phase() )
         // coming from
@@ -97,12 +179,15 @@ sc_event::notify()
         return;
     }
     cancel();
+    SC_PROFILE_( event_triggered( this ) );
     trigger();
 }
 
 void
 sc_event::notify( const sc_time& t )
 {
+    if( !sc_event_check_concurrent( m_simc, this ) )
+        return;
     if( m_notify_type == DELTA ) {
         return;
     }
@@ -120,7 +205,7 @@ sc_event::notify( const sc_time& t )
         if( m_notify_type == TIMED ) {
             // remove this event from the timed events set
             sc_assert( m_timed != 0 );
-            m_timed->m_event = 0;
+            m_simc->remove_timed_event( m_timed );
             m_timed = 0;
         }
         // add this event to the delta events set
@@ -143,9 +228,10 @@ sc_event::notify( const sc_time& t )
         if( m_timed->m_notify_time <= m_simc->time_stamp() + t ) {
             return;
         }
-        // remove this event from the timed events set
-        m_timed->m_event = 0;
-        m_timed = 0;
+        // move the pending notification forward in the timed events set
+        m_timed->m_notify_time = m_simc->time_stamp() + t;
+        m_simc->update_timed_event( m_timed );
+        return;
     }
     // add this event to the timed events set
     sc_event_timed* et = new sc_event_timed( this, m_simc->time_stamp() + t );
@@ -168,6 +254,8 @@ static void sc_warn_notify_delayed()
 void
 sc_event::notify_delayed()
 {
+    if( !sc_event_check_concurrent( m_simc, this ) )
+        return;
     sc_warn_notify_delayed();
     if( m_notify_type != NONE ) {
         SC_REPORT_ERROR( SC_ID_NOTIFY_DELAYED_, 0 );
@@ -180,6 +268,8 @@ sc_event::notify_delayed()
 void
 sc_event::notify_delayed( const sc_time& t )
 {
+    if( !sc_event_check_concurrent( m_simc, this ) )
+        return;
     sc_warn_notify_delayed();
     if( m_notify_type != NONE ) {
         SC_REPORT_ERROR( SC_ID_NOTIFY_DELAYED_, 0 );
@@ -210,6 +300,7 @@ sc_event::kernel_tag sc_event::kernel_event;
 // | true:
 // |   (a) the leaf name is non-null and is_kernel_event == false
 // |   (b) the event is being created before the start of simulation.
+// | Kernel events are left unnamed if sc_get_unnamed_kernel_events() is true.
 // |
 // | Arguments:
 // |     leaf_name = leaf name of the object or NULL.
@@ -220,8 +311,11 @@ sc_event::register_event( const char* leaf_name, bool is_kernel_event /* = false
     sc_object_manager* object_manager = m_simc->get_object_manager();
     m_parent_with_hierarchy_flag = m_simc->active_object();
 
+    if ( is_kernel_event && m_simc->m_unnamed_kernel_events ) return;
+
     // No name provided, if we are not executing then create a name:
 
+    std::string kernel_name;
     if( !leaf_name || !leaf_name[0] )
     {
         if ( sc_is_running( m_simc ) ) return;
@@ -232,20 +326,22 @@ sc_event::register_event( const char* leaf_name, bool is_kernel_event /* = false
     // prepend kernel events with internal prefix
     else if ( is_kernel_event )
     {
-        m_name = SC_KERNEL_EVENT_PREFIX;
-        m_name.append( leaf_name );
-        leaf_name = m_name.c_str();
+        kernel_name = SC_KERNEL_EVENT_PREFIX;
+        kernel_name.append( leaf_name );
+        leaf_name = kernel_name.c_str();
     }
 
     // Create a hierarchichal name and place it into the object manager if
     // its not a kernel event:
 
-    object_manager->create_name( leaf_name ).swap( m_name );
+    std::string name = object_manager->create_name( leaf_name );
+    m_name_p = new char[name.size() + 1];
+    std::memcpy( m_name_p, name.c_str(), name.size() + 1 );
 
     if ( !is_kernel_event )
     {
         m_parent_with_hierarchy_flag.set_flag( true );
-        object_manager->insert_event(m_name, this);
+        object_manager->insert_event(name, this);
         if ( m_parent_with_hierarchy_flag != NULL )
             m_parent_with_hierarchy_flag->add_child_event( this );
         else
@@ -260,9 +356,9 @@ sc_event::reset()
     m_delta_event_index = -1;
     m_timed = 0;
     // clear the dynamic sensitive methods
-    m_methods_dynamic.resize(0);
+    m_methods.resize_dynamic(0);
     // clear the dynamic sensitive threads
-    m_threads_dynamic.resize(0);
+    m_threads.resize_dynamic(0);
 }
 
 // +----------------------------------------------------------------------------
@@ -281,12 +377,12 @@ sc_event::sc_event( const char* name )
   , m_notify_type( NONE )
   , m_delta_event_index( -1 )
   , m_timed( 0 )
-  , m_methods_static()
-  , m_methods_dynamic()
-  , m_threads_static()
-  , m_threads_dynamic()
-  , m_name()
+  , m_methods()
+  , m_threads()
+  , m_static_group( 0 )
+  , m_name_p( 0 )
   , m_parent_with_hierarchy_flag(NULL)
+  , m_child_index( -1 )
 {
     register_event( name );
 }
@@ -304,12 +400,12 @@ sc_event::sc_event()
   , m_notify_type( NONE )
   , m_delta_event_index( -1 )
   , m_timed( 0 )
-  , m_methods_static()
-  , m_methods_dynamic()
-  , m_threads_static()
-  , m_threads_dynamic()
-  , m_name()
+  , m_methods()
+  , m_threads()
+  , m_static_group( 0 )
+  , m_name_p( 0 )
   , m_parent_with_hierarchy_flag(NULL)
+  , m_child_index( -1 )
 {
     register_event( NULL );
 }
@@ -327,12 +423,12 @@ sc_event::sc_event( kernel_tag, const char* name )
   , m_notify_type( NONE )
   , m_delta_event_index( -1 )
   , m_timed( 0 )
-  , m_methods_static()
-  , m_methods_dynamic()
-  , m_threads_static()
-  , m_threads_dynamic()
-  , m_name()
+  , m_methods()
+  , m_threads()
+  , m_static_group( 0 )
+  , m_name_p( 0 )
   , m_parent_with_hierarchy_flag(NULL)
+  , m_child_index( -1 )
 {
     register_event( name, /* is_kernel_event = */ true );
 }
@@ -347,10 +443,11 @@ sc_event::sc_event( kernel_tag, const char* name )
 sc_event::~sc_event()
 {
     cancel();
+    SC_PROFILE_( event_deleted( this ) );
     if( in_hierarchy() )
     {
         sc_object_manager* object_manager_p = m_simc->get_object_manager();
-        object_manager_p->remove_event( m_name );
+        object_manager_p->remove_event( m_name_p );
 
         if ( m_parent_with_hierarchy_flag != NULL )
             m_parent_with_hierarchy_flag->remove_child_event( this );
@@ -358,54 +455,145 @@ sc_event::~sc_event()
             m_simc->remove_child_event( this );
     }
 
-    for(size_t i = 0; i < m_threads_dynamic.size(); ++i ) {
-        if( m_threads_dynamic[i]->m_event_p == this )
-            m_threads_dynamic[i]->m_event_p = 0;
+    if( m_static_group )
+        release_static_group();
+
+    sc_thread_handle* l_threads_dynamic = m_threads.dynamic_data();
+    for( int i = 0; i < m_threads.dynamic_size(); ++i ) {
+        if( l_threads_dynamic[i]->m_event_p == this )
+            l_threads_dynamic[i]->m_event_p = 0;
+    }
+    sc_method_handle* l_methods_dynamic = m_methods.dynamic_data();
+    for( int i = 0; i < m_methods.dynamic_size(); ++i ) {
+        if( l_methods_dynamic[i]->m_event_p == this )
+            l_methods_dynamic[i]->m_event_p = 0;
+    }
+    delete [] m_name_p;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_event::static_group"
+// |
+// | This method returns the group of events with the same static sensitivity
+// | as this one, or 0 if the static sensitivity is empty or too large.
+// +----------------------------------------------------------------------------
+sc_event_static_group*
+sc_event::static_group()
+{
+    if( m_static_group )
+        return m_static_group;
+
+    std::size_t size = m_methods.static_size() + m_threads.static_size();
+    if( size == 0 || size > SC_EVENT_STATIC_GROUP_MAX )
+        return 0;
+
+    sc_event_static_group::table& groups = sc_event_static_group::groups();
+    sc_event_static_group* group_p =
+      new sc_event_static_group( m_methods, m_threads );
+    std::pair<sc_event_static_group::table::iterator, bool> result =
+      groups.insert( group_p );
+    if( !result.second ) {
+        delete group_p;
+        group_p = *result.first;
     }
-    for(size_t i = 0; i < m_methods_dynamic.size(); ++i ) {
-        if( m_methods_dynamic[i]->m_event_p == this )
-            m_methods_dynamic[i]->m_event_p = 0;
+    group_p->m_refs++;
+    m_static_group = group_p;
+    return group_p;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_event::release_static_group"
+// |
+// | This method detaches this event from its group, called whenever the
+// | static sensitivity changes.
+// +----------------------------------------------------------------------------
+void
+sc_event::release_static_group() const
+{
+    sc_event_static_group* group_p = m_static_group;
+    m_static_group = 0;
+    if( --group_p->m_refs == 0 ) {
+        sc_event_static_group::groups().erase( group_p );
+        delete group_p;
     }
 }
 
 // +----------------------------------------------------------------------------
-// |"sc_event::trigger"
+// |"sc_event::trigger_delta_events"
+// |
+// | This method triggers all delta notified events as one batch. Events with
+// | equal static sensitivity share an sc_event_static_group, once all the
+// | processes of a group have become runnable the remaining events of the
+// | group skip their static sensitivity for the rest of the batch.
+// |
+// | A process is queued at most once per batch without a stamp of its own:
+// | its runnable queue link is set when it is queued and only cleared when
+// | it is dequeued in the next evaluation phase, so is_runnable() stays true
+// | for the rest of the notification phase.
+// |
+// | Arguments:
+// |     events = delta notified events, cleared on return.
+// +----------------------------------------------------------------------------
+void
+sc_event::trigger_delta_events( std::vector<sc_event*>& events )
+{
+    int size = events.size();
+    if( size == 0 )
+        return;
+
+    sc_dt::uint64 batch = ++sc_event_trigger_batch;
+    sc_event** l_events = &events[0];
+    int i = size - 1;
+    do {
+        SC_PROFILE_( event_triggered( l_events[i] ) );
+        l_events[i]->trigger( batch );
+    } while( -- i >= 0 );
+    events.clear();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_event::trigger_processes"
 // |
 // | This method "triggers" this object instance. This consists of scheduling
 // | for execution all the processes that are schedulable and waiting on this
 // | event.
+// |
+// | Arguments:
+// |     batch = number of the current batch of delta notifications, or 0.
 // +----------------------------------------------------------------------------
 void
-sc_event::trigger()
+sc_event::trigger_processes( sc_dt::uint64 batch )
 {
-    m_trigger_stamp = m_simc->change_stamp();
-    m_notify_type = NONE;
-    m_delta_event_index = -1;
-    m_timed = 0;
-
     int       last_i; // index of last element in vector now accessing.
     int       size;   // size of vector now accessing.
 
+    // static sensitivity of a group whose processes all became runnable
+    // earlier in this batch cannot schedule anything
+
+    sc_event_static_group* group_p = batch ? static_group() : 0;
+    bool skip_static = group_p && group_p->m_runnable_batch == batch;
+    bool all_runnable = true;
 
     // trigger the static sensitive methods
 
-    if( ( size = m_methods_static.size() ) != 0 )
+    if( !skip_static && ( size = m_methods.static_size() ) != 0 )
     {
-        sc_method_handle* l_methods_static = &m_methods_static[0];
+        sc_method_handle* l_methods_static = m_methods.static_data();
         int i = size - 1;
         do {
             sc_method_handle method_h = l_methods_static[i];
             method_h->trigger_static();
+            all_runnable = all_runnable && method_h->is_runnable();
         } while( -- i >= 0 );
     }
 
     // trigger the dynamic sensitive methods
 
 
-    if( ( size = m_methods_dynamic.size() ) != 0 )
+    if( ( size = m_methods.dynamic_size() ) != 0 )
     {
 	last_i = size - 1;
-	sc_method_handle* l_methods_dynamic = &m_methods_dynamic[0];
+	sc_method_handle* l_methods_dynamic = m_methods.dynamic_data();
 	for ( int i = 0; i <= last_i; i++ )
 	{
 	    sc_method_handle method_h = l_methods_dynamic[i];
@@ -416,28 +604,32 @@ sc_event::trigger()
 		i--;
 	    }
 	}
-        m_methods_dynamic.resize(last_i+1);
+        m_methods.resize_dynamic(last_i+1);
     }
 
 
     // trigger the static sensitive threads
 
-    if( ( size = m_threads_static.size() ) != 0 )
+    if( !skip_static && ( size = m_threads.static_size() ) != 0 )
     {
-        sc_thread_handle* l_threads_static = &m_threads_static[0];
+        sc_thread_handle* l_threads_static = m_threads.static_data();
         int i = size - 1;
         do {
             sc_thread_handle thread_h = l_threads_static[i];
             thread_h->trigger_static();
+            all_runnable = all_runnable && thread_h->is_runnable();
         } while( -- i >= 0 );
     }
 
+    if( group_p && !skip_static && all_runnable )
+        group_p->m_runnable_batch = batch;
+
     // trigger the dynamic sensitive threads
 
-    if( ( size = m_threads_dynamic.size() ) != 0 )
+    if( ( size = m_threads.dynamic_size() ) != 0 )
     {
 	last_i = size - 1;
-	sc_thread_handle* l_threads_dynamic = &m_threads_dynamic[0];
+	sc_thread_handle* l_threads_dynamic = m_threads.dynamic_data();
 	for ( int i = 0; i <= last_i; i++ )
 	{
 	    sc_thread_handle thread_h = l_threads_dynamic[i];
@@ -448,7 +640,7 @@ sc_event::trigger()
 		last_i--;
 	    }
 	}
-        m_threads_dynamic.resize(last_i+1);
+        m_threads.resize_dynamic(last_i+1);
     }
 }
 
@@ -460,69 +652,29 @@ bool sc_event::triggered() const
 bool
 sc_event::remove_static( sc_method_handle method_h_ ) const
 {
-    int size;
-    if ( ( size = m_methods_static.size() ) != 0 ) {
-      sc_method_handle* l_methods_static = &m_methods_static[0];
-      for( int i = size - 1; i >= 0; -- i ) {
-          if( l_methods_static[i] == method_h_ ) {
-              l_methods_static[i] = l_methods_static[size - 1];
-              m_methods_static.resize(size-1);
-              return true;
-          }
-      }
-    }
-    return false;
+    if( m_static_group )
+        release_static_group();
+    return m_methods.remove_static( method_h_ );
 }
 
 bool
 sc_event::remove_static( sc_thread_handle thread_h_ ) const
 {
-    int size;
-    if ( ( size = m_threads_static.size() ) != 0 ) {
-      sc_thread_handle* l_threads_static = &m_threads_static[0];
-      for( int i = size - 1; i >= 0; -- i ) {
-          if( l_threads_static[i] == thread_h_ ) {
-              l_threads_static[i] = l_threads_static[size - 1];
-              m_threads_static.resize(size-1);
-              return true;
-          }
-      }
-    }
-    return false;
+    if( m_static_group )
+        release_static_group();
+    return m_threads.remove_static( thread_h_ );
 }
 
 bool
 sc_event::remove_dynamic( sc_method_handle method_h_ ) const
 {
-    int size;
-    if ( ( size = m_methods_dynamic.size() ) != 0 ) {
-      sc_method_handle* l_methods_dynamic = &m_methods_dynamic[0];
-      for( int i = size - 1; i >= 0; -- i ) {
-          if( l_methods_dynamic[i] == method_h_ ) {
-              l_methods_dynamic[i] = l_methods_dynamic[size - 1];
-              m_methods_dynamic.resize(size-1);
-              return true;
-          }
-      }
-    }
-    return false;
+    return m_methods.remove_dynamic( method_h_ );
 }
 
 bool
 sc_event::remove_dynamic( sc_thread_handle thread_h_ ) const
 {
-    int size;
-    if ( ( size= m_threads_dynamic.size() ) != 0 ) {
-      sc_thread_handle* l_threads_dynamic = &m_threads_dynamic[0];
-      for( int i = size - 1; i >= 0; -- i ) {
-          if( l_threads_dynamic[i] == thread_h_ ) {
-              l_threads_dynamic[i] = l_threads_dynamic[size - 1];
-              m_threads_dynamic.resize(size-1);
-              return true;
-          }
-      }
-    }
-    return false;
+    return m_threads.remove_dynamic( thread_h_ );
 }
 
 
@@ -661,6 +813,81 @@ sc_event_list::remove_dynamic( sc_thread_handle thread_h,
   }
 }
 
+// Temporary lists of event expressions are not deleted once a process has
+// stopped waiting for them, but kept for reuse together with their storage.
+// Lists that have grown larger than this are deleted. The free lists are not
+// MT-Safe, so they are bypassed while methods are evaluated concurrently.
+
+static const std::size_t SC_EVENT_LIST_REUSE_MAX = 64;
+
+static bool sc_event_list_reuse_allowed()
+{
+    return sc_curr_simcontext == 0 ||
+           ! sc_curr_simcontext->concurrent_evaluation();
+}
+
+static std::vector<sc_event_list*>& sc_event_list_temporaries( bool and_list )
+{
+    // never destroyed, lists may be released during static destruction
+    static std::vector<sc_event_list*>* temporaries_p =
+      new std::vector<sc_event_list*>[2];
+    return temporaries_p[and_list];
+}
+
+sc_event_list*
+sc_event_list::reuse_temporary( bool and_list_ )
+{
+    if( ! sc_event_list_reuse_allowed() )
+        return 0;
+    std::vector<sc_event_list*>& temporaries =
+      sc_event_list_temporaries( and_list_ );
+    if( temporaries.empty() )
+        return 0;
+    sc_event_list* list_p = temporaries.back();
+    temporaries.pop_back();
+    return list_p;
+}
+
+#if defined(__GNUC__) && (__GNUC__ >= 11)
+// Ignore overly strict -Wfree-nonheap-object warning on GCC 11.0 and later
+// -- https://gcc.gnu.org/bugzilla/show_bug.cgi?id=54202
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfree-nonheap-object"
+#endif
+
+void
+sc_event_list::release_temporary() const
+{
+    if( m_events.capacity() > SC_EVENT_LIST_REUSE_MAX ||
+        ! sc_event_list_reuse_allowed() ) {
+        delete this;
+        return;
+    }
+    sc_event_list* list_p = const_cast<sc_event_list*>( this );
+    list_p->m_events.clear();
+    sc_event_list_temporaries( m_and_list ).push_back( list_p );
+}
+
+#if defined(__GNUC__) && (__GNUC__ >= 11)
+#pragma GCC diagnostic pop
+#endif
+
+sc_event_and_list*
+sc_event_and_list::create_temporary()
+{
+    sc_event_list* list_p = reuse_temporary( true );
+    return list_p ? static_cast<sc_event_and_list*>( list_p )
+                  : new sc_event_and_list( true );
+}
+
+sc_event_or_list*
+sc_event_or_list::create_temporary()
+{
+    sc_event_list* list_p = reuse_temporary( false );
+    return list_p ? static_cast<sc_event_or_list*>( list_p )
+                  : new sc_event_or_list( true );
+}
+
 void
 sc_event_list::report_premature_destruction() const
 {
@@ -36,6 +36,8 @@
 #include "sysc/communication/sc_writer_policy.h"
 #include "sysc/utils/sc_ptr_flag.h"
 
+#include <cstring>
+
 #if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
 #pragma warning(push)
 #pragma warning(disable: 4251) // DLL import for std::string
@@ -52,9 +54,78 @@ class sc_event_and_list;
 class sc_object;
 class sc_object_host;
 class sc_signal_channel;
+class sc_event_static_group;
 
 // friend function declarations
 SC_API int sc_notify_time_compare( const void*, const void* );
+SC_API void sc_notify_time_index( void*, int );
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_event_waiters<T>
+//
+//  The processes of one kind waiting for an event: the static sensitive
+//  processes followed by the dynamic sensitive ones. A single process is
+//  stored inline, larger lists spill to the heap.
+//  FOR INTERNAL USE ONLY!
+// ----------------------------------------------------------------------------
+
+template< typename T >
+class sc_event_waiters
+{
+public:
+
+    sc_event_waiters()
+      : m_data( &m_inline ), m_static_size( 0 ), m_size( 0 ), m_inline( 0 )
+      {}
+
+    ~sc_event_waiters()
+      { if( m_data != &m_inline ) delete [] m_data; }
+
+    bool empty() const
+      { return m_size == 0; }
+
+    int static_size() const
+      { return m_static_size; }
+    T* static_data() const
+      { return m_data; }
+
+    int dynamic_size() const
+      { return m_size - m_static_size; }
+    T* dynamic_data() const
+      { return m_data + m_static_size; }
+
+    void push_static( T h );
+    void push_dynamic( T h )
+      { if( m_size == capacity() ) grow(); m_data[m_size++] = h; }
+
+    bool remove_static( T h );
+    bool remove_dynamic( T h );
+
+    void resize_dynamic( int size )
+      { m_size = m_static_size + size; }
+
+private:
+
+    int capacity() const
+      { return m_data == &m_inline ? 1 : m_capacity; }
+    void grow();
+
+private:
+
+    T*  m_data;         // &m_inline or the heap storage
+    int m_static_size;  // static waiters in [0, m_static_size)
+    int m_size;         // dynamic waiters in [m_static_size, m_size)
+    union {
+        T   m_inline;   // the only waiter, while stored inline
+        int m_capacity; // size of the heap storage, once spilled
+    };
+
+private:
+
+    // disabled
+    sc_event_waiters( const sc_event_waiters& );
+    sc_event_waiters& operator = ( const sc_event_waiters& );
+};
 
 // ----------------------------------------------------------------------------
 //  CLASS : sc_event_expr
@@ -72,7 +143,7 @@ class sc_event_expr
     typedef T type;
 
     inline sc_event_expr()
-       : m_expr( new T(true) )
+       : m_expr( T::create_temporary() )
     {}
 
 public:
@@ -109,7 +180,8 @@ public:
 
     ~sc_event_expr()
     {
-        delete m_expr;
+        if( m_expr )
+            m_expr->auto_delete();
     }
 
 private:
@@ -168,6 +240,9 @@ protected:
     bool temporary()   const;
     void auto_delete() const;
 
+    static sc_event_list* reuse_temporary( bool and_list_ );
+    void release_temporary() const;
+
     void report_premature_destruction() const;
     void report_invalid_modification()  const;
 
@@ -200,6 +275,8 @@ protected:
     explicit
     sc_event_and_list( bool auto_delete_ );
 
+    static sc_event_and_list* create_temporary();
+
 public:
 
     sc_event_and_list();
@@ -235,6 +312,8 @@ protected:
     explicit
     sc_event_or_list( bool auto_delete_ );
 
+    static sc_event_or_list* create_temporary();
+
 public:
     sc_event_or_list();
     sc_event_or_list( const sc_event& );
@@ -283,7 +362,7 @@ public:
 
     const char* basename() const;
     const char* name() const
-      { return m_name.c_str(); }
+      { return m_name_p ? m_name_p : ""; }
     sc_object* get_parent_object() const
       { return m_parent_with_hierarchy_flag; }
     bool in_hierarchy() const
@@ -326,7 +405,14 @@ private:
     void register_event( const char* name, bool is_kernel_event = false );
     void reset();
 
-    void trigger();
+    // triggers the delta notified events (and clears the list)
+    static void trigger_delta_events( std::vector<sc_event*>& events );
+
+    inline void trigger( sc_dt::uint64 batch = 0 );
+    void trigger_processes( sc_dt::uint64 batch );
+
+    sc_event_static_group* static_group();
+    void release_static_group() const;
 
 private:
 
@@ -338,14 +424,14 @@ private:
     int             m_delta_event_index;
     sc_event_timed* m_timed;
 
-    mutable std::vector<sc_method_handle> m_methods_static;
-    mutable std::vector<sc_method_handle> m_methods_dynamic;
-    mutable std::vector<sc_thread_handle> m_threads_static;
-    mutable std::vector<sc_thread_handle> m_threads_dynamic;
+    mutable sc_event_waiters<sc_method_handle> m_methods;
+    mutable sc_event_waiters<sc_thread_handle> m_threads;
+    mutable sc_event_static_group*             m_static_group; // see static_group
 
-    std::string                 m_name;     // name of the event
+    char*                       m_name_p;   // name of the event or NULL
     sc_ptr_flag<sc_object_host> m_parent_with_hierarchy_flag; // parent object of
     // the event, extra flag is set to true, if event is registered in hierarchy
+    int                         m_child_index; // index in parent's child list
 
 private:
     static struct kernel_tag {} kernel_event;
@@ -368,11 +454,12 @@ class SC_API sc_event_timed
     friend class sc_simcontext;
 
     friend SC_API int sc_notify_time_compare( const void*, const void* );
+    friend SC_API void sc_notify_time_index( void*, int );
 
 private:
 
     sc_event_timed( sc_event* e, const sc_time& t )
-        : m_event( e ), m_notify_time( t )
+        : m_event( e ), m_notify_time( t ), m_heap_index( 0 )
         {}
 
     ~sc_event_timed()
@@ -400,6 +487,7 @@ private:
 
     sc_event* m_event;
     sc_time   m_notify_time;
+    int       m_heap_index;  // position in the timed event queue, 0 if none
 
 private:
 
@@ -412,6 +500,66 @@ private:
 
 // IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
 
+template< typename T >
+inline
+void
+sc_event_waiters<T>::push_static( T h )
+{
+    if( m_size == capacity() )
+        grow();
+    // shift the dynamic waiters, keeping their order
+    T* p = m_data + m_static_size;
+    if( m_size != m_static_size )
+        std::memmove( p + 1, p, ( m_size - m_static_size ) * sizeof( T ) );
+    *p = h;
+    m_static_size++;
+    m_size++;
+}
+
+template< typename T >
+inline
+bool
+sc_event_waiters<T>::remove_static( T h )
+{
+    for( int i = m_static_size - 1; i >= 0; -- i ) {
+        if( m_data[i] == h ) {
+            m_data[i] = m_data[--m_static_size];
+            T* p = m_data + m_static_size;
+            if( --m_size != m_static_size )
+                std::memmove( p, p + 1, ( m_size - m_static_size ) * sizeof( T ) );
+            return true;
+        }
+    }
+    return false;
+}
+
+template< typename T >
+inline
+bool
+sc_event_waiters<T>::remove_dynamic( T h )
+{
+    for( int i = m_size - 1; i >= m_static_size; -- i ) {
+        if( m_data[i] == h ) {
+            m_data[i] = m_data[--m_size];
+            return true;
+        }
+    }
+    return false;
+}
+
+template< typename T >
+void
+sc_event_waiters<T>::grow()
+{
+    int capacity_ = capacity() * 2;
+    T* data_p = new T[capacity_];
+    std::memcpy( data_p, m_data, m_size * sizeof( T ) );
+    if( m_data != &m_inline )
+        delete [] m_data;
+    m_data = data_p;
+    m_capacity = capacity_;
+}
+
 inline
 void
 sc_event::notify( double v, sc_time_unit tu )
@@ -437,6 +585,22 @@ sc_event::notify_internal( const sc_time& t )
     }
 }
 
+// batch = number of the current batch of delta notifications, 0 for
+// immediate and timed notifications
+
+inline
+void
+sc_event::trigger( sc_dt::uint64 batch )
+{
+    m_trigger_stamp = m_simc->change_stamp();
+    m_notify_type = NONE;
+    m_delta_event_index = -1;
+    m_timed = 0;
+
+    if( !m_methods.empty() || !m_threads.empty() )
+        trigger_processes( batch );
+}
+
 inline
 void
 sc_event::notify_next_delta()
@@ -461,28 +625,32 @@ inline
 void
 sc_event::add_static( sc_method_handle method_h ) const
 {
-    m_methods_static.push_back( method_h );
+    if( m_static_group )
+        release_static_group();
+    m_methods.push_static( method_h );
 }
 
 inline
 void
 sc_event::add_static( sc_thread_handle thread_h ) const
 {
-    m_threads_static.push_back( thread_h );
+    if( m_static_group )
+        release_static_group();
+    m_threads.push_static( thread_h );
 }
 
 inline
 void
 sc_event::add_dynamic( sc_method_handle method_h ) const
 {
-    m_methods_dynamic.push_back( method_h );
+    m_methods.push_dynamic( method_h );
 }
 
 inline
 void
 sc_event::add_dynamic( sc_thread_handle thread_h ) const
 {
-    m_threads_dynamic.push_back( thread_h );
+    m_threads.push_dynamic( thread_h );
 }
 
 
@@ -601,13 +769,6 @@ sc_event_list::temporary() const
     return m_auto_delete && ! m_busy;
 }
 
-#if defined(__GNUC__) && (__GNUC__ >= 11)
-// Ignore overly strict -Wfree-nonheap-object warning on GCC 11.0 and later
-// -- https://gcc.gnu.org/bugzilla/show_bug.cgi?id=54202
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wfree-nonheap-object"
-#endif
-
 inline
 void
 sc_event_list::auto_delete() const
@@ -616,14 +777,10 @@ sc_event_list::auto_delete() const
         --m_busy;
     }
     if( ! m_busy && m_auto_delete ) {
-        delete this;
+        release_temporary();
     }
 }
 
-#if defined(__GNUC__) && (__GNUC__ >= 11)
-#pragma GCC diagnostic pop
-#endif
-
 
 // IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
 
@@ -208,6 +208,14 @@ SC_DEFINE_MESSAGE(SC_ID_UNSUSPENDABLE_NOTHREAD_  , 577,
         "unsuspendable/suspendable only valid inside a process" )
 SC_DEFINE_MESSAGE(SC_ID_UNBALANCED_UNSUSPENDALL_ , 578,
         "Unmatched unsuspendall/suspendall" )
+SC_DEFINE_MESSAGE(SC_ID_SET_PARALLEL_SAFE_       , 579,
+        "set_parallel_safe() is only allowed for SC_METHODs" )
+SC_DEFINE_MESSAGE(SC_ID_STACK_POOL_STATS_        , 580,
+        "coroutine stack pool statistics" )
+SC_DEFINE_MESSAGE(SC_ID_PROFILE_WRITE_          , 581,
+        "cannot write profile" )
+SC_DEFINE_MESSAGE(SC_ID_CONCURRENT_NOTIFICATION_ , 582,
+        "event notified or cancelled by a method evaluated concurrently" )
 
 /*****************************************************************************
 
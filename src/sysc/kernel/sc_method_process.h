@@ -106,6 +106,7 @@ class sc_method_process : public sc_process_b {
     friend void sc_set_stack_size( sc_method_handle, std::size_t );
     friend class sc_event;
     friend class sc_invoke_method;
+    friend class sc_method_worker_pool;
     friend class sc_module;
     friend class sc_process_table;
     friend class sc_process_handle;
@@ -143,6 +144,7 @@ class sc_method_process : public sc_process_b {
     virtual void enable_process(
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
     inline bool run_process();
+    inline bool run_concurrently() const;
     virtual void kill_process(
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
     sc_method_handle next_exist();
@@ -159,6 +161,7 @@ class sc_method_process : public sc_process_b {
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
     void set_next_exist( sc_method_handle next_p );
     void set_next_runnable( sc_method_handle next_p );
+    void set_parallel_safe( bool safe ) { m_parallel_safe = safe; }
     void set_stack_size( std::size_t size );
     virtual void suspend_process( 
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
@@ -172,6 +175,7 @@ class sc_method_process : public sc_process_b {
     sc_cor*                          m_cor;        // Thread's coroutine.
     std::size_t                      m_stack_size; // Thread stack size.
     std::vector<sc_process_monitor*> m_monitor_q;  // Thread monitors.
+    bool                             m_parallel_safe; // May run concurrently.
 
   private:
     // may not be deleted manually (called from sc_process_b)
@@ -320,6 +324,20 @@ inline bool sc_method_process::run_process()
     return true;
 }
 
+//------------------------------------------------------------------------------
+//"sc_method_process::run_concurrently"
+//
+// This method returns true if this object instance may be evaluated on a
+// worker thread of the parallel evaluation phase. This requires the process
+// to be marked as side-effect-isolated and its semantics to neither involve
+// a reset nor a pending exception, since these would need the kernel.
+//------------------------------------------------------------------------------
+inline bool sc_method_process::run_concurrently() const
+{
+    return m_parallel_safe && m_throw_status == THROW_NONE &&
+           m_active_areset_n == 0 && m_active_reset_n == 0;
+}
+
 //------------------------------------------------------------------------------
 //"sc_method_process::trigger_static"
 //
@@ -128,6 +128,7 @@ sc_module::sc_module()
   , m_port_index(0)
   , m_name_gen(0)
   , m_module_name_p(0)
+  , m_registry_index(-1)
 {
     /* When this form is used, we better have a fresh sc_module_name
        on the top of the stack */
@@ -153,6 +154,7 @@ sc_module::sc_module( const sc_module_name& )
   , m_port_vec()
   , m_port_index(0)
   , m_module_name_p(0)
+  , m_registry_index(-1)
 {
     /* For those used to the old style of passing a name to sc_module,
        this constructor will reduce the chance of making a mistake */
@@ -184,7 +186,8 @@ sc_module::sc_module( const char* nm )
   m_end_module_called(false),
   m_port_vec(),
   m_port_index(0),
-  m_module_name_p(0)
+  m_module_name_p(0),
+  m_registry_index(-1)
 {
     SC_REPORT_WARNING( SC_ID_BAD_SC_MODULE_CONSTRUCTOR_, nm );
     sc_module_init();
@@ -198,7 +201,8 @@ sc_module::sc_module( const std::string& s )
   m_end_module_called(false),
   m_port_vec(),
   m_port_index(0),
-  m_module_name_p(0)
+  m_module_name_p(0),
+  m_registry_index(-1)
 {
     SC_REPORT_WARNING( SC_ID_BAD_SC_MODULE_CONSTRUCTOR_, s.c_str() );
     sc_module_init();
@@ -432,6 +436,22 @@ sc_module::set_stack_size( std::size_t size )
 }
 
 
+void
+sc_module::set_parallel_safe()
+{
+    sc_process_handle last_proc = sc_get_last_created_process_handle();
+    sc_method_handle method_h = (sc_method_handle)last_proc;
+    if ( method_h )
+    {
+	method_h->set_parallel_safe( true );
+    }
+    else
+    {
+	SC_REPORT_WARNING( SC_ID_SET_PARALLEL_SAFE_, 0 );
+    }
+}
+
+
 int
 sc_module::append_port( sc_port_base* port_ )
 {
@@ -303,6 +303,10 @@ protected:
     // Function to set the stack size of the current (c)thread process.
     void set_stack_size( std::size_t );
 
+    // to allow concurrent evaluation of the last created SC_METHOD,
+    // see sc_set_parallel_method_workers()
+    void set_parallel_safe();
+
     int append_port( sc_port_base* );
 
 private:
@@ -318,6 +322,7 @@ private:
     int                         m_port_index;
     sc_name_gen*                m_name_gen;
     sc_module_name*             m_module_name_p;
+    int                         m_registry_index; // index in module registry
 
 public:
 
@@ -185,14 +185,14 @@ sc_object::sc_object_init(const char* nm)
 
 sc_object::sc_object()
   : m_attr_cltn_p(0), m_name()
-  , m_parent(0), m_simc(0)
+  , m_parent(0), m_simc(0), m_child_index(-1)
 {
     sc_object_init( sc_gen_unique_name("object") );
 }
 
 sc_object::sc_object( const sc_object& that )
   : m_attr_cltn_p(0), m_name()
-  , m_parent(0), m_simc(0)
+  , m_parent(0), m_simc(0), m_child_index(-1)
 {
     sc_object_init( sc_gen_unique_name( that.basename() ) );
 }
@@ -206,7 +206,7 @@ object_name_illegal_char(char ch)
 
 sc_object::sc_object(const char* nm)
   : m_attr_cltn_p(0), m_name()
-  , m_parent(0), m_simc(0)
+  , m_parent(0), m_simc(0), m_child_index(-1)
 {
     int namebuf_alloc = 0;
     char* namebuf = 0;
@@ -402,6 +402,7 @@ void
 sc_object_host::add_child_event( sc_event* event_p )
 {
     // no check if event_p is already in the set
+    event_p->m_child_index = static_cast<int>( m_child_events.size() );
     m_child_events.push_back( event_p );
 }
 
@@ -409,6 +410,7 @@ void
 sc_object_host::add_child_object( sc_object* object_p )
 {
     // no check if object_ is already in the set
+    object_p->m_child_index = static_cast<int>( m_child_objects.size() );
     m_child_objects.push_back( object_p );
 }
 
@@ -416,7 +418,8 @@ sc_object_host::add_child_object( sc_object* object_p )
 // |"sc_object_host::remove_child_event"
 // |
 // | This virtual method removes the supplied event from the list of child
-// | events if it is present.
+// | events if it is present. The event's child index locates it in constant
+// | time; the last event of the list takes its place.
 // |
 // | Arguments:
 // |     event_p -> event to be removed.
@@ -426,25 +429,24 @@ bool
 sc_object_host::remove_child_event( sc_event* event_p )
 {
     std::vector< sc_event* > & events = m_child_events;
-    std::vector< sc_event* >::iterator it  = events.begin(), end = events.end();
+    int i = event_p->m_child_index;
 
-    for( ; it != end; ++it  ) {
-        if( *it == event_p )
-        {
-            (*it)->m_parent_with_hierarchy_flag = NULL;
-            *it = events.back();
-            events.pop_back();
-            return true;
-        }
-    }
-    return false;
+    if( i < 0 || i >= static_cast<int>( events.size() ) || events[i] != event_p )
+        return false;
+
+    event_p->m_parent_with_hierarchy_flag = NULL;
+    events[i] = events.back();
+    events[i]->m_child_index = i;
+    events.pop_back();
+    return true;
 }
 
 // +----------------------------------------------------------------------------
 // |"sc_object_host::remove_child_object"
 // |
 // | This virtual method removes the supplied object from the list of child
-// | objects if it is present.
+// | objects if it is present. The object's child index locates it in
+// | constant time; the last object of the list takes its place.
 // |
 // | Arguments:
 // |     object_p -> object to be removed.
@@ -454,18 +456,16 @@ bool
 sc_object_host::remove_child_object( sc_object* object_p )
 {
     std::vector< sc_object* > & objects = m_child_objects;
-    std::vector< sc_object* >::iterator it  = objects.begin(), end = objects.end();
+    int i = object_p->m_child_index;
 
-    for( ; it != end; ++it  ) {
-        if( *it == object_p )
-        {
-            (*it)->m_parent = NULL;
-            *it = objects.back();
-            objects.pop_back();
-            return true;
-        }
-    }
-    return false;
+    if( i < 0 || i >= static_cast<int>( objects.size() ) || objects[i] != object_p )
+        return false;
+
+    object_p->m_parent = NULL;
+    objects[i] = objects.back();
+    objects[i]->m_child_index = i;
+    objects.pop_back();
+    return true;
 }
 
 // +----------------------------------------------------------------------------
@@ -185,6 +185,7 @@ private:
     std::string             m_name;          // name of this object.
     sc_object_host*         m_parent;        // parent for this object.
     sc_simcontext*          m_simc;          // simcontext ptr / empty indicator
+    int                     m_child_index;   // index in parent's child list.
 };
 
 inline sc_object&
@@ -28,14 +28,17 @@
 
 
 #include <cstdio>
+#include <cstring>
 #include <cstdlib>
 #include <cassert>
 #include <cctype>
 #include <cstddef>
 #include <cctype>
 #include <algorithm> // pick up std::sort.
+#include <cstring>
 
 #include "sysc/kernel/sc_object.h"
+#include "sysc/kernel/sc_event.h"
 #include "sysc/utils/sc_hash.h"
 #include "sysc/utils/sc_list.h"
 #include "sysc/utils/sc_mempool.h"
@@ -56,13 +59,18 @@ namespace sc_core {
 // ----------------------------------------------------------------------------
 
 sc_object_manager::sc_object_manager() :
-    m_event_it(),
-    m_event_walk_ok(0),
     m_instance_table(),
+    m_instance_slots(),
+    m_leaf_blocks(),
+    m_leaf_free_p(0),
+    m_leaf_free_size(0),
+    m_leaves(),
     m_module_name_stack(0),
-    m_object_it(),
+    m_object_walk(),
+    m_object_walk_i(0),
     m_object_stack(),
-    m_object_walk_ok()
+    m_object_walk_ok(),
+    m_object_walk_sorted(false)
 {
 }
 
@@ -75,14 +83,202 @@ sc_object_manager::sc_object_manager() :
 // +----------------------------------------------------------------------------
 sc_object_manager::~sc_object_manager()
 {
-    instance_table_t::iterator it;     // instance table iterator.
-
-    for ( it = m_instance_table.begin(); it != m_instance_table.end(); it++) 
+    for ( std::size_t i = 0; i < m_instance_table.size(); ++i )
     {
-        if(it->second.m_name_origin == SC_NAME_OBJECT) {
-            sc_object* obj_p = static_cast<sc_object*>(it->second.m_element_p);
+        table_entry& entry = m_instance_table[i].m_entry;
+        if(entry.m_name_origin == SC_NAME_OBJECT) {
+            sc_object* obj_p = static_cast<sc_object*>(entry.m_element_p);
             obj_p->m_simc = 0;
+        } else if(entry.m_name_origin == SC_NAME_EXTERNAL) {
+            delete static_cast<std::string*>(entry.m_element_p);
+        }
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_name_hash"
+// |
+// | This function returns the hash of a name segment and the index of the
+// | node holding the name up to the segment (64-bit FNV-1a, with the high
+// | bits folded into the low bits used to index the table).
+// +----------------------------------------------------------------------------
+static inline std::size_t
+sc_name_hash( int parent, const char* leaf_p, std::size_t leaf_size )
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    hash = ( hash ^ static_cast<unsigned int>( parent + 1 ) ) * 1099511628211ULL;
+    for ( std::size_t i = 0; i < leaf_size; ++i ) {
+        hash = ( hash ^ static_cast<unsigned char>( leaf_p[i] ) ) * 1099511628211ULL;
+    }
+    hash ^= hash >> 29;
+    return static_cast<std::size_t>( hash ^ ( hash >> 32 ) );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::find_node"
+// |
+// | This method returns the index of the node for the supplied name segment
+// | below the supplied parent node, or -1 if there is no such node. The
+// | nodes are located through an open-addressing hash index with linear
+// | probing.
+// |
+// | Arguments:
+// |     parent    =  index of the parent node, -1 for the top level.
+// |     leaf_p    -> characters of the name segment.
+// |     leaf_size =  number of characters in the name segment.
+// +----------------------------------------------------------------------------
+int
+sc_object_manager::find_node( int parent, const char* leaf_p,
+                              std::size_t leaf_size ) const
+{
+    if ( m_instance_slots.empty() )
+        return -1;
+
+    std::size_t mask = m_instance_slots.size() - 1;
+    std::size_t slot = sc_name_hash( parent, leaf_p, leaf_size ) & mask;
+    for ( ;; slot = ( slot + 1 ) & mask )
+    {
+        int node_i = m_instance_slots[slot];
+        if ( node_i < 0 )
+            return -1;
+        const name_node& node = m_instance_table[node_i];
+        if ( node.m_parent == parent &&
+             node.leaf() == std::string_view( leaf_p, leaf_size ) )
+            return node_i;
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::grow_slots"
+// |
+// | This method doubles the size of the hash index of the instance table
+// | and enters all existing nodes into it again.
+// +----------------------------------------------------------------------------
+void
+sc_object_manager::grow_slots()
+{
+    std::size_t size = m_instance_slots.empty() ? 64 : 2 * m_instance_slots.size();
+    std::size_t mask = size - 1;
+
+    m_instance_slots.assign( size, -1 );
+    for ( std::size_t i = 0; i < m_instance_table.size(); ++i )
+    {
+        const name_node& node = m_instance_table[i];
+        std::size_t slot =
+            sc_name_hash( node.m_parent, node.m_leaf_p, node.m_leaf_size ) & mask;
+        while ( m_instance_slots[slot] >= 0 )
+            slot = ( slot + 1 ) & mask;
+        m_instance_slots[slot] = static_cast<int>( i );
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::intern_leaf"
+// |
+// | This method returns the interned copy of the supplied name segment,
+// | copying it into the blocks of segment characters if it is new. The
+// | copies live as long as the object manager.
+// |
+// | Arguments:
+// |     leaf_p    -> characters of the name segment.
+// |     leaf_size =  number of characters in the name segment.
+// +----------------------------------------------------------------------------
+const char*
+sc_object_manager::intern_leaf( const char* leaf_p, std::size_t leaf_size )
+{
+    static const std::size_t block_size = 4096;
+
+    std::unordered_set<std::string_view>::const_iterator it =
+        m_leaves.find( std::string_view( leaf_p, leaf_size ) );
+    if ( it != m_leaves.end() )
+        return it->data();
+
+    if ( leaf_size > m_leaf_free_size )
+    {
+        std::size_t size = std::max( leaf_size, block_size );
+        m_leaf_blocks.emplace_back( new char[size] );
+        m_leaf_free_p = m_leaf_blocks.back().get();
+        m_leaf_free_size = size;
+    }
+    char* copy_p = m_leaf_free_p;
+    if ( leaf_size != 0 )
+        std::memcpy( copy_p, leaf_p, leaf_size );
+    m_leaf_free_p += leaf_size;
+    m_leaf_free_size -= leaf_size;
+    m_leaves.insert( std::string_view( copy_p, leaf_size ) );
+    return copy_p;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::find_entry"
+// |
+// | This method returns the instance table entry for the supplied name, or
+// | NULL if the name has never been entered. The name is looked up one
+// | segment at a time.
+// |
+// | Arguments:
+// |     name_p -> characters of the name.
+// |     size   =  number of characters in the name.
+// +----------------------------------------------------------------------------
+sc_object_manager::table_entry*
+sc_object_manager::find_entry( const char* name_p, std::size_t size )
+{
+    const char* end_p = name_p + size;
+    int         node_i = -1;
+
+    for ( ;; )
+    {
+        const char* sep_p = std::find( name_p, end_p, SC_HIERARCHY_CHAR );
+        node_i = find_node( node_i, name_p, sep_p - name_p );
+        if ( node_i < 0 )
+            return NULL;
+        if ( sep_p == end_p )
+            return &m_instance_table[node_i].m_entry;
+        name_p = sep_p + 1;
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::insert_entry"
+// |
+// | This method returns the instance table entry for the supplied name,
+// | creating the nodes for the segments of the name that are not in the
+// | table yet.
+// |
+// | Arguments:
+// |     name = name of the entry.
+// +----------------------------------------------------------------------------
+sc_object_manager::table_entry&
+sc_object_manager::insert_entry( const std::string& name )
+{
+    const char* name_p = name.c_str();
+    const char* end_p = name_p + name.size();
+    int         node_i = -1;
+
+    for ( ;; )
+    {
+        const char* sep_p = std::find( name_p, end_p, SC_HIERARCHY_CHAR );
+        std::size_t leaf_size = sep_p - name_p;
+        int         child_i = find_node( node_i, name_p, leaf_size );
+        if ( child_i < 0 )
+        {
+            if ( 2 * ( m_instance_table.size() + 1 ) > m_instance_slots.size() )
+                grow_slots();
+
+            child_i = static_cast<int>( m_instance_table.size() );
+            m_instance_table.push_back(
+                name_node( node_i, intern_leaf( name_p, leaf_size ), leaf_size ) );
+
+            std::size_t mask = m_instance_slots.size() - 1;
+            std::size_t slot = sc_name_hash( node_i, name_p, leaf_size ) & mask;
+            while ( m_instance_slots[slot] >= 0 )
+                slot = ( slot + 1 ) & mask;
+            m_instance_slots[slot] = child_i;
         }
+        node_i = child_i;
+        if ( sep_p == end_p )
+            return m_instance_table[node_i].m_entry;
+        name_p = sep_p + 1;
     }
 }
 
@@ -169,9 +365,8 @@ std::string sc_object_manager::create_name(const char* leaf_name)
 bool
 sc_object_manager::name_exists(const std::string& name)
 {
-    instance_table_t::const_iterator it = m_instance_table.find(name);
-    return (it != m_instance_table.end()) &&
-           (it->second.m_name_origin != SC_NAME_NONE);
+    table_entry* entry_p = find_entry(name);
+    return (entry_p != NULL) && (entry_p->m_name_origin != SC_NAME_NONE);
 }
 
 // +----------------------------------------------------------------------------
@@ -187,11 +382,18 @@ sc_object_manager::name_exists(const std::string& name)
 const char*
 sc_object_manager::get_name(const std::string& name)
 {
-    instance_table_t::iterator it = m_instance_table.find(name);
-    if (it != m_instance_table.end() &&
-        it->second.m_name_origin != SC_NAME_NONE) {
-        return it->first.c_str();
-    } else {
+    table_entry* entry_p = find_entry(name);
+    if (entry_p == NULL) {
+        return NULL;
+    }
+    switch (entry_p->m_name_origin) {
+      case SC_NAME_OBJECT:
+        return static_cast<sc_object*>(entry_p->m_element_p)->name();
+      case SC_NAME_EVENT:
+        return static_cast<sc_event*>(entry_p->m_element_p)->name();
+      case SC_NAME_EXTERNAL:
+        return static_cast<std::string*>(entry_p->m_element_p)->c_str();
+      default:
         return NULL;
     }
 }
@@ -209,12 +411,10 @@ sc_object_manager::get_name(const std::string& name)
 sc_event*
 sc_object_manager::find_event(const char* name)
 {
-    instance_table_t::iterator it;
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EVENT)
+    table_entry* entry_p = find_entry(name, std::strlen(name));
+    if(entry_p != NULL && entry_p->m_name_origin == SC_NAME_EVENT)
     {
-        return static_cast<sc_event*>(it->second.m_element_p);
+        return static_cast<sc_event*>(entry_p->m_element_p);
     } else {
         return NULL;
     }
@@ -233,12 +433,10 @@ sc_object_manager::find_event(const char* name)
 sc_object*
 sc_object_manager::find_object(const char* name)
 {
-    instance_table_t::iterator it;
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_OBJECT)
+    table_entry* entry_p = find_entry(name, std::strlen(name));
+    if(entry_p != NULL && entry_p->m_name_origin == SC_NAME_OBJECT)
     {
-        return static_cast<sc_object*>(it->second.m_element_p);
+        return static_cast<sc_object*>(entry_p->m_element_p);
     } else {
         return NULL;
     }
@@ -248,26 +446,47 @@ sc_object_manager::find_object(const char* name)
 // +----------------------------------------------------------------------------
 // |"sc_object_manager::first_object"
 // | 
-// | This method initializes the object iterator to point to the first object
-// | in the instance table, and returns its address. If there are no objects
-// | in the table a NULL value is returned.
+// | This method collects the objects in the instance table in the order of
+// | their names, initializes the object iterator to point to the first one,
+// | and returns its address. If there are no objects in the table a NULL
+// | value is returned. The sorted objects are kept until an object is
+// | inserted; removed objects are skipped by the walk.
 // +----------------------------------------------------------------------------
 sc_object*
 sc_object_manager::first_object()
 {
-    sc_object* result_p; // result to return.
-
     m_object_walk_ok = true;
-    result_p = NULL;
-    for ( m_object_it = m_instance_table.begin(); 
-          m_object_it != m_instance_table.end(); 
-	  m_object_it++ )
+    if ( !m_object_walk_sorted )
     {
-        if(m_object_it->second.m_name_origin == SC_NAME_OBJECT) {
-            return static_cast<sc_object*>(m_object_it->second.m_element_p);
+        m_object_walk_sorted = true;
+        m_object_walk.clear();
+        for ( std::size_t i = 0; i < m_instance_table.size(); ++i )
+        {
+            if(m_instance_table[i].m_entry.m_name_origin == SC_NAME_OBJECT) {
+                m_object_walk.push_back( static_cast<int>( i ) );
+            }
         }
+
+        const instance_table_t& table = m_instance_table;
+        std::sort( m_object_walk.begin(), m_object_walk.end(),
+            [&table]( int a, int b ) {
+                return std::strcmp(
+                    static_cast<sc_object*>(table[a].m_entry.m_element_p)->name(),
+                    static_cast<sc_object*>(table[b].m_entry.m_element_p)->name()
+                ) < 0;
+            } );
     }
-    return result_p;
+
+    for ( m_object_walk_i = 0; m_object_walk_i < m_object_walk.size();
+          ++m_object_walk_i )
+    {
+        const table_entry& entry =
+            m_instance_table[m_object_walk[m_object_walk_i]].m_entry;
+        if(entry.m_name_origin == SC_NAME_OBJECT) {
+            return static_cast<sc_object*>(entry.m_element_p);
+        }
+    }
+    return NULL;
 }
 
 // +----------------------------------------------------------------------------
@@ -337,12 +556,12 @@ sc_object_manager::hierarchy_size()
 bool
 sc_object_manager::insert_external_name(const std::string& name)
 {
-    if(!name_exists(name)) {
-        m_instance_table[name].m_element_p = NULL;
-        m_instance_table[name].m_name_origin = SC_NAME_EXTERNAL;
+    table_entry& element = insert_entry(name);
+    if(element.m_name_origin == SC_NAME_NONE) {
+        element.m_element_p = new std::string(name);
+        element.m_name_origin = SC_NAME_EXTERNAL;
         return true;
     } else {
-        table_entry element = m_instance_table[name];
         std::stringstream msg;
         msg << name << " ("
             << ((element.m_name_origin == SC_NAME_OBJECT)
@@ -368,8 +587,9 @@ sc_object_manager::insert_external_name(const std::string& name)
 void
 sc_object_manager::insert_event(const std::string& name, sc_event* event_p)
 {
-    m_instance_table[name].m_element_p = static_cast<void*>(event_p);
-    m_instance_table[name].m_name_origin = SC_NAME_EVENT;
+    table_entry& entry = insert_entry(name);
+    entry.m_element_p = static_cast<void*>(event_p);
+    entry.m_name_origin = SC_NAME_EVENT;
 }
 
 // +----------------------------------------------------------------------------
@@ -385,8 +605,10 @@ sc_object_manager::insert_event(const std::string& name, sc_event* event_p)
 void
 sc_object_manager::insert_object(const std::string& name, sc_object* object_p)
 {
-    m_instance_table[name].m_element_p = static_cast<void*>(object_p);
-    m_instance_table[name].m_name_origin = SC_NAME_OBJECT;
+    table_entry& entry = insert_entry(name);
+    entry.m_element_p = static_cast<void*>(object_p);
+    entry.m_name_origin = SC_NAME_OBJECT;
+    m_object_walk_sorted = false;
 }
 
 // +----------------------------------------------------------------------------
@@ -397,21 +619,20 @@ sc_object_manager::insert_object(const std::string& name, sc_object* object_p)
 sc_object*
 sc_object_manager::next_object()
 {
-    sc_object* result_p; // result to return.
-
     sc_assert( m_object_walk_ok );
 
-    if ( m_object_it == m_instance_table.end() ) return NULL;
-    m_object_it++;
+    if ( m_object_walk_i == m_object_walk.size() ) return NULL;
+    m_object_walk_i++;
 
-    for ( result_p = NULL; m_object_it != m_instance_table.end(); 
-	  m_object_it++ )
+    for ( ; m_object_walk_i < m_object_walk.size(); ++m_object_walk_i )
     {
-        if(m_object_it->second.m_name_origin == SC_NAME_OBJECT) {
-            return static_cast<sc_object*>(m_object_it->second.m_element_p);
+        const table_entry& entry =
+            m_instance_table[m_object_walk[m_object_walk_i]].m_entry;
+        if(entry.m_name_origin == SC_NAME_OBJECT) {
+            return static_cast<sc_object*>(entry.m_element_p);
         }
     }
-    return result_p;
+    return NULL;
 }
 
 // +----------------------------------------------------------------------------
@@ -477,15 +698,13 @@ sc_object_manager::top_of_module_name_stack_name() const
 // |     name = name of the event to be removed.
 // +----------------------------------------------------------------------------
 void
-sc_object_manager::remove_event(const std::string& name)
+sc_object_manager::remove_event(const char* name)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EVENT)
+    table_entry* entry_p = find_entry(name, std::strlen(name));
+    if(entry_p != NULL && entry_p->m_name_origin == SC_NAME_EVENT)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        entry_p->m_element_p = NULL;
+        entry_p->m_name_origin = SC_NAME_NONE;
     }
 }
 
@@ -501,13 +720,11 @@ sc_object_manager::remove_event(const std::string& name)
 void
 sc_object_manager::remove_object(const std::string& name)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_OBJECT)
+    table_entry* entry_p = find_entry(name);
+    if(entry_p != NULL && entry_p->m_name_origin == SC_NAME_OBJECT)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        entry_p->m_element_p = NULL;
+        entry_p->m_name_origin = SC_NAME_NONE;
     }
 }
 
@@ -523,13 +740,12 @@ sc_object_manager::remove_object(const std::string& name)
 bool
 sc_object_manager::remove_external_name(const std::string& name)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EXTERNAL)
+    table_entry* entry_p = find_entry(name);
+    if(entry_p != NULL && entry_p->m_name_origin == SC_NAME_EXTERNAL)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        delete static_cast<std::string*>(entry_p->m_element_p);
+        entry_p->m_element_p = NULL;
+        entry_p->m_name_origin = SC_NAME_NONE;
         return true;
     } else {
         return false;
@@ -30,7 +30,10 @@
 #ifndef SC_OBJECT_MANAGER_H
 #define SC_OBJECT_MANAGER_H
 
-#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_set>
 #include <vector>
 
 namespace sc_core {
@@ -69,9 +72,28 @@ protected:
         sc_name_origin m_name_origin;
     };
 
+    // One segment of a hierarchical name. The name up to the preceding
+    // hierarchy character is held by the parent node, so common prefixes
+    // are stored once. The characters of the segment are interned, equal
+    // segments of different names (e.g. "clk") share them.
+    struct name_node
+    {
+        name_node( int parent, const char* leaf_p, std::size_t leaf_size )
+          : m_parent(parent), m_leaf_p(leaf_p), m_leaf_size(leaf_size),
+            m_entry() {}
+
+        std::string_view leaf() const
+            { return std::string_view( m_leaf_p, m_leaf_size ); }
+
+        int         m_parent;    // index of parent node or -1 at the top level.
+        const char* m_leaf_p;    // segment of the name held by this node.
+        std::size_t m_leaf_size; // number of characters in the segment.
+        table_entry m_entry;     // element named by this node, if any.
+    };
+
 public:
-    typedef std::map<std::string,table_entry> instance_table_t;
-    typedef std::vector<sc_object_host*>      object_vector_t;
+    typedef std::vector<name_node>       instance_table_t;
+    typedef std::vector<sc_object_host*> object_vector_t;
 
     sc_object_manager();
     ~sc_object_manager();
@@ -96,23 +118,38 @@ public:
     const char*     top_of_module_name_stack_name() const;
 
 private:
+    table_entry* find_entry( const char* name_p, std::size_t size );
+    table_entry* find_entry( const std::string& name )
+        { return find_entry( name.c_str(), name.size() ); }
+    table_entry& insert_entry( const std::string& name );
+    int find_node( int parent, const char* leaf_p, std::size_t leaf_size ) const;
+    void grow_slots();
+    const char* intern_leaf( const char* leaf_p, std::size_t leaf_size );
+
     std::string create_name( const char* leaf_name );
     void insert_event(const std::string& name, sc_event* obj);
     void insert_object(const std::string& name, sc_object* obj);
     bool insert_external_name(const std::string& name);
-    void remove_event(const std::string& name);
+    void remove_event(const char* name);
     void remove_object(const std::string& name);
     bool remove_external_name(const std::string& name);
 
 private:
 
-    instance_table_t::iterator m_event_it;          // event instance iterator.
-    bool                       m_event_walk_ok;     // true if can walk events.
     instance_table_t           m_instance_table;    // table of instances.
+    std::vector<int>           m_instance_slots;    // hash index of the table.
+    std::vector< std::unique_ptr<char[]> >
+                               m_leaf_blocks;       // interned name segments.
+    char*                      m_leaf_free_p;       // unused part of last block.
+    std::size_t                m_leaf_free_size;    // its size.
+    std::unordered_set<std::string_view>
+                               m_leaves;            // index of the segments.
     sc_module_name*            m_module_name_stack; // sc_module_name stack.
-    instance_table_t::iterator m_object_it;         // object instance iterator.
+    std::vector<int>           m_object_walk;       // objects sorted by name.
+    std::size_t                m_object_walk_i;     // object walk position.
     object_vector_t            m_object_stack;      // sc_object stack.
     bool                       m_object_walk_ok;    // true if can walk objects.
+    bool                       m_object_walk_sorted;// m_object_walk is current.
 };
 
 } // namespace sc_core
@@ -37,6 +37,7 @@
 #include "sysc/kernel/sc_thread_process.h"
 #include "sysc/kernel/sc_sensitive.h"
 #include "sysc/kernel/sc_process_handle.h"
+#include "sysc/kernel/sc_profiler.h"
 #include "sysc/kernel/sc_event.h"
 #include <sstream>
 
@@ -585,6 +586,8 @@ sc_process_b::sc_process_b( const char* name_p, bool is_thread, bool free_host,
 //------------------------------------------------------------------------------
 sc_process_b::~sc_process_b()
 {
+    SC_PROFILE_( process_deleted( this ) );
+
     // DELETE SEMANTICS OBJECTS IF NEED BE:
 
     if ( m_free_host ) delete m_semantics_host_p;
@@ -0,0 +1,374 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_profiler.cpp - Kernel instrumentation for profiling simulations
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_profiler.h"
+
+#if defined(SC_ENABLE_PROFILING)
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_process.h"
+#include "sysc/utils/sc_report.h"
+
+namespace sc_core {
+
+bool         sc_profiler::m_initialized = false;
+sc_profiler* sc_profiler::m_instance_p = 0;
+
+// seconds as floating point number
+
+static double
+sc_profiler_seconds( sc_profiler::clock::duration time )
+{
+    return std::chrono::duration<double>( time ).count();
+}
+
+// names written to JSON strings or CSV fields
+
+static std::string
+sc_profiler_quote( const std::string& name, bool json )
+{
+    std::string result( 1, '"' );
+    for( std::string::const_iterator it = name.begin(); it != name.end(); ++it )
+    {
+        char c = *it;
+        if( c == '"' ) {
+            result += json ? "\\\"" : "\"\"";
+        } else if( json && c == '\\' ) {
+            result += "\\\\";
+        } else if( json && static_cast<unsigned char>(c) < 0x20 ) {
+            char buf[8];
+            std::snprintf( buf, sizeof(buf), "\\u%04x", c );
+            result += buf;
+        } else {
+            result += c;
+        }
+    }
+    result += '"';
+    return result;
+}
+
+static const char*
+sc_profiler_kind( const sc_process_b* process_p )
+{
+    switch( process_p->proc_kind() )
+    {
+      case SC_METHOD_PROC_:  return "SC_METHOD";
+      case SC_THREAD_PROC_:  return "SC_THREAD";
+      case SC_CTHREAD_PROC_: return "SC_CTHREAD";
+      default:               return "unknown";
+    }
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_profiler
+//
+//  Kernel instrumentation for profiling simulations.
+// ----------------------------------------------------------------------------
+
+sc_profiler::sc_profiler( const char* file_name )
+  : m_file_name( file_name )
+  , m_written( false )
+  , m_mutex()
+  , m_processes()
+  , m_dead_processes()
+  , m_events()
+  , m_dead_events()
+  , m_current_p( 0 )
+  , m_current_start( clock::now() )
+  , m_kernel_time()
+  , m_start( m_current_start )
+  , m_time_steps()
+{}
+
+void
+sc_profiler::initialize()
+{
+    m_initialized = true;
+    const char* file_name = std::getenv( "SC_PROFILE" );
+    if( file_name != NULL && *file_name != '\0' ) {
+        m_instance_p = new sc_profiler( file_name );
+        std::atexit( &sc_profiler::write_at_exit );
+    }
+}
+
+void
+sc_profiler::write_at_exit()
+{
+    if( m_instance_p )
+        m_instance_p->write();
+}
+
+sc_profiler::process_stats&
+sc_profiler::stats( const sc_process_b* process_p )
+{
+    process_map::iterator it = m_processes.find( process_p );
+    if( it == m_processes.end() ) {
+        it = m_processes.insert( std::make_pair( process_p, process_stats() ) ).first;
+        it->second.name = process_p->name();
+        it->second.kind = sc_profiler_kind( process_p );
+    }
+    return it->second;
+}
+
+sc_profiler::event_stats&
+sc_profiler::stats( const sc_event* event_p )
+{
+    event_map::iterator it = m_events.find( event_p );
+    if( it == m_events.end() ) {
+        it = m_events.insert( std::make_pair( event_p, event_stats() ) ).first;
+        it->second.name = event_p->name();
+        if( it->second.name.empty() )
+            it->second.name = "<unnamed>";
+    }
+    return it->second;
+}
+
+void
+sc_profiler::switch_to( const sc_process_b* process_p )
+{
+    if( process_p == m_current_p )
+        return;
+
+    clock::time_point now = clock::now();
+    if( m_current_p ) {
+        stats( m_current_p ).time += now - m_current_start;
+    } else {
+        m_kernel_time += now - m_current_start;
+    }
+    m_current_p = process_p;
+    m_current_start = now;
+}
+
+void
+sc_profiler::activated( const sc_process_b* process_p )
+{
+    process_stats& s = stats( process_p );
+    if( process_p->proc_kind() != SC_METHOD_PROC_ )
+        s.switches++;
+    if( s.resuming ) {
+        s.resuming = false;
+    } else {
+        s.activations++;
+    }
+}
+
+void
+sc_profiler::preempted( const sc_process_b* process_p )
+{
+    stats( process_p ).resuming = true;
+}
+
+void
+sc_profiler::concurrent_run( const sc_process_b* process_p,
+                             clock::duration time )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    stats( process_p ).time += time;
+}
+
+void
+sc_profiler::process_deleted( const sc_process_b* process_p )
+{
+    if( process_p == m_current_p )
+        switch_to( 0 );
+    process_map::iterator it = m_processes.find( process_p );
+    if( it != m_processes.end() ) {
+        m_dead_processes.push_back( it->second );
+        m_processes.erase( it );
+    }
+}
+
+void
+sc_profiler::event_triggered( const sc_event* event_p )
+{
+    stats( event_p ).triggers++;
+}
+
+void
+sc_profiler::event_deleted( const sc_event* event_p )
+{
+    event_map::iterator it = m_events.find( event_p );
+    if( it != m_events.end() ) {
+        m_dead_events.push_back( it->second );
+        m_events.erase( it );
+    }
+}
+
+void
+sc_profiler::delta_cycle( const sc_time& now )
+{
+    if( m_time_steps.empty() || m_time_steps.back().first != now ) {
+        m_time_steps.push_back( std::make_pair( now, sc_dt::uint64(1) ) );
+    } else {
+        m_time_steps.back().second++;
+    }
+}
+
+void
+sc_profiler::write()
+{
+    if( m_written )
+        return;
+    m_written = true;
+
+    switch_to( 0 ); // account the running process
+
+    std::ofstream os( m_file_name.c_str() );
+    if( !os ) {
+        SC_REPORT_WARNING( SC_ID_PROFILE_WRITE_, m_file_name.c_str() );
+        return;
+    }
+
+    std::string::size_type n = m_file_name.size();
+    if( n >= 4 && m_file_name.compare( n - 4, 4, ".csv" ) == 0 ) {
+        write_csv( os );
+    } else {
+        write_json( os );
+    }
+}
+
+// processes by descending wall time, events by descending trigger count
+
+void
+sc_profiler::sorted( std::vector<process_stats>& processes,
+                     std::vector<event_stats>& events ) const
+{
+    processes = m_dead_processes;
+    for( process_map::const_iterator it = m_processes.begin();
+         it != m_processes.end(); ++it )
+        processes.push_back( it->second );
+    std::stable_sort( processes.begin(), processes.end(),
+      []( const process_stats& a, const process_stats& b )
+        { return a.time > b.time; } );
+
+    events = m_dead_events;
+    for( event_map::const_iterator it = m_events.begin();
+         it != m_events.end(); ++it )
+        events.push_back( it->second );
+    std::stable_sort( events.begin(), events.end(),
+      []( const event_stats& a, const event_stats& b )
+        { return a.triggers > b.triggers; } );
+}
+
+void
+sc_profiler::write_csv( std::ostream& os )
+{
+    std::vector<process_stats> processes;
+    std::vector<event_stats> events;
+    sorted( processes, events );
+
+    os << std::setprecision( 9 );
+    os << "record,name,kind,count,context_switches,wall_time_s\n";
+    os << "kernel,,,,," << sc_profiler_seconds( m_kernel_time ) << '\n';
+    for( std::size_t i = 0; i < processes.size(); ++i ) {
+        const process_stats& s = processes[i];
+        os << "process," << sc_profiler_quote( s.name, false ) << ','
+           << s.kind << ',' << s.activations << ',' << s.switches << ','
+           << sc_profiler_seconds( s.time ) << '\n';
+    }
+    for( std::size_t i = 0; i < events.size(); ++i ) {
+        os << "event," << sc_profiler_quote( events[i].name, false )
+           << ",," << events[i].triggers << ",,\n";
+    }
+    for( std::size_t i = 0; i < m_time_steps.size(); ++i ) {
+        os << "time_step," << m_time_steps[i].first.to_string()
+           << ",delta_cycles," << m_time_steps[i].second << ",,\n";
+    }
+}
+
+void
+sc_profiler::write_json( std::ostream& os )
+{
+    std::vector<process_stats> processes;
+    std::vector<event_stats> events;
+    sorted( processes, events );
+
+    sc_dt::uint64 deltas = 0;
+    sc_dt::uint64 max_deltas = 0;
+    for( std::size_t i = 0; i < m_time_steps.size(); ++i ) {
+        deltas += m_time_steps[i].second;
+        max_deltas = std::max( max_deltas, m_time_steps[i].second );
+    }
+
+    os << std::setprecision( 9 );
+    os << "{\n"
+       << "  \"wall_time_s\": "
+       << sc_profiler_seconds( clock::now() - m_start ) << ",\n"
+       << "  \"kernel_time_s\": "
+       << sc_profiler_seconds( m_kernel_time ) << ",\n"
+       << "  \"delta_cycles\": " << deltas << ",\n"
+       << "  \"max_delta_cycles_per_time_step\": " << max_deltas << ",\n";
+
+    os << "  \"processes\": [";
+    for( std::size_t i = 0; i < processes.size(); ++i ) {
+        const process_stats& s = processes[i];
+        os << ( i ? ",\n" : "\n" )
+           << "    { \"name\": " << sc_profiler_quote( s.name, true )
+           << ", \"kind\": \"" << s.kind << '"'
+           << ", \"activations\": " << s.activations
+           << ", \"context_switches\": " << s.switches
+           << ", \"wall_time_s\": " << sc_profiler_seconds( s.time ) << " }";
+    }
+    os << "\n  ],\n";
+
+    os << "  \"events\": [";
+    for( std::size_t i = 0; i < events.size(); ++i ) {
+        os << ( i ? ",\n" : "\n" )
+           << "    { \"name\": " << sc_profiler_quote( events[i].name, true )
+           << ", \"triggers\": " << events[i].triggers << " }";
+    }
+    os << "\n  ],\n";
+
+    os << "  \"time_steps\": [";
+    for( std::size_t i = 0; i < m_time_steps.size(); ++i ) {
+        os << ( i ? ",\n" : "\n" )
+           << "    { \"time\": \"" << m_time_steps[i].first.to_string() << '"'
+           << ", \"delta_cycles\": " << m_time_steps[i].second << " }";
+    }
+    os << "\n  ]\n}\n";
+}
+
+} // namespace sc_core
+
+#endif // SC_ENABLE_PROFILING
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,200 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_profiler.h - Kernel instrumentation for profiling simulations
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_PROFILER_H_INCLUDED_
+#define SC_PROFILER_H_INCLUDED_
+
+// The instrumentation is only compiled into the library if it is built with
+// SC_ENABLE_PROFILING.  Otherwise the SC_PROFILE_ macros expand to nothing.
+
+#if defined(SC_ENABLE_PROFILING)
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "sysc/kernel/sc_time.h"
+
+namespace sc_core {
+
+class sc_event;
+class sc_process_b;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_profiler
+//
+//  Records per-process activation counts, context switches and wall time,
+//  per-event trigger counts and the number of delta cycles per time step.
+//  A process is activated once per dispatch by the kernel, resuming a
+//  thread after it has been preempted by an immediate thread is not
+//  counted as an activation, but as another context switch to the thread.
+//  The profiler is active if the environment variable SC_PROFILE names the
+//  output file, which is written on sc_stop() or at exit.  Files ending in
+//  ".csv" are written as CSV, all others as JSON.
+//  FOR INTERNAL USE ONLY!
+// ----------------------------------------------------------------------------
+
+class sc_profiler
+{
+public:
+    typedef std::chrono::steady_clock clock;
+
+    // returns the profiler, or 0 if profiling has not been requested
+    static sc_profiler* instance()
+    {
+        if( !m_initialized )
+            initialize();
+        return m_instance_p;
+    }
+
+    // the given process (or the kernel, if 0) starts or resumes running
+    void switch_to( const sc_process_b* process_p );
+
+    // the given process has been dispatched by the kernel
+    void activated( const sc_process_b* process_p );
+
+    // the given thread has been queued to resume after a preemption, its
+    // next dispatch continues the current activation
+    void preempted( const sc_process_b* process_p );
+
+    // a method process has been run by a worker thread for the given time,
+    // its activation has been recorded by the kernel thread
+    void concurrent_run( const sc_process_b* process_p, clock::duration time );
+
+    void process_deleted( const sc_process_b* process_p );
+    void event_triggered( const sc_event* event_p );
+    void event_deleted( const sc_event* event_p );
+    void delta_cycle( const sc_time& now );
+
+    // writes the output file (only once)
+    void write();
+
+private:
+    struct process_stats
+    {
+        process_stats()
+          : kind(), activations(), switches(), time(), resuming() {}
+
+        std::string     name;
+        const char*     kind;
+        sc_dt::uint64   activations;  // dispatches of the process
+        sc_dt::uint64   switches;     // coroutine resumes of a thread
+        clock::duration time;         // wall time spent in the process
+        bool            resuming;     // next dispatch resumes a preemption
+    };
+
+    struct event_stats
+    {
+        event_stats() : triggers() {}
+
+        std::string   name;
+        sc_dt::uint64 triggers;
+    };
+
+    typedef std::unordered_map<const sc_process_b*, process_stats> process_map;
+    typedef std::unordered_map<const sc_event*, event_stats>       event_map;
+
+    explicit sc_profiler( const char* file_name );
+
+    static void initialize();
+    static void write_at_exit();
+
+    process_stats& stats( const sc_process_b* process_p );
+    event_stats& stats( const sc_event* event_p );
+
+    void sorted( std::vector<process_stats>& processes,
+                 std::vector<event_stats>& events ) const;
+
+    void write_csv( std::ostream& os );
+    void write_json( std::ostream& os );
+
+private:
+    static bool                 m_initialized;
+    static sc_profiler*         m_instance_p;
+
+    std::string                 m_file_name;
+    bool                        m_written;
+    std::mutex                  m_mutex;          // for worker threads
+
+    process_map                 m_processes;      // live processes
+    std::vector<process_stats>  m_dead_processes; // deleted processes
+    event_map                   m_events;         // live events
+    std::vector<event_stats>    m_dead_events;    // deleted events
+
+    const sc_process_b*         m_current_p;      // running process or 0
+    clock::time_point           m_current_start;  // when it started
+    clock::duration             m_kernel_time;    // time spent in the kernel
+    clock::time_point           m_start;          // creation of the profiler
+
+    // delta cycles per time step
+    std::vector< std::pair<sc_time, sc_dt::uint64> > m_time_steps;
+};
+
+} // namespace sc_core
+
+// calls a member function of the active profiler
+#define SC_PROFILE_( Call )                                                   \
+    do {                                                                      \
+        if( ::sc_core::sc_profiler* sc_profiler_p_ =                          \
+              ::sc_core::sc_profiler::instance() )                            \
+            sc_profiler_p_->Call;                                             \
+    } while( false )
+
+// executes Stmt and accounts its wall time to the process
+#define SC_PROFILE_RUN_( Process, Stmt )                                      \
+    do {                                                                      \
+        ::sc_core::sc_profiler* sc_profiler_p_ =                              \
+          ::sc_core::sc_profiler::instance();                                 \
+        ::sc_core::sc_profiler::clock::time_point sc_profiler_start_ =        \
+          ::sc_core::sc_profiler::clock::now();                               \
+        Stmt;                                                                 \
+        if( sc_profiler_p_ )                                                  \
+            sc_profiler_p_->concurrent_run( Process,                          \
+              ::sc_core::sc_profiler::clock::now() - sc_profiler_start_ );    \
+    } while( false )
+
+#else // SC_ENABLE_PROFILING
+
+#define SC_PROFILE_( Call )            ((void)0)
+#define SC_PROFILE_RUN_( Process, Stmt ) Stmt
+
+#endif // SC_ENABLE_PROFILING
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_PROFILER_H_INCLUDED_
+// Taf!
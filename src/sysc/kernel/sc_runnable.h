@@ -69,6 +69,8 @@ class SC_API sc_runnable
     inline sc_method_handle pop_method();
     inline sc_thread_handle pop_thread();
 
+    inline void pop_concurrent_methods( std::vector<sc_method_handle>& );
+
   public: // diagnostics:
     void dump() const;
 
@@ -298,6 +298,28 @@ inline sc_method_handle sc_runnable::pop_method()
 
 }
 
+//------------------------------------------------------------------------------
+//"sc_runnable::pop_concurrent_methods"
+//
+// This method moves the method processes at the front of the pop queue that
+// may be evaluated concurrently (see sc_method_process::run_concurrently),
+// up to the first one that may not, to the end of the supplied vector in
+// queue order.
+//     methods = vector to receive the popped methods.
+//------------------------------------------------------------------------------
+inline void
+sc_runnable::pop_concurrent_methods( std::vector<sc_method_handle>& methods )
+{
+    while ( m_methods_pop != SC_NO_METHODS &&
+            m_methods_pop->run_concurrently() )
+    {
+        sc_method_handle method_h = m_methods_pop;
+        m_methods_pop = method_h->next_runnable();
+        method_h->set_next_runnable( 0 );
+        methods.push_back( method_h );
+    }
+}
+
 //------------------------------------------------------------------------------
 //"sc_runnable::pop_thread"
 //
@@ -59,8 +59,14 @@
 #include "sysc/utils/sc_utils_ids.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
 #include <cstring>
+#include <functional>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 // DEBUGGING MACROS:
 //
@@ -209,6 +215,44 @@ sc_notify_time_compare( const void* p1, const void* p2 )
     }
 }
 
+SC_API void
+sc_notify_time_index( void* p, int i )
+{
+    static_cast<sc_event_timed*>( p )->m_heap_index = i;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::remove_timed_event"
+// |
+// | This method removes a pending timed notification from the timed event
+// | queue and releases it. The queue keeps track of the heap position of
+// | each entry, so no cancelled entries are left behind in the queue.
+// |
+// | Arguments:
+// |     et -> timed notification to be removed.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::remove_timed_event( sc_event_timed* et )
+{
+    m_timed_events->remove( et->m_heap_index );
+    delete et;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::update_timed_event"
+// |
+// | This method restores the order of the timed event queue after the
+// | notification time of a queued entry has been changed in place.
+// |
+// | Arguments:
+// |     et -> timed notification with the new notification time.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::update_timed_event( sc_event_timed* et )
+{
+    m_timed_events->update( et->m_heap_index );
+}
+
 
 // +============================================================================
 // | CLASS sc_invoke_method - class to invoke sc_method's to support
@@ -279,6 +323,7 @@ public:
         {
             DEBUG_MSG( DEBUG_NAME, m_method, "invoker executing method" );
 	    csc_p->set_curr_proc( (sc_process_b*)m_method );
+	    SC_PROFILE_( activated( m_method ) );
 	    csc_p->get_active_invokers().push_back((sc_thread_handle)me);
 	    m_method->run_process();
 	    csc_p->set_curr_proc( me );
@@ -293,6 +338,321 @@ public:
     std::vector<sc_process_handle> m_invokers; // list of invoking threads.
 };
 
+// +============================================================================
+// | CLASS sc_method_worker_pool - host threads to evaluate method processes
+// |                               concurrently, see crunch_concurrent_methods.
+// |
+// | The methods of a batch are split into chunks, which are claimed by the
+// | worker threads and the simulator thread alike. Every chunk records its
+// | update requests, deferred kernel calls and error in a place of its own,
+// | so that the outcome does not depend on the scheduling of the host
+// | threads. While a host thread evaluates a method, the thread local
+// | process information makes the method the current process of that thread.
+// +============================================================================
+class sc_method_worker_pool
+{
+  public:
+    explicit sc_method_worker_pool( unsigned int workers );
+    ~sc_method_worker_pool();
+
+    unsigned int size() const
+        { return static_cast<unsigned int>( m_threads.size() + 1 ); }
+
+    std::vector<sc_method_handle>& batch()
+        { return m_batch; }
+
+    sc_report* run( sc_simcontext& simc );
+
+    // for the host thread evaluating a chunk
+    static sc_curr_proc_info& curr_proc_info()
+        { return m_curr_proc_info; }
+    static void defer( const std::function<void()>& call );
+    static void set_error( sc_report* err_p );
+
+  private:
+    struct chunk
+    {
+        chunk() : m_updates(), m_deferred(), m_error(0) {}
+
+        sc_prim_channel_registry::update_buffer m_updates;
+        std::vector< std::function<void()> >    m_deferred;
+        sc_report*                              m_error;
+    };
+
+    // installs the chunk evaluated by the current host thread, and resets
+    // the thread-local state when its evaluation ends, even by an exception
+    struct scoped_chunk
+    {
+        explicit scoped_chunk( chunk& current );
+        ~scoped_chunk();
+    private:
+        scoped_chunk( const scoped_chunk& ) /* = delete */;
+        scoped_chunk& operator=( const scoped_chunk& ) /* = delete */;
+    };
+
+    void run_chunks();
+    void worker();
+
+  private:
+    std::vector<sc_method_handle> m_batch;       // methods to evaluate.
+    std::vector<chunk>            m_chunks;      // per chunk results.
+    std::size_t                   m_chunk_n;     // number of chunks in use.
+    std::size_t                   m_chunk_size;  // methods per chunk.
+    std::atomic<std::size_t>      m_next_chunk;  // next chunk to claim.
+    std::vector<std::thread>      m_threads;     // worker threads.
+    std::mutex                    m_mutex;
+    std::condition_variable       m_start_cv;    // signals a new batch.
+    std::condition_variable       m_done_cv;     // signals idle workers.
+    unsigned int                  m_generation;  // number of batches started.
+    unsigned int                  m_busy_n;      // workers in run_chunks().
+    bool                          m_shutdown;
+
+    static thread_local sc_curr_proc_info m_curr_proc_info; // current process.
+    static thread_local chunk*            m_curr_chunk_p;   // chunk evaluated.
+};
+
+thread_local sc_curr_proc_info     sc_method_worker_pool::m_curr_proc_info;
+thread_local sc_method_worker_pool::chunk*
+                                   sc_method_worker_pool::m_curr_chunk_p = 0;
+
+sc_method_worker_pool::sc_method_worker_pool( unsigned int workers )
+  : m_batch(), m_chunks(), m_chunk_n(0), m_chunk_size(0), m_next_chunk(0)
+  , m_threads(), m_mutex(), m_start_cv(), m_done_cv()
+  , m_generation(0), m_busy_n(0), m_shutdown(false)
+{
+    // the simulator thread is one of the workers
+    for ( unsigned int i = 1; i < workers; ++i ) {
+        m_threads.push_back( std::thread( &sc_method_worker_pool::worker, this ) );
+    }
+}
+
+sc_method_worker_pool::~sc_method_worker_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_shutdown = true;
+    }
+    m_start_cv.notify_all();
+    for ( std::size_t i = 0; i < m_threads.size(); ++i ) {
+        m_threads[i].join();
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_method_worker_pool::run"
+// |
+// | This method evaluates all methods of the current batch and returns once
+// | every worker thread is idle again. Update requests and deferred kernel
+// | calls are then committed in batch order. If a method failed, nothing is
+// | committed and the error of the earliest failing method is returned
+// | instead.
+// +----------------------------------------------------------------------------
+sc_report*
+sc_method_worker_pool::run( sc_simcontext& simc )
+{
+    sc_prim_channel_registry& registry = *simc.m_prim_channel_registry;
+    const std::size_t methods_n = m_batch.size();
+    const std::size_t chunks_n = std::min<std::size_t>( methods_n, 4 * size() );
+
+    m_chunk_size = ( methods_n + chunks_n - 1 ) / chunks_n;
+    m_chunk_n = ( methods_n + m_chunk_size - 1 ) / m_chunk_size;
+    if ( m_chunks.size() < m_chunk_n ) {
+        m_chunks.resize( m_chunk_n );
+    }
+    m_next_chunk.store( 0, std::memory_order_relaxed );
+    registry.defer_updates( true );
+    simc.m_concurrent_evaluation = true;
+
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        ++m_generation;
+        m_busy_n = static_cast<unsigned int>( m_threads.size() );
+    }
+    m_start_cv.notify_all();
+
+    run_chunks();
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        while ( m_busy_n != 0 ) {
+            m_done_cv.wait( lock );
+        }
+    }
+    simc.m_concurrent_evaluation = false;
+    registry.defer_updates( false );
+
+    sc_report* error_p = 0;
+    for ( std::size_t i = 0; i < m_chunk_n; ++i ) {
+        chunk& current = m_chunks[i];
+        if ( !error_p && current.m_error ) {
+            error_p = current.m_error;
+        } else {
+            delete current.m_error;
+        }
+        if ( !error_p ) {
+            registry.commit_updates( current.m_updates );
+            for ( std::size_t j = 0; j < current.m_deferred.size(); ++j ) {
+                current.m_deferred[j]();
+            }
+        } else {
+            registry.discard_updates( current.m_updates );
+        }
+        current.m_updates.clear();
+        current.m_deferred.clear();
+        current.m_error = 0;
+    }
+    m_batch.clear();
+    return error_p;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_method_worker_pool::run_chunks"
+// |
+// | This method claims and evaluates chunks of the current batch until none
+// | is left. It is executed by the worker threads and the simulator thread.
+// | A chunk is abandoned at its first failing method, like a sequential
+// | evaluation would stop there.
+// +----------------------------------------------------------------------------
+void
+sc_method_worker_pool::run_chunks()
+{
+    for (;;)
+    {
+        std::size_t chunk_i = m_next_chunk.fetch_add( 1 );
+        if ( chunk_i >= m_chunk_n ) {
+            break;
+        }
+
+        chunk&      current = m_chunks[chunk_i];
+        std::size_t method_i = chunk_i * m_chunk_size;
+        std::size_t end_i = std::min( method_i + m_chunk_size, m_batch.size() );
+
+        scoped_chunk scope( current );
+        for ( ; method_i < end_i; ++method_i ) {
+            sc_method_handle method_h = m_batch[method_i];
+            bool             ok;
+
+            m_curr_proc_info.process_handle = method_h;
+            m_curr_proc_info.kind = SC_METHOD_PROC_;
+            SC_PROFILE_RUN_( method_h, ok = method_h->run_process() );
+            if ( !ok ) {
+                break;
+            }
+        }
+    }
+}
+
+sc_method_worker_pool::scoped_chunk::scoped_chunk( chunk& current )
+{
+    m_curr_chunk_p = &current;
+    sc_prim_channel_registry::set_update_buffer( &current.m_updates );
+}
+
+sc_method_worker_pool::scoped_chunk::~scoped_chunk()
+{
+    m_curr_proc_info.process_handle = 0;
+    m_curr_proc_info.kind = SC_NO_PROC_;
+    sc_prim_channel_registry::set_update_buffer( 0 );
+    m_curr_chunk_p = 0;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_method_worker_pool::defer"
+// |
+// | This method records a kernel call of the method evaluated by the calling
+// | host thread, to be executed by run() after the batch.
+// +----------------------------------------------------------------------------
+void
+sc_method_worker_pool::defer( const std::function<void()>& call )
+{
+    sc_assert( m_curr_chunk_p != 0 );
+    m_curr_chunk_p->m_deferred.push_back( call );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_method_worker_pool::set_error"
+// |
+// | This method records the error of the method evaluated by the calling
+// | host thread, see sc_method_process::run_process.
+// +----------------------------------------------------------------------------
+void
+sc_method_worker_pool::set_error( sc_report* err_p )
+{
+    sc_assert( m_curr_chunk_p != 0 );
+    delete m_curr_chunk_p->m_error;
+    m_curr_chunk_p->m_error = err_p;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_method_worker_pool::worker"
+// |
+// | This method is the body of the worker threads: it waits for the next
+// | batch to be started, helps evaluating it and reports back when done.
+// +----------------------------------------------------------------------------
+void
+sc_method_worker_pool::worker()
+{
+    unsigned int generation = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            while ( !m_shutdown && generation == m_generation ) {
+                m_start_cv.wait( lock );
+            }
+            if ( m_shutdown ) {
+                return;
+            }
+            generation = m_generation;
+        }
+
+        run_chunks();
+
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            if ( --m_busy_n == 0 ) {
+                m_done_cv.notify_one();
+            }
+        }
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::concurrent_curr_proc_info"
+// |
+// | This method returns the process information of the calling host thread
+// | while methods are evaluated concurrently.
+// +----------------------------------------------------------------------------
+sc_curr_proc_info&
+sc_simcontext::concurrent_curr_proc_info()
+{
+    return sc_method_worker_pool::curr_proc_info();
+}
+
+void
+sc_simcontext::set_concurrent_error( sc_report* err_p )
+{
+    sc_method_worker_pool::set_error( err_p );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::defer_kernel_call"
+// |
+// | This method executes a call that modifies the state of the kernel, e.g.
+// | the dynamic sensitivity of the current method. During a concurrent
+// | evaluation of methods the call is postponed until all methods of the
+// | batch have been evaluated, and the calls of all methods are then
+// | executed by the simulator thread in the order of the batch.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::defer_kernel_call( const std::function<void()>& call )
+{
+    if( m_concurrent_evaluation ) {
+        sc_method_worker_pool::defer( call );
+    } else {
+        call();
+    }
+}
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_simcontext
 //
@@ -328,11 +688,20 @@ sc_simcontext::init()
     else
         m_write_check = SC_SIGNAL_WRITE_CHECK_DEFAULT_;
 
+    const char* parallel_workers = std::getenv("SC_PARALLEL_METHOD_WORKERS");
+    m_parallel_method_workers = (parallel_workers != NULL) ?
+        static_cast<unsigned int>( std::strtoul( parallel_workers, NULL, 10 ) ) : 0;
+    m_method_worker_pool = 0;
+    m_concurrent_evaluation = false;
+
+    m_unnamed_kernel_events = ( std::getenv("SC_UNNAMED_KERNEL_EVENTS") != NULL );
+
     // FINISH INITIALIZATIONS:
 
     reset_curr_proc();
     m_next_proc_id = -1;
-    m_timed_events = new sc_ppq<sc_event_timed*>( 128, sc_notify_time_compare );
+    m_timed_events = new sc_ppq<sc_event_timed*>( 128, sc_notify_time_compare,
+                                                  sc_notify_time_index );
     m_null_event_p = NULL;
     m_something_to_trace = false;
     m_runnable = new sc_runnable;
@@ -367,6 +736,7 @@ sc_simcontext::clean()
     // remove remaining zombie processes
     do_collect_processes();
 
+    delete m_method_worker_pool;
     delete m_stub_registry;
     delete m_method_invoker_p;
     delete m_error;
@@ -375,6 +745,11 @@ sc_simcontext::clean()
     delete m_collectable;
     delete m_runnable;
     delete m_null_event_p;
+    while( !m_timed_events->empty() ) {
+        sc_event_timed* et = m_timed_events->extract_top();
+        et->event()->m_notify_type = sc_event::NONE;
+        delete et;
+    }
     delete m_timed_events;
     delete m_process_table;
     delete m_name_gen;
@@ -413,7 +788,9 @@ sc_simcontext::sc_simcontext() :
     m_in_simulator_control(false), m_end_of_simulation_called(false),
     m_simulation_status(SC_ELABORATION), m_start_of_simulation_called(false),
     m_cor_pkg(0), m_cor(0), m_reset_finder_q(0),
-    m_suspend(0), m_unsuspendable(0)
+    m_suspend(0), m_unsuspendable(0),
+    m_parallel_method_workers(0), m_method_worker_pool(0),
+    m_concurrent_evaluation(false)
 {
     init();
 }
@@ -516,7 +893,14 @@ sc_simcontext::crunch( bool once )
 	    sc_method_handle method_h = pop_runnable_method();
 	    while( method_h != 0 ) {
 		empty_eval_phase = false;
-		if ( !method_h->run_process() )
+		if ( m_parallel_method_workers > 1 && method_h->run_concurrently() )
+		{
+		    if ( !crunch_concurrent_methods( method_h ) )
+		    {
+			goto out;
+		    }
+		}
+		else if ( !method_h->run_process() )
 		{
 		    goto out;
 		}
@@ -534,6 +918,7 @@ sc_simcontext::crunch( bool once )
 
 	    if( thread_h != 0 ) {
 	        empty_eval_phase = false;
+		SC_PROFILE_( activated( thread_h ) );
 		m_cor_pkg->yield( thread_h->m_cor_p );
 	    }
 	    if( m_error ) {
@@ -598,19 +983,12 @@ sc_simcontext::crunch( bool once )
 	// Process delta notifications which will queue processes for
 	// subsequent execution.
 
-        int size = m_delta_events.size();
-	if ( size != 0 )
-	{
-	    sc_event** l_events = &m_delta_events[0];
-	    int i = size - 1;
-	    do {
-		l_events[i]->trigger();
-	    } while( -- i >= 0 );
-	    m_delta_events.clear();
-	}
+	sc_event::trigger_delta_events( m_delta_events );
 
-	if ( !empty_eval_phase )
+	if ( !empty_eval_phase ) {
 		m_delta_count ++;
+		SC_PROFILE_( delta_cycle( m_curr_time ) );
+	}
 
 	if( m_runnable->is_empty() ) {
 	    // no more runnable processes
@@ -635,6 +1013,78 @@ out:
     if( m_error ) throw *m_error; // re-throw propagated error
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::crunch_concurrent_methods"
+// |
+// | This method evaluates the given method process together with the method
+// | processes following it in the pop queue that have been marked with
+// | set_parallel_safe() as well, so the queue order is kept. Such methods may
+// | only communicate by means of channels that use request_update(), and no
+// | two of them may access the same channel within an evaluation phase.
+// | Under these restrictions the outcome is the same as for a sequential
+// | evaluation in queue order: each method is the current process of the host
+// | thread evaluating it, next_trigger() calls take effect after the batch in
+// | queue order (see defer_kernel_call), and the error of the first failing
+// | method is propagated. Reports are issued while the methods run and may
+// | therefore interleave in any order. Event notifications and reports that
+// | stop the simulation are errors, as are update requests of a channel
+// | from methods in different chunks of the batch.
+// |
+// | Small batches are not worth the synchronization with the worker threads
+// | and are executed by the simulator thread right away.
+// |
+// | Arguments:
+// |     first_p = the method popped last, which may run concurrently.
+// | Result is false if an unfielded exception occurred, true if not.
+// +----------------------------------------------------------------------------
+bool
+sc_simcontext::crunch_concurrent_methods( sc_method_handle first_p )
+{
+    static const std::size_t min_batch_size = 64;
+
+    if( m_method_worker_pool &&
+        m_method_worker_pool->size() != m_parallel_method_workers )
+    {
+        delete m_method_worker_pool;
+        m_method_worker_pool = 0;
+    }
+    if( !m_method_worker_pool ) {
+        m_method_worker_pool =
+          new sc_method_worker_pool( m_parallel_method_workers );
+    }
+
+    std::vector<sc_method_handle>& batch = m_method_worker_pool->batch();
+    batch.push_back( first_p );
+    m_runnable->pop_concurrent_methods( batch );
+
+    // the first method has been counted by pop_runnable_method()
+    for( std::size_t i = 1; i < batch.size(); ++i ) {
+        SC_PROFILE_( activated( batch[i] ) );
+    }
+
+    if( batch.size() < min_batch_size )
+    {
+        for( std::size_t i = 0; i < batch.size(); ++i ) {
+            set_curr_proc( batch[i] );
+            if( !batch[i]->run_process() ) {
+                batch.clear();
+                return false;
+            }
+        }
+        batch.clear();
+        return true;
+    }
+
+    reset_curr_proc();
+    sc_report* error_p = m_method_worker_pool->run( *this );
+    if( error_p )
+    {
+        set_error( error_p );
+        return false;
+    }
+    return true;
+}
+
 inline
 void
 sc_simcontext::cycle( const sc_time& t)
@@ -809,14 +1259,7 @@ sc_simcontext::prepare_to_simulate()
 
     // process delta notifications
 
-    if( ( size = m_delta_events.size() ) != 0 ) {
-        sc_event** l_delta_events = &m_delta_events[0];
-        int i = size - 1;
-        do {
-            l_delta_events[i]->trigger();
-        } while( -- i >= 0 );
-        m_delta_events.clear();
-    }
+    sc_event::trigger_delta_events( m_delta_events );
 }
 
 void
@@ -951,9 +1394,8 @@ sc_simcontext::simulate( const sc_time& duration )
 		sc_event_timed* et = m_timed_events->extract_top();
 		sc_event* e = et->event();
 		delete et;
-		if( e != 0 ) {
-		    e->trigger();
-		}
+		SC_PROFILE_( event_triggered( e ) );
+		e->trigger();
 	    } while( m_timed_events->size() &&
 		     m_timed_events->top()->notify_time() == t );
 
@@ -1069,6 +1511,8 @@ sc_simcontext::end()
     m_module_registry->simulation_done();
     SC_DO_STAGE_CALLBACK_(simulation_done); // SC_POST_END_OF_SIMULATION
     m_end_of_simulation_called = true;
+    m_cor_pkg->simulation_done();
+    SC_PROFILE_( write() );
 }
 
 void
@@ -1266,6 +1710,7 @@ sc_simcontext::next_cor()
     }
 
     if( thread_h != 0 ) {
+	SC_PROFILE_( activated( thread_h ) );
 	return thread_h->m_cor_p;
     } else {
 	return m_cor;
@@ -1297,6 +1742,7 @@ void
 sc_simcontext::add_child_event( sc_event* event_ )
 {
     // no check if object_ is already in the set
+    event_->m_child_index = static_cast<int>( m_child_events.size() );
     m_child_events.push_back( event_ );
 }
 
@@ -1304,19 +1750,19 @@ void
 sc_simcontext::add_child_object( sc_object* object_ )
 {
     // no check if object_ is already in the set
+    object_->m_child_index = static_cast<int>( m_child_objects.size() );
     m_child_objects.push_back( object_ );
 }
 
 void
 sc_simcontext::remove_child_event( sc_event* event_ )
 {
-    int size = m_child_events.size();
-    for( int i = 0; i < size; ++ i ) {
-	if( event_ == m_child_events[i] ) {
-	    m_child_events[i] = m_child_events[size - 1];
-	    m_child_events.pop_back();
-	    return;
-	}
+    int i = event_->m_child_index;
+    if( i >= 0 && i < static_cast<int>( m_child_events.size() )
+        && m_child_events[i] == event_ ) {
+        m_child_events[i] = m_child_events.back();
+        m_child_events[i]->m_child_index = i;
+        m_child_events.pop_back();
     }
     // no check if event_ is really in the set
 }
@@ -1324,13 +1770,12 @@ sc_simcontext::remove_child_event( sc_event* event_ )
 void
 sc_simcontext::remove_child_object( sc_object* object_ )
 {
-    int size = m_child_objects.size();
-    for( int i = 0; i < size; ++ i ) {
-	if( object_ == m_child_objects[i] ) {
-	    m_child_objects[i] = m_child_objects[size - 1];
-	    m_child_objects.pop_back();
-	    return;
-	}
+    int i = object_->m_child_index;
+    if( i >= 0 && i < static_cast<int>( m_child_objects.size() )
+        && m_child_objects[i] == object_ ) {
+        m_child_objects[i] = m_child_objects.back();
+        m_child_objects[i]->m_child_index = i;
+        m_child_objects.pop_back();
     }
     // no check if object_ is really in the set
 }
@@ -1375,15 +1820,11 @@ sc_simcontext::is_running() const
 bool
 sc_simcontext::next_time( sc_time& result ) const
 {
-    while( m_timed_events->size()
-           && ( !m_suspend ||  m_unsuspendable )
-         ) {
-	sc_event_timed* et = m_timed_events->top();
-	if( et->event() != 0 ) {
-	    result = et->notify_time();
-	    return true;
-	}
-	delete m_timed_events->extract_top();
+    if( m_timed_events->size()
+        && ( !m_suspend ||  m_unsuspendable )
+      ) {
+	result = m_timed_events->top()->notify_time();
+	return true;
     }
     return false;
 }
@@ -1457,6 +1898,7 @@ sc_simcontext::preempt_with( sc_method_handle method_h )
         DEBUG_MSG( DEBUG_NAME, method_h,
 	           "preempting active method with method" );
 	sc_get_curr_simcontext()->set_curr_proc( (sc_process_b*)method_h );
+	SC_PROFILE_( activated( method_h ) );
 	method_h->run_process();
 	sc_get_curr_simcontext()->set_curr_proc((sc_process_b*)active_method_h);
 	active_method_h->check_for_throws();
@@ -1483,8 +1925,10 @@ sc_simcontext::preempt_with( sc_method_handle method_h )
         DEBUG_MSG( DEBUG_NAME, method_h,
 	           "preempting no active process with method" );
 	sc_get_curr_simcontext()->set_curr_proc( (sc_process_b*)method_h );
+	SC_PROFILE_( activated( method_h ) );
 	method_h->run_process();
 	m_curr_proc_info = caller_info;
+	SC_PROFILE_( switch_to( caller_info.process_handle ) );
     }
 }
 
@@ -1871,6 +2315,46 @@ sc_get_stop_mode()
     return stop_mode;
 }
 
+//------------------------------------------------------------------------------
+//"sc_set_parallel_method_workers"
+//
+// This function sets the number of host threads, including the simulator
+// thread, that evaluate method processes marked with set_parallel_safe().
+// The initial value is taken from the environment variable
+// SC_PARALLEL_METHOD_WORKERS. Values of 0 and 1 disable concurrent evaluation.
+//     workers = number of host threads to use.
+//------------------------------------------------------------------------------
+SC_API void sc_set_parallel_method_workers( unsigned int workers )
+{
+    sc_get_curr_simcontext()->m_parallel_method_workers = workers;
+}
+
+SC_API unsigned int
+sc_get_parallel_method_workers()
+{
+    return sc_get_curr_simcontext()->m_parallel_method_workers;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_unnamed_kernel_events"
+//
+// This function selects whether kernel events created from now on, like the
+// events of signals, clocks and processes, get an implementation-defined
+// name or remain unnamed. The initial value is true if the environment
+// variable SC_UNNAMED_KERNEL_EVENTS is set.
+//     unnamed = true to leave kernel events unnamed.
+//------------------------------------------------------------------------------
+SC_API void sc_set_unnamed_kernel_events( bool unnamed )
+{
+    sc_get_curr_simcontext()->m_unnamed_kernel_events = unnamed;
+}
+
+SC_API bool
+sc_get_unnamed_kernel_events()
+{
+    return sc_get_curr_simcontext()->m_unnamed_kernel_events;
+}
+
 SC_API bool sc_is_unwinding()
 {
     return sc_get_current_process_handle().is_unwinding();
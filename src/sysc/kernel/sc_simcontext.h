@@ -40,6 +40,8 @@
 
 #include "sysc/communication/sc_host_mutex.h"
 
+#include <functional>
+
 #if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
 #pragma warning(push)
 #pragma warning(disable: 4251) // DLL import for std::vector
@@ -73,6 +75,7 @@ class sc_trace_file;
 class sc_runnable;
 class sc_process_host;
 class sc_method_process;
+class sc_method_worker_pool;
 class sc_cthread_process;
 class sc_thread_process;
 class sc_reset_finder;
@@ -99,6 +102,16 @@ enum sc_stop_mode {          // sc_stop modes:
 extern SC_API void sc_set_stop_mode( sc_stop_mode mode );
 extern SC_API sc_stop_mode sc_get_stop_mode();
 
+// number of host threads evaluating method processes marked with
+// set_parallel_safe() concurrently (0 or 1: sequential evaluation)
+extern SC_API void sc_set_parallel_method_workers( unsigned int workers );
+extern SC_API unsigned int sc_get_parallel_method_workers();
+
+// kernel events created from now on are left unnamed, saving the memory of
+// their implementation-defined names
+extern SC_API void sc_set_unnamed_kernel_events( bool unnamed );
+extern SC_API bool sc_get_unnamed_kernel_events();
+
 enum sc_starvation_policy 
 {
     SC_EXIT_ON_STARVATION,
@@ -174,6 +187,7 @@ class SC_API sc_simcontext
     friend class sc_time_tuple;
     friend class sc_clock;
     friend class sc_method_process;
+    friend class sc_method_worker_pool;
     friend class sc_stage_callback_registry;
     friend class sc_port_registry;
     friend class sc_process_b;
@@ -199,6 +213,10 @@ class SC_API sc_simcontext
     friend SC_API void sc_unsuspend_all();
     friend SC_API void sc_unsuspendable();
     friend SC_API void sc_suspendable();
+    friend SC_API void sc_set_parallel_method_workers( unsigned int );
+    friend SC_API unsigned int sc_get_parallel_method_workers();
+    friend SC_API void sc_set_unnamed_kernel_events( bool );
+    friend SC_API bool sc_get_unnamed_kernel_events();
 
     friend SC_API void sc_register_stage_callback(sc_stage_callback_if & cb,
                                                   unsigned int mask);
@@ -290,6 +308,13 @@ public:
     void set_curr_proc( sc_process_b* );
     void reset_curr_proc();
 
+    // true while method processes are evaluated by several host threads,
+    // see sc_set_parallel_method_workers()
+    bool concurrent_evaluation() const;
+    // executes a call that modifies kernel state, which is postponed until
+    // the end of a concurrent evaluation and then made in process order
+    void defer_kernel_call( const std::function<void()>& call );
+
     int next_proc_id();
 
     friend SC_API void    sc_set_time_resolution( double, sc_time_unit );
@@ -340,10 +365,15 @@ private:
     void remove_child_object( sc_object* );
 
     void crunch( bool once=false );
+    bool crunch_concurrent_methods( sc_method_handle first_p );
+    static sc_curr_proc_info& concurrent_curr_proc_info();
+    void set_concurrent_error( sc_report* );
 
     int add_delta_event( sc_event* );
     void remove_delta_event( sc_event* );
     void add_timed_event( sc_event_timed* );
+    void remove_timed_event( sc_event_timed* );
+    void update_timed_event( sc_event_timed* );
 
     void trace_cycle( bool delta_cycle );
 
@@ -447,6 +477,12 @@ private:
     int                         m_suspend;
     int                         m_unsuspendable;
 
+    unsigned int                m_parallel_method_workers;
+    sc_method_worker_pool*      m_method_worker_pool;
+    bool                        m_concurrent_evaluation;
+
+    bool                        m_unnamed_kernel_events;
+
 private:
 
     // disabled
@@ -591,9 +627,18 @@ inline
 sc_curr_proc_handle
 sc_simcontext::get_curr_proc_info()
 {
+    if( m_concurrent_evaluation )
+        return &concurrent_curr_proc_info();
     return &m_curr_proc_info;
 }
 
+inline
+bool
+sc_simcontext::concurrent_evaluation() const
+{
+    return m_concurrent_evaluation;
+}
+
 
 inline
 int
@@ -656,6 +701,10 @@ inline
 void
 sc_simcontext::set_error( sc_report* err )
 {
+    if( m_concurrent_evaluation ) {
+        set_concurrent_error( err );
+        return;
+    }
     delete m_error;
     m_error = err;
 }
@@ -688,6 +737,10 @@ sc_simcontext::add_timed_event( sc_event_timed* et )
 inline sc_process_b*
 sc_simcontext::get_current_writer() const
 {
+    if( m_concurrent_evaluation ) {
+        return m_write_check != SC_SIGNAL_WRITE_CHECK_DISABLE_ ?
+               concurrent_curr_proc_info().process_handle : 0;
+    }
     return m_current_writer;
 }
 
@@ -33,6 +33,7 @@
 #define SC_SIMCONTEXT_INT_H
 
 #include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_profiler.h"
 #include "sysc/kernel/sc_runnable.h"
 #include "sysc/kernel/sc_runnable_int.h"
 
@@ -75,6 +76,7 @@ sc_simcontext::set_curr_proc( sc_process_b* process_h )
     m_curr_proc_info.kind           = process_h->proc_kind();
     m_current_writer =
       (m_write_check != SC_SIGNAL_WRITE_CHECK_DISABLE_) ? process_h : 0;
+    SC_PROFILE_( switch_to( process_h ) );
 }
 
 inline
@@ -85,6 +87,7 @@ sc_simcontext::reset_curr_proc()
     m_curr_proc_info.kind           = SC_NO_PROC_;
     m_current_writer                = 0;
     sc_process_b::m_last_created_process_p = 0;
+    SC_PROFILE_( switch_to( 0 ) );
 }
 
 inline
@@ -157,11 +160,14 @@ sc_simcontext::preempt_with( sc_thread_handle thread_h )
 	    DEBUG_MSG( DEBUG_NAME, invoke_thread_p,
 	        "queueing invocation thread to execute next" );
 	    execute_thread_next(invoke_thread_p);
+	    SC_PROFILE_( preempted( invoke_thread_p ) );
 	}
         DEBUG_MSG( DEBUG_NAME, thread_h, "preempting method with thread" );
 	set_curr_proc( (sc_process_b*)thread_h );
+	SC_PROFILE_( activated( thread_h ) );
 	m_cor_pkg->yield( thread_h->m_cor_p );
 	m_curr_proc_info = caller_info;
+	SC_PROFILE_( switch_to( caller_info.process_handle ) );
         DEBUG_MSG(DEBUG_NAME, thread_h, "back from preempting method w/thread");
 	method_p->check_for_throws();
     }
@@ -179,6 +185,7 @@ sc_simcontext::preempt_with( sc_thread_handle thread_h )
         DEBUG_MSG( DEBUG_NAME, thread_h,
 	           "preempting active thread with thread" );
         execute_thread_next( active_p );
+	SC_PROFILE_( preempted( active_p ) );
 	execute_thread_next( thread_h );
 	active_p->suspend_me();
     }
@@ -193,6 +200,7 @@ sc_simcontext::preempt_with( sc_thread_handle thread_h )
     {
         DEBUG_MSG(DEBUG_NAME,thread_h,"self preemption of active thread");
 	execute_thread_next( thread_h );
+	SC_PROFILE_( preempted( thread_h ) );
 	active_p->suspend_me();
     }
 }
@@ -237,6 +245,7 @@ sc_simcontext::pop_runnable_method()
 	return 0;
     }
     set_curr_proc( (sc_process_b*)method_h );
+    SC_PROFILE_( activated( method_h ) );
     return method_h;
 }
 
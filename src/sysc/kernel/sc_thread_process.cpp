@@ -401,6 +401,8 @@ sc_thread_process::sc_thread_process( const char* name_p, bool free_host,
     if (opt_p) {
         m_dont_init = opt_p->m_dont_initialize;
         if ( opt_p->m_stack_size ) m_stack_size = opt_p->m_stack_size;
+        if ( opt_p->m_parallel_safe )
+            SC_REPORT_WARNING( SC_ID_SET_PARALLEL_SAFE_, name() );
 
         // traverse event sensitivity list
         for (unsigned int i = 0; i < opt_p->m_sensitive_events.size(); i++) {
@@ -454,7 +456,7 @@ sc_thread_process::~sc_thread_process()
     // DESTROY THE COROUTINE FOR THIS THREAD:
 
     if( m_cor_p != 0 ) {
-        m_cor_p->stack_protect( false );
+        // the stack is released (or kept for reuse) by the coroutine
         delete m_cor_p;
         m_cor_p = 0;
     }
@@ -267,6 +267,27 @@ wait( const sc_time& t, const sc_event_and_list& el, sc_simcontext* simc )
 }
 
 
+// applies a next_trigger() call to the current method, after the batch if
+// methods are evaluated concurrently, see sc_simcontext::defer_kernel_call
+
+namespace {
+
+template< typename Call >
+inline void
+method_next_trigger( sc_simcontext* simc, sc_curr_proc_handle cpi, Call call )
+{
+    sc_method_handle method_h =
+        reinterpret_cast<sc_method_handle>( cpi->process_handle );
+    if( simc->concurrent_evaluation() ) {
+        simc->defer_kernel_call( [method_h, call]() { call( method_h ); } );
+    } else {
+        call( method_h );
+    }
+}
+
+} // anonymous namespace
+
+
 // static sensitivity for SC_METHODs
 
 SC_API void
@@ -274,7 +295,8 @@ next_trigger( sc_simcontext* simc )
 {
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->clear_trigger();
+	method_next_trigger( simc, cpi, []( sc_method_handle method_h )
+	    { method_h->clear_trigger(); } );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -289,7 +311,8 @@ next_trigger( const sc_event& e, sc_simcontext* simc )
 {
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( e );
+	method_next_trigger( simc, cpi, [&e]( sc_method_handle method_h )
+	    { method_h->next_trigger( e ); } );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -307,7 +330,8 @@ next_trigger( const sc_event_or_list& el, sc_simcontext* simc )
 
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( el );
+	method_next_trigger( simc, cpi, [&el]( sc_method_handle method_h )
+	    { method_h->next_trigger( el ); } );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -325,7 +349,8 @@ next_trigger( const sc_event_and_list& el, sc_simcontext* simc )
 
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( el );
+	method_next_trigger( simc, cpi, [&el]( sc_method_handle method_h )
+	    { method_h->next_trigger( el ); } );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -337,7 +362,8 @@ next_trigger( const sc_time& t, sc_simcontext* simc )
 {
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t );
+	method_next_trigger( simc, cpi, [t]( sc_method_handle method_h )
+	    { method_h->next_trigger( t ); } );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -349,7 +375,8 @@ next_trigger( const sc_time& t, const sc_event& e, sc_simcontext* simc )
 {
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t, e );
+	method_next_trigger( simc, cpi, [t, &e]( sc_method_handle method_h )
+	    { method_h->next_trigger( t, e ); } );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -367,7 +394,8 @@ next_trigger( const sc_time& t, const sc_event_or_list& el, sc_simcontext* simc)
 
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t, el );
+	method_next_trigger( simc, cpi, [t, &el]( sc_method_handle method_h )
+	    { method_h->next_trigger( t, el ); } );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -385,7 +413,8 @@ next_trigger(const sc_time& t, const sc_event_and_list& el, sc_simcontext* simc)
 
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t, el );
+	method_next_trigger( simc, cpi, [t, &el]( sc_method_handle method_h )
+	    { method_h->next_trigger( t, el ); } );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -86,6 +86,17 @@ void sc_trace_file::delta_cycles(bool)
   /* Intentionally blank */
 }
 
+void sc_trace_file::change_driven(bool)
+{
+  /* Intentionally blank */
+}
+
+sc_trace_changes_ptr
+sc_trace_file::trace_changes(const std::string&, int&)
+{
+    return sc_trace_changes_ptr();
+}
+
 const sc_dt::uint64&
 sc_trace_file::event_trigger_stamp(const sc_event& ev) const
 {
@@ -100,6 +111,7 @@ sc_trace( sc_trace_file* tf,
 {
     if( tf ) {
 	tf->trace( object.read(), name, width );
+	sc_trace_changes_of( tf, object, name );
     }
 }
 
@@ -111,6 +123,7 @@ sc_trace( sc_trace_file* tf,
 {
     if( tf ) {
 	tf->trace( object.read(), name, width );
+	sc_trace_changes_of( tf, object, name );
     }
 }
 
@@ -122,6 +135,7 @@ sc_trace( sc_trace_file* tf,
 {
     if( tf ) {
 	tf->trace( object.read(), name, width );
+	sc_trace_changes_of( tf, object, name );
     }
 }
 
@@ -133,6 +147,7 @@ sc_trace( sc_trace_file* tf,
 {
     if( tf ) {
 	tf->trace( object.read(), name, width );
+	sc_trace_changes_of( tf, object, name );
     }
 }
 
@@ -50,6 +50,8 @@
 #define SC_TRACE_H
 
 #include <cstdio>
+#include <memory>
+#include <vector>
 
 #include "sysc/datatypes/int/sc_nbdefs.h"
 #include "sysc/kernel/sc_time.h"
@@ -74,10 +76,56 @@ namespace sc_dt
 namespace sc_core {
 
 class sc_event;
+class sc_interface;
 class sc_time;
 
 template <class T> class sc_signal_in_if;
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_changes (implementation-defined)
+//
+//  List of changed traces of a trace file in change-driven mode. It is
+//  shared by the trace file and the traced channels, which mark their
+//  traces on each value update.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_trace_changes
+{
+public:
+
+    sc_trace_changes() : m_pending(), m_changed() {}
+
+    // mark the trace with the given index as changed
+    void mark( int index )
+    {
+        if( !m_pending[index] ) {
+            m_pending[index] = true;
+            m_changed.push_back( index );
+        }
+    }
+
+    // number of traces that can be marked
+    void resize( int n )
+        { m_pending.resize( n, false ); }
+
+    // indices of the traces marked since the last call of clear()
+    std::vector<int>& changed()
+        { return m_changed; }
+
+    void clear()
+    {
+        for( std::size_t i = 0; i < m_changed.size(); ++i )
+            m_pending[m_changed[i]] = false;
+        m_changed.clear();
+    }
+
+private:
+    std::vector<bool> m_pending;
+    std::vector<int>  m_changed;
+};
+
+typedef std::shared_ptr<sc_trace_changes> sc_trace_changes_ptr;
+
 // Base class for all kinds of trace files. 
 
 class SC_API sc_trace_file
@@ -157,6 +205,11 @@ public:
     // Also trace transitions between delta cycles if flag is true.
     virtual void delta_cycles( bool flag );
 
+    // Only check traced signals for changes after they have been updated,
+    // instead of comparing all traced values in each cycle.
+    // (For formats not supporting this, it does nothing)
+    virtual void change_driven( bool flag );
+
     // Set time unit.
     virtual void set_time_unit( double v, sc_time_unit tu )=0;
 
@@ -165,6 +218,14 @@ protected:
     // Write trace info for cycle
     virtual void cycle( bool delta_cycle ) = 0;
 
+    // Change list and index of the last trace added as `name', if it
+    // can be marked by its channel in change-driven mode.
+    virtual sc_trace_changes_ptr trace_changes( const std::string& name,
+                                                int& index );
+    friend SC_API void sc_trace_changes_of( sc_trace_file*,
+                                            const sc_interface&,
+                                            const std::string& );
+
     // Helper for event tracing
     const sc_dt::uint64& event_trigger_stamp( const sc_event& event ) const;
 
@@ -259,6 +320,13 @@ DECL_TRACE_FUNC_A( sc_dt::sc_fxnum_fast )
 #undef DECL_TRACE_FUNC_B
 
 
+// Let the channel of a traced signal report its value changes to the
+// trace just added as `name' (for change-driven tracing).
+
+extern SC_API void sc_trace_changes_of( sc_trace_file* tf,
+                                        const sc_interface& object,
+                                        const std::string& name );
+
 template <class T> 
 inline
 void
@@ -267,6 +335,7 @@ sc_trace( sc_trace_file* tf,
 	  const std::string& name )
 {
     sc_trace( tf, object.read(), name );
+    sc_trace_changes_of( tf, object, name );
 }
 
 template< class T >
@@ -277,6 +346,7 @@ sc_trace( sc_trace_file* tf,
 	  const char* name )
 {
     sc_trace( tf, object.read(), name );
+    sc_trace_changes_of( tf, object, name );
 }
 
 
@@ -337,6 +407,17 @@ sc_trace_delta_cycles( sc_trace_file* tf, bool on = true )
 }
 
 
+// Turn on/off change-driven tracing on trace file `tf'.
+// Has to be done before any signal is traced.
+
+inline
+SC_API void
+sc_trace_change_driven( sc_trace_file* tf, bool on = true )
+{
+    if( tf ) tf->change_driven( on );
+}
+
+
 // Output a comment to the trace file
 
 inline
@@ -356,6 +437,17 @@ SC_API void tprintf( sc_trace_file* tf,  const char* format, ... );
 extern SC_API sc_trace_file *sc_create_vcd_trace_file(const char* name);
 extern SC_API void sc_close_vcd_trace_file( sc_trace_file* tf );
 
+// Create gzip compressed VCD file (name.vcd.gz), closed with
+// sc_close_vcd_trace_file
+extern SC_API sc_trace_file *sc_create_vcd_gz_trace_file(const char* name);
+
+
+// ----------------------------------------------------------------------------
+// Create VCB file (name.vcb), a VCD-equivalent trace in value change blocks
+// with a per-signal layout and a time index, see sc_vcb_trace.h
+extern SC_API sc_trace_file *sc_create_vcb_trace_file(const char* name);
+extern SC_API void sc_close_vcb_trace_file( sc_trace_file* tf );
+
 
 // ----------------------------------------------------------------------------
 // Create WIF file
@@ -0,0 +1,348 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_trace_buffer.cpp - Buffered output of trace files
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "sysc/tracing/sc_trace_buffer.h"
+#include "sysc/tracing/sc_trace_gzip.h"
+#include "sysc/utils/sc_report.h" // sc_assert
+
+namespace sc_core {
+
+// size of each output buffer
+static const std::size_t sc_trace_buffer_size = 1 << 20;
+
+// write a filled buffer, compressed if a compressor is given
+static void
+sc_trace_buffer_write( std::FILE* fp, sc_trace_gzip* gzip
+                     , const char* data, std::size_t size )
+{
+    if( gzip )
+        gzip->write_member( fp, data, size );
+    else
+        std::fwrite( data, 1, size, fp );
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_buffer_writer
+//
+//  Background thread writing filled buffers to the file.
+// ----------------------------------------------------------------------------
+
+class sc_trace_buffer_writer
+{
+public:
+
+    sc_trace_buffer_writer( std::FILE* fp, sc_trace_gzip* gzip )
+      : m_fp( fp ), m_gzip( gzip ), m_data( 0 ), m_size( 0 ), m_stop( false )
+      , m_mutex(), m_cond(), m_thread()
+    {
+        m_thread = std::thread( &sc_trace_buffer_writer::run, this );
+    }
+
+    ~sc_trace_buffer_writer()
+    {
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_stop = true;
+        }
+        m_cond.notify_all();
+        m_thread.join();
+    }
+
+    // hand over a buffer, after the previous one has been written
+    void write( const char* data, std::size_t size )
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_cond.wait( lock, [this]{ return m_data == 0; } );
+        m_data = data;
+        m_size = size;
+        m_cond.notify_all();
+    }
+
+    // wait until all handed over data has been written
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_cond.wait( lock, [this]{ return m_data == 0; } );
+    }
+
+private:
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        while( true ) {
+            m_cond.wait( lock, [this]{ return m_data != 0 || m_stop; } );
+            if( m_data == 0 )
+                return; // stopped
+
+            const char* data = m_data;
+            std::size_t size = m_size;
+            lock.unlock();
+            sc_trace_buffer_write( m_fp, m_gzip, data, size );
+            lock.lock();
+
+            m_data = 0;
+            m_cond.notify_all();
+        }
+    }
+
+private:
+    std::FILE*              m_fp;
+    sc_trace_gzip*          m_gzip;
+    const char*             m_data;  // buffer to write, 0 if idle
+    std::size_t             m_size;
+    bool                    m_stop;
+    std::mutex              m_mutex;
+    std::condition_variable m_cond;
+    std::thread             m_thread;
+};
+
+// ----------------------------------------------------------------------------
+//  open buffers are written out at exit, like the stdio buffers
+//  (trace files are often not closed explicitly)
+// ----------------------------------------------------------------------------
+
+static std::vector<sc_trace_buffer*>&
+sc_trace_buffers_open()
+{
+    // never destroyed, to be usable until the atexit handler has run
+    static std::vector<sc_trace_buffer*>* buffers = 0;
+    if( !buffers ) {
+        buffers = new std::vector<sc_trace_buffer*>;
+        std::atexit( &sc_trace_buffer::flush_all );
+    }
+    return *buffers;
+}
+
+void
+sc_trace_buffer::flush_all()
+{
+    std::vector<sc_trace_buffer*>& buffers = sc_trace_buffers_open();
+    for( std::size_t i = 0; i < buffers.size(); ++i )
+        buffers[i]->flush();
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_buffer
+// ----------------------------------------------------------------------------
+
+sc_trace_buffer::sc_trace_buffer()
+  : m_fp(0), m_buf(), m_pos(0), m_end(0), m_curr(0), m_gzip(0), m_writer(0)
+  , m_memory(false), m_data()
+{}
+
+sc_trace_buffer::~sc_trace_buffer()
+{
+    close();
+    delete m_gzip;
+    delete[] m_buf[0];
+    delete[] m_buf[1];
+}
+
+void
+sc_trace_buffer::open( std::FILE* fp, bool async_write, bool compressed )
+{
+    sc_assert( fp && !m_fp );
+    m_fp = fp;
+    if( compressed && !m_gzip )
+        m_gzip = new sc_trace_gzip;
+    if( async_write )
+        m_writer = new sc_trace_buffer_writer( m_fp, m_gzip );
+    // the buffers are allocated by the first write_out(), so that files
+    // writing directly to fp (e.g. WIF) don't pay for them
+    m_curr = 0;
+    m_pos  = m_end = m_buf[0];
+    sc_trace_buffers_open().push_back( this );
+}
+
+void
+sc_trace_buffer::open_memory()
+{
+    sc_assert( !m_fp );
+    m_memory = true;
+    m_curr = 0;
+    m_pos  = m_end = m_buf[0];
+}
+
+void
+sc_trace_buffer::take( std::string& s )
+{
+    sc_assert( m_memory );
+    s.swap( m_data );
+    if( m_pos != m_buf[m_curr] )
+        s.append( m_buf[m_curr], m_pos - m_buf[m_curr] );
+    m_data.clear();
+    m_pos = m_buf[m_curr];
+}
+
+void
+sc_trace_buffer::close()
+{
+    if( !m_fp )
+        return;
+    flush();
+    if( m_gzip ) // usually called from a destructor
+        m_gzip->report_error( /* as_warning = */ true );
+    std::vector<sc_trace_buffer*>& buffers = sc_trace_buffers_open();
+    buffers.erase( std::remove( buffers.begin(), buffers.end(), this )
+                 , buffers.end() );
+    delete m_writer;
+    m_writer = 0;
+    m_fp = 0;
+    m_pos = m_end = 0;
+}
+
+void
+sc_trace_buffer::flush()
+{
+    if( !m_fp )
+        return;
+    if( m_pos != m_buf[m_curr] )
+        write_out();
+    if( m_writer )
+        m_writer->wait();
+    std::fflush( m_fp );
+}
+
+void
+sc_trace_buffer::overflow()
+{
+    if( m_gzip ) {
+        // report a failure to compress an earlier buffer, once the
+        // writer is done with it
+        if( m_writer )
+            m_writer->wait();
+        m_gzip->report_error();
+    }
+    write_out();
+}
+
+void
+sc_trace_buffer::write_out()
+{
+    sc_assert( m_fp || m_memory );
+    char* begin = m_buf[m_curr];
+    std::size_t size = m_pos - begin;
+
+    if( size != 0 ) {
+        if( m_memory ) {
+            m_data.append( begin, size );
+        } else if( m_writer ) {
+            // continue in the other buffer while this one is written
+            m_writer->write( begin, size );
+            m_curr = 1 - m_curr;
+        } else {
+            sc_trace_buffer_write( m_fp, m_gzip, begin, size );
+        }
+    }
+    if( !m_buf[m_curr] )
+        m_buf[m_curr] = new char[sc_trace_buffer_size];
+    m_pos = m_buf[m_curr];
+    m_end = m_pos + sc_trace_buffer_size;
+}
+
+void
+sc_trace_buffer::block_boundary()
+{
+    // start a new block, once the current one is reasonably large
+    if( m_gzip && std::size_t( m_pos - m_buf[m_curr] ) >= sc_trace_buffer_size / 2 )
+        overflow();
+}
+
+void
+sc_trace_buffer::put( const char* s, std::size_t n )
+{
+    while( n > 0 ) {
+        if( m_pos == m_end ) overflow();
+        std::size_t chunk = m_end - m_pos;
+        if( chunk > n ) chunk = n;
+        std::memcpy( m_pos, s, chunk );
+        m_pos += chunk;
+        s += chunk;
+        n -= chunk;
+    }
+}
+
+void
+sc_trace_buffer::put_decimal( sc_dt::uint64 value, int width )
+{
+    char digits[32];
+    char* p = digits + sizeof(digits);
+    do {
+        *--p = static_cast<char>( '0' + value % 10 );
+        value /= 10;
+    } while( value != 0 );
+
+    while( digits + sizeof(digits) - p < width && p != digits )
+        *--p = '0';
+
+    put( p, digits + sizeof(digits) - p );
+}
+
+void
+sc_trace_buffer::printf( const char* format, ... )
+{
+    va_list ap;
+
+    va_start( ap, format );
+    int n = std::vsnprintf( m_pos, m_end - m_pos, format, ap );
+    va_end( ap );
+
+    if( n < 0 )
+        return;
+    if( n < m_end - m_pos ) {
+        m_pos += n;
+        return;
+    }
+
+    // didn't fit, format into a temporary buffer instead
+    std::vector<char> tmp( n + 1 );
+    va_start( ap, format );
+    std::vsnprintf( tmp.data(), tmp.size(), format, ap );
+    va_end( ap );
+    put( tmp.data(), n );
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,146 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_trace_buffer.h - Buffered output of trace files
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_TRACE_BUFFER_H_INCLUDED_
+#define SC_TRACE_BUFFER_H_INCLUDED_
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+
+namespace sc_core {
+
+class sc_trace_buffer_writer;  // defined in sc_trace_buffer.cpp
+class sc_trace_gzip;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_buffer (implementation-defined)
+//
+//  Output buffer of a trace file.  Values are formatted directly into a
+//  large user-space buffer, which is written to the file when it is full.
+//  The buffer is only allocated once something is written through it.
+//  Optionally, the writing is done by a background thread, so that the
+//  simulation only waits for the file if the writer falls behind.
+//  Compressed buffers are written as independent gzip members, see
+//  sc_trace_gzip.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_trace_buffer
+{
+public:
+
+    sc_trace_buffer();
+
+    // writes out the remaining data, see close()
+    ~sc_trace_buffer();
+
+    // start buffering the output to an opened file
+    void open( std::FILE* fp, bool async_write = false, bool compressed = false );
+
+    // collect the output in memory instead of a file, see take()
+    void open_memory();
+
+    // move the output collected in memory to s
+    void take( std::string& s );
+
+    // write out the remaining data and stop the writer thread
+    // (the file itself is not closed)
+    void close();
+
+    // write out the buffered data and flush the file
+    void flush();
+
+    // position at which a new compressed block may start (e.g. a time stamp)
+    void block_boundary();
+
+    bool is_open() const
+        { return m_fp != 0; }
+
+    // write out the buffered data of all open buffers (called at exit)
+    static void flush_all();
+
+    void put( char c )
+    {
+        if( m_pos == m_end ) overflow();
+        *m_pos++ = c;
+    }
+
+    void put( const char* s, std::size_t n );
+
+    void put( const char* s )
+        { put( s, std::strlen( s ) ); }
+
+    void put( const std::string& s )
+        { put( s.data(), s.size() ); }
+
+    // decimal representation, zero padded to at least the given width
+    void put_decimal( sc_dt::uint64 value, int width = 0 );
+
+    // formatted output, for everything less frequent than value changes
+    void printf( const char* format, ... );
+
+private:
+
+    // report earlier write failures and write out the buffer
+    void overflow();
+
+    // hand the filled part of the buffer to the file or the writer thread
+    void write_out();
+
+private:
+
+    std::FILE*              m_fp;
+    char*                   m_buf[2];  // second one only used asynchronously
+    char*                   m_pos;     // next free position in current buffer
+    char*                   m_end;     // end of current buffer
+    int                     m_curr;    // index of current buffer
+    sc_trace_gzip*          m_gzip;    // compressor, if any
+    sc_trace_buffer_writer* m_writer;  // background writer, if any
+    bool                    m_memory;  // collecting in memory?
+    std::string             m_data;    // data collected in memory
+
+private: // disabled
+    sc_trace_buffer( const sc_trace_buffer& ) /* = delete */;
+    sc_trace_buffer& operator=( const sc_trace_buffer& ) /* = delete */;
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_TRACE_BUFFER_H_INCLUDED_
+// Taf!
@@ -58,15 +58,21 @@ namespace sc_core {
 bool sc_trace_file_base::tracing_initialized_ = false;
 
 
-sc_trace_file_base::sc_trace_file_base( const char* name, const char* extension )
+sc_trace_file_base::sc_trace_file_base( const char* name, const char* extension,
+                                        bool compressed, bool async_write,
+                                        bool binary )
   : sc_trace_file()
   , fp(0)
+  , out()
   , trace_unit_fs()
   , kernel_unit_fs()
   , timescale_set_by_user(false)
   , filename_()
   , initialized_(false)
   , trace_delta_cycles_(false)
+  , compressed_(compressed)
+  , async_write_(async_write)
+  , binary_(binary)
 {
     if( !name || !*name ) {
         SC_REPORT_ERROR( SC_ID_TRACING_FOPEN_FAILED_, "no name given" );
@@ -85,6 +91,7 @@ sc_trace_file_base::~sc_trace_file_base()
     if( !is_initialized() )
         SC_REPORT_WARNING( SC_ID_TRACING_CLOSE_EMPTY_FILE_, filename() );
 
+    out.close();
     if( fp )
         fclose(fp);
 
@@ -163,11 +170,12 @@ void
 sc_trace_file_base::open_fp()
 {
     sc_assert( !fp && filename() );
-    fp = fopen( filename(), "w" );
+    fp = fopen( filename(), ( compressed_ || binary_ ) ? "wb" : "w" );
     if( !fp ) {
         SC_REPORT_ERROR( SC_ID_TRACING_FOPEN_FAILED_, filename() );
         sc_abort(); // can't recover from here
     }
+    out.open( fp, async_write_, compressed_ );
 }
 
 void
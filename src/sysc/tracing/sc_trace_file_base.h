@@ -44,6 +44,7 @@
 
 #  include "sysc/kernel/sc_stage_callback_if.h"
 #include "sysc/tracing/sc_trace.h"
+#include "sysc/tracing/sc_trace_buffer.h"
 #include "sysc/tracing/sc_tracing_ids.h"
 
 #if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
@@ -74,7 +75,12 @@ public:
     virtual void set_time_unit( double v, sc_time_unit tu);
 
 protected:
-    sc_trace_file_base( const char* name, const char* extension );
+    // a compressed file is written in gzip format, with async_write
+    // filled output buffers are written by a background thread, a binary
+    // file is opened without newline translation
+    sc_trace_file_base( const char* name, const char* extension,
+                        bool compressed = false, bool async_write = false,
+                        bool binary = false );
 
     // returns true, if trace file is already initialized
     bool is_initialized() const;
@@ -110,6 +116,7 @@ private:
 
 protected:
     FILE* fp;                          // pointer to the trace file
+    sc_trace_buffer out;               // buffered output to fp
 
     unit_type   trace_unit_fs;         // tracefile timescale unit in femtoseconds
     unit_type   kernel_unit_fs;        // kernel timescale unit in femtoseconds
@@ -119,6 +126,9 @@ private:
     std::string filename_;             // name of the file (for reporting)
     bool        initialized_;          // tracing started?
     bool        trace_delta_cycles_;   // also trace delta transitions?
+    bool        compressed_;           // write gzip compressed output?
+    bool        async_write_;          // write output in the background?
+    bool        binary_;               // open the file in binary mode?
 
     static bool tracing_initialized_;  // shared setup of tracing implementation
 
@@ -0,0 +1,244 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_trace_gzip.cpp - Compression of trace file output into gzip members
+
+  The members are compressed by zlib at its fastest level, which already
+  shrinks the highly repetitive text of value change dumps considerably
+  and keeps up with the simulation.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/tracing/sc_trace_gzip.h"
+#include "sysc/tracing/sc_tracing_ids.h"
+#include "sysc/utils/sc_report.h"
+
+#ifdef SC_ENABLE_TRACE_COMPRESSION
+#include <algorithm>
+#include <sstream>
+#include <zlib.h>
+#endif
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_gzip
+// ----------------------------------------------------------------------------
+
+#ifdef SC_ENABLE_TRACE_COMPRESSION
+
+static std::string
+sc_gzip_error( const char* call, int ret, const z_stream* stream )
+{
+    std::stringstream msg;
+    msg << call << "() returned " << ret;
+    if( stream && stream->msg )
+        msg << " (" << stream->msg << ")";
+    return msg.str();
+}
+
+// write data as a gzip member of stored (uncompressed) deflate blocks
+static void
+sc_gzip_write_stored( std::FILE* fp, const char* data, std::size_t size )
+{
+    // magic, deflate, no flags, no time stamp, no extra flags, unknown OS
+    static const unsigned char header[10] =
+        { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff };
+    std::fwrite( header, 1, sizeof(header), fp );
+
+    uLong crc = crc32( 0L, Z_NULL, 0 );
+    unsigned long isize = static_cast<unsigned long>( size );
+    do {
+        std::size_t n = std::min<std::size_t>( size, 0xffff );
+        unsigned char block[5] = {
+            static_cast<unsigned char>( n == size ),  // BFINAL, BTYPE 00
+            static_cast<unsigned char>( n & 0xff ),
+            static_cast<unsigned char>( n >> 8 ),
+            static_cast<unsigned char>( ~n & 0xff ),
+            static_cast<unsigned char>( ( ~n >> 8 ) & 0xff ) };
+        std::fwrite( block, 1, sizeof(block), fp );
+        std::fwrite( data, 1, n, fp );
+        crc = crc32( crc, reinterpret_cast<const Bytef*>( data )
+                   , static_cast<uInt>( n ) );
+        data += n;
+        size -= n;
+    } while( size > 0 );
+
+    unsigned char trailer[8];
+    for( int i = 0; i < 4; ++i ) {
+        trailer[i]     = static_cast<unsigned char>( crc >> ( 8 * i ) );
+        trailer[4 + i] = static_cast<unsigned char>( isize >> ( 8 * i ) );
+    }
+    std::fwrite( trailer, 1, sizeof(trailer), fp );
+}
+
+bool
+sc_trace_gzip::available()
+{
+    return true;
+}
+
+bool
+sc_trace_gzip::compress( const char* data, std::size_t size
+                       , std::string& compressed )
+{
+    uLongf len = compressBound( static_cast<uLong>( size ) );
+    compressed.resize( len );
+    int ret = compress2( reinterpret_cast<Bytef*>( &compressed[0] ), &len
+                       , reinterpret_cast<const Bytef*>( data )
+                       , static_cast<uLong>( size ), Z_BEST_SPEED );
+    if( ret != Z_OK || len >= size )
+        return false;
+    compressed.resize( len );
+    return true;
+}
+
+bool
+sc_trace_gzip::uncompress( const char* data, std::size_t size
+                         , std::string& uncompressed, std::size_t orig_size )
+{
+    uLongf len = static_cast<uLongf>( orig_size );
+    uncompressed.resize( orig_size );
+    int ret = ::uncompress( reinterpret_cast<Bytef*>( &uncompressed[0] ), &len
+                          , reinterpret_cast<const Bytef*>( data )
+                          , static_cast<uLong>( size ) );
+    return ret == Z_OK && len == orig_size;
+}
+
+sc_trace_gzip::sc_trace_gzip()
+  : m_stream( new z_stream() ), m_out(), m_error()
+{
+    // window bits + 16: gzip header and trailer
+    int ret = deflateInit2( m_stream, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8,
+                            Z_DEFAULT_STRATEGY );
+    if( ret != Z_OK ) {
+        // the output is stored uncompressed, see write_member()
+        delete m_stream;
+        m_stream = 0;
+        SC_REPORT_ERROR( SC_ID_TRACING_COMPRESSION_FAILED_
+                       , sc_gzip_error( "deflateInit2", ret, 0 ).c_str() );
+    }
+}
+
+sc_trace_gzip::~sc_trace_gzip()
+{
+    if( m_stream ) {
+        deflateEnd( m_stream );
+        delete m_stream;
+    }
+}
+
+void
+sc_trace_gzip::write_member( std::FILE* fp, const char* data, std::size_t size )
+{
+    if( size == 0 )
+        return;
+    if( !m_stream ) { // compressor failed to initialize
+        sc_gzip_write_stored( fp, data, size );
+        return;
+    }
+
+    m_out.resize( deflateBound( m_stream, static_cast<uLong>( size ) ) );
+    m_stream->next_in   = reinterpret_cast<Bytef*>( const_cast<char*>( data ) );
+    m_stream->avail_in  = static_cast<uInt>( size );
+    m_stream->next_out  = m_out.data();
+    m_stream->avail_out = static_cast<uInt>( m_out.size() );
+
+    int ret = deflate( m_stream, Z_FINISH );
+    if( ret == Z_STREAM_END ) {
+        std::fwrite( m_out.data(), 1, m_out.size() - m_stream->avail_out, fp );
+    } else {
+        // keep the data in a member that doesn't need the compressor
+        if( m_error.empty() )
+            m_error = sc_gzip_error( "deflate", ret, m_stream )
+                    + ", output written uncompressed";
+        sc_gzip_write_stored( fp, data, size );
+    }
+    deflateReset( m_stream );
+}
+
+void
+sc_trace_gzip::report_error( bool as_warning )
+{
+    if( m_error.empty() )
+        return;
+    std::string msg;
+    msg.swap( m_error );
+    if( as_warning )
+        SC_REPORT_WARNING( SC_ID_TRACING_COMPRESSION_FAILED_, msg.c_str() );
+    else
+        SC_REPORT_ERROR( SC_ID_TRACING_COMPRESSION_FAILED_, msg.c_str() );
+}
+
+#else // SC_ENABLE_TRACE_COMPRESSION
+
+bool
+sc_trace_gzip::available()
+{
+    return false;
+}
+
+// not used, see available(): the data is written as is
+
+bool
+sc_trace_gzip::compress( const char*, std::size_t, std::string& )
+{
+    return false;
+}
+
+bool
+sc_trace_gzip::uncompress( const char*, std::size_t, std::string&, std::size_t )
+{
+    return false;
+}
+
+sc_trace_gzip::sc_trace_gzip()
+  : m_stream( 0 ), m_out(), m_error()
+{}
+
+sc_trace_gzip::~sc_trace_gzip()
+{}
+
+void
+sc_trace_gzip::write_member( std::FILE* fp, const char* data, std::size_t size )
+{
+    std::fwrite( data, 1, size, fp );
+}
+
+void
+sc_trace_gzip::report_error( bool )
+{}
+
+#endif // SC_ENABLE_TRACE_COMPRESSION
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
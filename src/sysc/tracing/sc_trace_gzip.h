@@ -0,0 +1,112 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_trace_gzip.h - Compression of trace file output into gzip members
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_TRACE_GZIP_H_INCLUDED_
+#define SC_TRACE_GZIP_H_INCLUDED_
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "sysc/kernel/sc_cmnhdr.h"
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::vector
+#endif
+
+struct z_stream_s; // zlib
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_gzip (implementation-defined)
+//
+//  Writes each chunk of trace output as a complete gzip (RFC 1952) member,
+//  compressed by zlib.  Concatenated members form a valid gzip file,
+//  readable by the usual tools (gzip, zcat, waveform viewers), and each
+//  member can be decompressed on its own.  Only available if the library
+//  has been built with SC_ENABLE_TRACE_COMPRESSION.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_trace_gzip
+{
+public:
+
+    // false, if the library has been built without zlib
+    static bool available();
+
+    // compress data into a zlib (RFC 1950) stream, false if zlib is not
+    // available, compression failed or didn't make the data smaller
+    static bool compress( const char* data, std::size_t size
+                        , std::string& compressed );
+
+    // inverse of compress(), size is the size of the original data
+    static bool uncompress( const char* data, std::size_t size
+                          , std::string& uncompressed, std::size_t orig_size );
+
+    sc_trace_gzip();
+    ~sc_trace_gzip();
+
+    // compress data as one gzip member and write it to the file
+    // (may run in a background thread, failures are kept for report_error)
+    // data that fails to compress is written as a stored (uncompressed)
+    // member instead, so that nothing is lost
+    void write_member( std::FILE* fp, const char* data, std::size_t size );
+
+    // report a failure of write_member(), if any, from the simulation
+    // thread (as a warning, where an error can't be thrown)
+    void report_error( bool as_warning = false );
+
+private:
+
+    z_stream_s*                m_stream;  // zlib compressor state
+    std::vector<unsigned char> m_out;     // compressed output
+    std::string                m_error;   // failure of write_member()
+
+private: // disabled
+    sc_trace_gzip( const sc_trace_gzip& ) /* = delete */;
+    sc_trace_gzip& operator=( const sc_trace_gzip& ) /* = delete */;
+};
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_TRACE_GZIP_H_INCLUDED_
+// Taf!
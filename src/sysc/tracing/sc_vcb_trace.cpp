@@ -0,0 +1,284 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_vcb_trace.cpp - Implementation of VCB tracing, see sc_vcb_trace.h.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include <cstring>
+
+#include "sysc/kernel/sc_ver.h"
+#include "sysc/tracing/sc_vcb_trace.h"
+#include "sysc/tracing/sc_trace_gzip.h"
+
+namespace sc_core {
+
+// size of the changes collected before a block is written
+static const std::size_t vcb_block_size = 1 << 20;
+
+// encode value as varint into buf (at least 10 bytes), returns its length
+static std::size_t
+vcb_varint( char* buf, sc_dt::uint64 value )
+{
+    char* p = buf;
+    while( value >= 0x80 ) {
+        *p++ = static_cast<char>( ( value & 0x7f ) | 0x80 );
+        value >>= 7;
+    }
+    *p++ = static_cast<char>( value );
+    return p - buf;
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : vcb_trace_file
+// ----------------------------------------------------------------------------
+
+vcb_trace_file::vcb_trace_file(const char* name)
+  : vcd_trace_file( name, "vcb", false, /* binary = */ true )
+  , m_offset(0)
+  , m_times()
+  , m_chunks()
+  , m_last_change()
+  , m_block_size(0)
+  , m_index()
+  , m_scratch()
+  , m_value()
+  , m_compressed()
+{
+    m_scratch.open_memory();
+}
+
+vcb_trace_file::~vcb_trace_file()
+{
+    if (!is_initialized())
+        return;
+
+    // the end time, as written by the VCD trace file
+    unit_type now_units_high, now_units_low;
+    if (get_time_stamp(now_units_high, now_units_low)) {
+        print_time_stamp(now_units_high, now_units_low);
+        previous_time_units_high = now_units_high;
+        previous_time_units_low  = now_units_low;
+    }
+
+    write_block();
+    write_index();
+}
+
+void
+vcb_trace_file::write_comment(const std::string&)
+{}
+
+void
+vcb_trace_file::do_initialize()
+{
+    put_bytes("SCVCB01\n", 8);
+    put_varint(trace_unit_fs);
+    put_string(localtime_string());
+    put_string(sc_version());
+
+    put_varint(traces.size());
+    std::string name;
+    vcd_enum type;
+    int width;
+    for (int i = 0; i < (int)traces.size(); i++) {
+        trace_declaration(i, name, type, width);
+        put_string(name);
+        char type_byte = static_cast<char>(type);
+        put_bytes(&type_byte, 1);
+        put_varint(width < 0 ? 0 : width);
+    }
+
+    m_chunks.resize(traces.size());
+    m_last_change.resize(traces.size());
+
+    // all initial values at the first time stamp
+    timestamp_in_trace_units(previous_time_units_high, previous_time_units_low);
+    print_time_stamp(previous_time_units_high, previous_time_units_low);
+    for (int i = 0; i < (int)traces.size(); i++)
+        print_value(i);
+
+    initialize_changes();
+}
+
+void
+vcb_trace_file::print_time_stamp(unit_type now_units_high,
+                                 unit_type now_units_low)
+{
+    sc_dt::uint64 now = now_units_high;
+    if (has_low_units()) {
+        for (int i = 0; i < low_units_len(); i++)
+            now *= 10;
+        now += now_units_low;
+    }
+
+    // blocks start at a time stamp
+    if (m_block_size >= vcb_block_size)
+        write_block();
+
+    if (m_times.empty() || m_times.back() != now)
+        m_times.push_back(now);
+}
+
+void
+vcb_trace_file::print_value(int index)
+{
+    trace_value(index, m_scratch, m_value);
+
+    std::string& chunk = m_chunks[index];
+    std::size_t  now = m_times.size() - 1;
+    std::size_t  old_size = chunk.size();
+
+    char buf[20];
+    std::size_t len = vcb_varint(buf, now - m_last_change[index]);
+    len += vcb_varint(buf + len, m_value.size());
+    chunk.append(buf, len);
+    chunk.append(m_value);
+
+    m_last_change[index] = now;
+    m_block_size += chunk.size() - old_size;
+}
+
+void
+vcb_trace_file::print_values_end()
+{}
+
+void
+vcb_trace_file::put_bytes(const char* data, std::size_t size)
+{
+    out.put(data, size);
+    m_offset += size;
+}
+
+void
+vcb_trace_file::put_varint(sc_dt::uint64 value)
+{
+    char buf[10];
+    put_bytes(buf, vcb_varint(buf, value));
+}
+
+void
+vcb_trace_file::put_string(const std::string& s)
+{
+    put_varint(s.size());
+    put_bytes(s.data(), s.size());
+}
+
+void
+vcb_trace_file::write_block()
+{
+    if (m_times.empty())
+        return;
+
+    block_entry entry = { m_times.front(), m_times.back(), m_offset };
+    m_index.push_back(entry);
+
+    put_bytes("B", 1);
+    put_varint(m_times.size());
+    put_varint(m_times[0]);
+    for (std::size_t t = 1; t < m_times.size(); t++)
+        put_varint(m_times[t] - m_times[t - 1]);
+
+    // compress the chunks in place, the directory needs their sizes
+    std::size_t count = 0;
+    std::vector<std::size_t> sizes(m_chunks.size());
+    std::vector<char>        methods(m_chunks.size());
+    for (std::size_t i = 0; i < m_chunks.size(); i++) {
+        sizes[i]   = m_chunks[i].size();
+        methods[i] = 0;
+        if (sizes[i] == 0)
+            continue;
+        count++;
+        if (sc_trace_gzip::compress(m_chunks[i].data(), sizes[i],
+                                    m_compressed)) {
+            m_chunks[i].swap(m_compressed);
+            methods[i] = 1;
+        }
+    }
+
+    put_varint(count);
+    for (std::size_t i = 0; i < m_chunks.size(); i++) {
+        if (sizes[i] == 0)
+            continue;
+        put_varint(i);
+        put_bytes(&methods[i], 1);
+        put_varint(m_chunks[i].size());
+        put_varint(sizes[i]);
+    }
+    for (std::size_t i = 0; i < m_chunks.size(); i++) {
+        put_bytes(m_chunks[i].data(), m_chunks[i].size());
+        m_chunks[i].clear();
+        m_last_change[i] = 0;
+    }
+
+    m_times.clear();
+    m_block_size = 0;
+}
+
+void
+vcb_trace_file::write_index()
+{
+    sc_dt::uint64 index_offset = m_offset;
+
+    put_bytes("I", 1);
+    put_varint(m_index.size());
+    for (std::size_t b = 0; b < m_index.size(); b++) {
+        put_varint(m_index[b].first_time);
+        put_varint(m_index[b].last_time);
+        put_varint(m_index[b].offset);
+    }
+
+    char trailer[16];
+    for (int i = 0; i < 8; i++)
+        trailer[i] = static_cast<char>(index_offset >> (8 * i));
+    std::memcpy(trailer + 8, "SCVCBIDX", 8);
+    put_bytes(trailer, sizeof(trailer));
+}
+
+// ----------------------------------------------------------------------------
+
+SC_API sc_trace_file*
+sc_create_vcb_trace_file(const char* name)
+{
+    sc_trace_file* tf = new vcb_trace_file(name);
+    return tf;
+}
+
+SC_API void
+sc_close_vcb_trace_file( sc_trace_file* tf )
+{
+    vcb_trace_file* vcb_tf = static_cast<vcb_trace_file*>(tf);
+    delete vcb_tf;
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
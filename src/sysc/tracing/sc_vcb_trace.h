@@ -0,0 +1,145 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_vcb_trace.h - Value change blocks: a seekable, per-signal trace format.
+
+  A VCB file holds the same value changes as a VCD file, grouped into
+  blocks of about a MiB.  Within a block, the changes of each signal are
+  stored (and zlib compressed) separately, and an index at the end of the
+  file maps time ranges to blocks.  A viewer can thus read a single signal
+  in a time window without decompressing the whole file.
+
+  All integers are unsigned LEB128 ("varint"), unless noted otherwise;
+  strings are a varint length followed by the characters.
+
+    file     := header block* index trailer
+    header   := "SCVCB01\n" timescale_fs:varint date:string version:string
+                count:varint ( name:string type:byte width:varint )*count
+    block    := 'B' times:varint first_time:varint time_delta:varint*
+                chunks:varint ( trace:varint method:byte
+                                stored_size:varint size:varint )*chunks
+                chunk_data*chunks
+    chunk    := ( time_index_delta:varint length:varint value )*
+    index    := 'I' blocks:varint
+                ( first_time:varint last_time:varint offset:varint )*blocks
+    trailer  := index_offset:uint64 (little endian) "SCVCBIDX"
+
+  Times are in timescale units, the type is that of the VCD declaration
+  (wire, real, event, time), values are in VCD syntax without identifier
+  (e.g. "1", "b1010", "r0.5").  The time index of the first change of a
+  chunk is relative to the start of the block, the others to the previous
+  change.  A chunk is stored as is (method 0) or zlib compressed
+  (method 1, RFC 1950), if the library is built with zlib and this makes
+  it smaller.  Comments are not stored.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_VCB_TRACE_H
+#define SC_VCB_TRACE_H
+
+#include "sysc/tracing/sc_vcd_trace.h"
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::vector
+#endif
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : vcb_trace_file
+//
+//  Trace file in the VCB format, see above.  The values are taken from
+//  the VCD tracing, only their output differs.
+// ----------------------------------------------------------------------------
+
+class vcb_trace_file
+  : public vcd_trace_file
+{
+public:
+
+    // Create a VCB trace file, `name' forms the base of the name to which
+    // `.vcb' is added.
+    explicit vcb_trace_file(const char* name);
+
+    // Write the last block and the index, and close the file.
+    ~vcb_trace_file();
+
+protected:
+
+    // Comments are not stored in the VCB format.
+    void write_comment(const std::string& comment);
+
+    virtual void do_initialize();
+
+    virtual void print_time_stamp(unit_type now_units_high,
+                                  unit_type now_units_low);
+    virtual void print_value(int index);
+    virtual void print_values_end();
+
+private:
+
+    struct block_entry
+    {
+        sc_dt::uint64 first_time;
+        sc_dt::uint64 last_time;
+        sc_dt::uint64 offset;
+    };
+
+    void put_bytes(const char* data, std::size_t size);
+    void put_varint(sc_dt::uint64 value);
+    void put_string(const std::string& s);
+
+    // write the changes collected so far as a block
+    void write_block();
+    // write the index of the blocks and the trailer
+    void write_index();
+
+    sc_dt::uint64              m_offset;       // bytes written to the file
+    std::vector<sc_dt::uint64> m_times;        // time stamps of the block
+    std::vector<std::string>   m_chunks;       // changes per trace
+    std::vector<std::size_t>   m_last_change;  // time index of last change
+    std::size_t                m_block_size;   // size of the chunks
+    std::vector<block_entry>   m_index;        // blocks written so far
+    sc_trace_buffer            m_scratch;      // formats the VCD values
+    std::string                m_value;        // last formatted value
+    std::string                m_compressed;   // compressed chunk
+};
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_VCB_TRACE_H
+// Taf!
@@ -51,6 +51,7 @@
  *****************************************************************************/
 
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <limits>
@@ -72,6 +73,7 @@
 #include "sysc/datatypes/int/sc_signed_ops.h"
 #include "sysc/datatypes/int/sc_unsigned_inlines.h"
 #include "sysc/datatypes/fx/fx.h"
+#include "sysc/tracing/sc_trace_gzip.h"
 #include "sysc/tracing/sc_vcd_trace.h"
 #include "sysc/utils/sc_report.h" // sc_assert
 #include "sysc/utils/sc_string_view.h"
@@ -112,7 +114,7 @@ public:
 
     // Needs to be pure virtual as has to be defined by the particular
     // type being traced
-    virtual void write(FILE* f) = 0;
+    virtual void write(sc_trace_buffer& f) = 0;
 
     virtual void set_width();
 
@@ -122,9 +124,9 @@ public:
     virtual bool changed() = 0;
 
     // Make this virtual as some derived classes may overwrite
-    virtual void print_variable_declaration_line(FILE* f, const char* scoped_name);
+    virtual void print_variable_declaration_line(sc_trace_buffer& f, const char* scoped_name);
 
-    void print_data_line(FILE* f, const char* rawdata);
+    void print_data_line(sc_trace_buffer& f, const char* rawdata);
 
     virtual ~vcd_trace() = default;
 
@@ -132,6 +134,7 @@ public:
     const std::string vcd_name;
     vcd_trace_file::vcd_enum vcd_var_type;
     int bit_width;
+    bool change_marked;  // changes are marked by the traced channel
 };
 
 
@@ -140,27 +143,32 @@ vcd_trace::vcd_trace(const std::string& name_, const std::string& vcd_name_)
   , vcd_name(vcd_name_)
   , vcd_var_type(vcd_trace_file::VCD_WIRE)
   , bit_width(0)
+  , change_marked(false)
 {
     /* Intentionally blank */
 }
 
 void
-vcd_trace::print_data_line(FILE* f, const char* rawdata)
+vcd_trace::print_data_line(sc_trace_buffer& f, const char* rawdata)
 {
     if(bit_width == 0)
         return;
 
     if(bit_width == 1) {
-        std::fprintf(f, "%c%s", *rawdata, vcd_name.c_str());
+        f.put(*rawdata);
+        f.put(vcd_name);
         return;
     }
 
     const char* effective_begin = strip_leading_bits(rawdata);
-    std::fprintf(f, "b%s %s", effective_begin, vcd_name.c_str());
+    f.put('b');
+    f.put(effective_begin);
+    f.put(' ');
+    f.put(vcd_name);
 }
 
 void
-vcd_trace::print_variable_declaration_line(FILE* f, const char* scoped_name)
+vcd_trace::print_variable_declaration_line(sc_trace_buffer& f, const char* scoped_name)
 {
     if ( bit_width <= 0 )
     {
@@ -171,12 +179,12 @@ vcd_trace::print_variable_declaration_line(FILE* f, const char* scoped_name)
     }
 
     if ( bit_width == 1 ) {
-        std::fprintf(f, "$var %s  % 3d  %s  %s       $end\n",
+        f.printf("$var %s  % 3d  %s  %s       $end\n",
                      vcd_types[vcd_var_type], bit_width, vcd_name.c_str(), scoped_name);
         return;
     }
 
-    std::fprintf(f, "$var %s  % 3d  %s  %s [%d:0]  $end\n",
+    f.printf("$var %s  % 3d  %s  %s [%d:0]  $end\n",
                  vcd_types[vcd_var_type], bit_width, vcd_name.c_str(), scoped_name, bit_width-1);
 }
 
@@ -237,7 +245,7 @@ class vcd_T_trace : public vcd_trace
         vcd_var_type = type_;
     }
 
-    void write( FILE* f )
+    void write( sc_trace_buffer& f )
     {
         print_data_line( f, object.to_string().c_str() );
         old_value = object;
@@ -281,7 +289,7 @@ public:
     vcd_sc_event_trace(const sc_dt::uint64& trigger_stamp_,
                        const std::string& name_,
                        const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& f);
     bool changed();
 
 protected:
@@ -306,10 +314,11 @@ vcd_sc_event_trace::changed()
 }
 
 void
-vcd_sc_event_trace::write(FILE* f)
+vcd_sc_event_trace::write(sc_trace_buffer& f)
 {
     if(!changed()) return;
-    std::fprintf(f,"1%s", vcd_name.c_str());
+    f.put('1');
+    f.put(vcd_name);
     old_trigger_stamp = trigger_stamp;
 }
 
@@ -320,7 +329,7 @@ public:
     vcd_bool_trace(const bool& object_,
 		   const std::string& name_,
 		   const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& f);
     bool changed();
 
 protected:
@@ -343,9 +352,10 @@ vcd_bool_trace::changed()
 }
 
 void
-vcd_bool_trace::write(FILE* f)
+vcd_bool_trace::write(sc_trace_buffer& f)
 {
-    std::fprintf(f,"%c%s", "01"[object], vcd_name.c_str());
+    f.put("01"[object]);
+    f.put(vcd_name);
     old_value = object;
 }
 
@@ -355,7 +365,7 @@ class vcd_sc_bit_trace : public vcd_trace {
 public:
     vcd_sc_bit_trace(const sc_dt::sc_bit& , const std::string& ,
     	const std::string& );
-    void write(FILE* f);
+    void write(sc_trace_buffer& f);
     bool changed();
 
 protected:
@@ -378,9 +388,10 @@ vcd_sc_bit_trace::changed()
 }
 
 void
-vcd_sc_bit_trace::write(FILE* f)
+vcd_sc_bit_trace::write(sc_trace_buffer& f)
 {
-    std::fprintf(f,"%c%s", "01"[object], vcd_name.c_str());
+    f.put("01"[object]);
+    f.put(vcd_name);
     old_value = object;
 }
 
@@ -391,7 +402,7 @@ public:
     vcd_sc_logic_trace(const sc_dt::sc_logic& object_,
 		       const std::string& name_,
 		       const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& f);
     bool changed();
 
 protected:
@@ -417,10 +428,11 @@ vcd_sc_logic_trace::changed()
 
 
 void
-vcd_sc_logic_trace::write(FILE* f)
+vcd_sc_logic_trace::write(sc_trace_buffer& f)
 {
     char out_char = map_sc_logic_state_to_vcd_state(object.to_char());
-    std::fprintf(f,"%c%s", out_char, vcd_name.c_str());
+    f.put(out_char);
+    f.put(vcd_name);
     old_value = object;
 }
 
@@ -432,7 +444,7 @@ public:
     vcd_sc_unsigned_trace(const sc_dt::sc_unsigned& object_,
 			  const std::string& name_,
 			  const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& f);
     bool changed();
     void set_width();
 
@@ -459,7 +471,7 @@ vcd_sc_unsigned_trace::changed()
 }
 
 void
-vcd_sc_unsigned_trace::write(FILE* f)
+vcd_sc_unsigned_trace::write(sc_trace_buffer& f)
 {
     char *rawdata_ptr  = rawdata.data();
     for(int bit_index = bit_width - 1; bit_index >= 0; --bit_index) {
@@ -485,7 +497,7 @@ public:
     vcd_sc_signed_trace(const sc_dt::sc_signed& object_,
 			const std::string& name_,
 			const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& f);
     bool changed();
     void set_width();
 
@@ -511,7 +523,7 @@ vcd_sc_signed_trace::changed()
 }
 
 void
-vcd_sc_signed_trace::write(FILE* f)
+vcd_sc_signed_trace::write(sc_trace_buffer& f)
 {
     char *rawdata_ptr  = rawdata.data();
     for(int bit_index = bit_width - 1; bit_index >= 0; --bit_index) {
@@ -538,7 +550,7 @@ public:
     vcd_sc_uint_base_trace(const sc_dt::sc_uint_base& object_,
 			   const std::string& name_,
 			   const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& f);
     bool changed();
     void set_width();
 
@@ -565,7 +577,7 @@ vcd_sc_uint_base_trace::changed()
 }
 
 void
-vcd_sc_uint_base_trace::write(FILE* f)
+vcd_sc_uint_base_trace::write(sc_trace_buffer& f)
 {
     char rawdata[max_width + /*\0*/ 1], *rawdata_ptr = rawdata;
     for(int bit_index = bit_width - 1; bit_index >= 0; --bit_index) {
@@ -592,7 +604,7 @@ public:
     vcd_sc_int_base_trace(const sc_dt::sc_int_base& object_,
 			  const std::string& name_,
 			  const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& f);
     bool changed();
     void set_width();
 
@@ -617,7 +629,7 @@ vcd_sc_int_base_trace::changed()
 }
 
 void
-vcd_sc_int_base_trace::write(FILE* f)
+vcd_sc_int_base_trace::write(sc_trace_buffer& f)
 {
     char rawdata[max_width + /*\0*/ 1], *rawdata_ptr = rawdata;
     for(int bit_index = bit_width - 1; bit_index >= 0; --bit_index) {
@@ -644,7 +656,7 @@ public:
     vcd_sc_fxval_trace( const sc_dt::sc_fxval& object_,
 			const std::string& name_,
 			const std::string& vcd_name_ );
-    void write( FILE* f );
+    void write( sc_trace_buffer& f );
     bool changed();
 
 protected:
@@ -671,9 +683,9 @@ vcd_sc_fxval_trace::changed()
 }
 
 void
-vcd_sc_fxval_trace::write( FILE* f )
+vcd_sc_fxval_trace::write( sc_trace_buffer& f )
 {
-    std::fprintf( f, "r%.16g %s", object.to_double(), vcd_name.c_str() );
+    f.printf( "r%.16g %s", object.to_double(), vcd_name.c_str() );
     old_value = object;
 }
 
@@ -686,7 +698,7 @@ public:
     vcd_sc_fxval_fast_trace( const sc_dt::sc_fxval_fast& object_,
 			     const std::string& name_,
 			     const std::string& vcd_name_ );
-    void write( FILE* f );
+    void write( sc_trace_buffer& f );
     bool changed();
 
 protected:
@@ -714,9 +726,9 @@ vcd_sc_fxval_fast_trace::changed()
 }
 
 void
-vcd_sc_fxval_fast_trace::write( FILE* f )
+vcd_sc_fxval_fast_trace::write( sc_trace_buffer& f )
 {
-    std::fprintf( f, "r%.16g %s", object.to_double(), vcd_name.c_str() );
+    f.printf( "r%.16g %s", object.to_double(), vcd_name.c_str() );
     old_value = object;
 }
 
@@ -729,7 +741,7 @@ public:
     vcd_sc_fxnum_trace( const sc_dt::sc_fxnum& object_,
 			const std::string& name_,
 			const std::string& vcd_name_ );
-    void write( FILE* f );
+    void write( sc_trace_buffer& f );
     bool changed();
     void set_width();
 
@@ -761,7 +773,7 @@ vcd_sc_fxnum_trace::changed()
 }
 
 void
-vcd_sc_fxnum_trace::write( FILE* f )
+vcd_sc_fxnum_trace::write( sc_trace_buffer& f )
 {
     char *rawdata_ptr  = rawdata.data();
     for(int bit_index = bit_width; bit_index >= 0; --bit_index) {
@@ -788,7 +800,7 @@ public:
     vcd_sc_fxnum_fast_trace( const sc_dt::sc_fxnum_fast& object_,
 			     const std::string& name_,
 			     const std::string& vcd_name_ );
-    void write( FILE* f );
+    void write( sc_trace_buffer& f );
     bool changed();
     void set_width();
 
@@ -821,7 +833,7 @@ vcd_sc_fxnum_fast_trace::changed()
 }
 
 void
-vcd_sc_fxnum_fast_trace::write( FILE* f )
+vcd_sc_fxnum_fast_trace::write( sc_trace_buffer& f )
 {
     char *rawdata_ptr  = rawdata.data();
     for(int bit_index = bit_width; bit_index >= 0; --bit_index) {
@@ -888,7 +900,7 @@ public:
                       int   width_ = max_width);
 
     bool changed() { return object != old_value; }
-    void write(FILE* f);
+    void write(sc_trace_buffer& f);
 
 protected:
     const type& object;
@@ -910,7 +922,7 @@ vcd_builtin_trace<T, Signed>::vcd_builtin_trace( const type& object_,
 
 
 template<typename T, bool Signed>
-void vcd_builtin_trace<T, Signed>::write(FILE* f)
+void vcd_builtin_trace<T, Signed>::write(sc_trace_buffer& f)
 {
     char rawdata[max_width + /*\0*/ 1], *rawdata_ptr = rawdata;
 
@@ -972,7 +984,7 @@ public:
     vcd_float_trace(const float& object_,
 		    const std::string& name_,
 		    const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& f);
     bool changed();
 
 protected:
@@ -995,9 +1007,9 @@ bool vcd_float_trace::changed()
     return object != old_value;
 }
 
-void vcd_float_trace::write(FILE* f)
+void vcd_float_trace::write(sc_trace_buffer& f)
 {
-    std::fprintf(f, "r%.16g %s", object, vcd_name.c_str());
+    f.printf("r%.16g %s", object, vcd_name.c_str());
     old_value = object;
 }
 
@@ -1008,7 +1020,7 @@ public:
     vcd_double_trace(const double& object_,
 		     const std::string& name_,
 		     const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& f);
     bool changed();
 
 protected:
@@ -1030,9 +1042,9 @@ bool vcd_double_trace::changed()
     return object != old_value;
 }
 
-void vcd_double_trace::write(FILE* f)
+void vcd_double_trace::write(sc_trace_buffer& f)
 {
-    std::fprintf(f, "r%.16g %s", object, vcd_name.c_str());
+    f.printf("r%.16g %s", object, vcd_name.c_str());
     old_value = object;
 }
 
@@ -1082,7 +1094,7 @@ vcd_enum_trace::vcd_enum_trace(const unsigned& object_,
 struct vcd_scope {
 
     void add_trace(vcd_trace *trace, bool with_scopes);
-    void print(FILE *fp, const char *scope_name = "SystemC");
+    void print(sc_trace_buffer& out, const char *scope_name = "SystemC");
 
     ~vcd_scope();
 private:
@@ -1126,18 +1138,18 @@ void vcd_scope::add_trace_rec(std::stringstream &ss, const std::string &cur_name
     }
 }
 
-void vcd_scope::print(FILE *fp, const char *scope_name) {
-    fprintf(fp,"$scope module %s $end\n", scope_name);
+void vcd_scope::print(sc_trace_buffer& out, const char *scope_name) {
+    out.printf("$scope module %s $end\n", scope_name);
 
     for (std::vector<std::pair<std::string,vcd_trace*> >::iterator it = m_traces.begin(); it != m_traces.end(); ++it) {
         it->second->set_width();
-        it->second->print_variable_declaration_line(fp, it->first.c_str());
+        it->second->print_variable_declaration_line(out, it->first.c_str());
     }
 
     for (std::map<std::string, vcd_scope*>::iterator it = m_scopes.begin(); it != m_scopes.end(); ++it)
-        it->second->print(fp,it->first.c_str());
+        it->second->print(out,it->first.c_str());
 
-    fprintf(fp,"$upscope $end\n");
+    out.put("$upscope $end\n");
 }
 
 #ifdef SC_DISABLE_VCD_SCOPES
@@ -1146,7 +1158,7 @@ void vcd_scope::print(FILE *fp, const char *scope_name) {
 #  define VCD_SCOPES_DEFAULT_ true
 #endif
 
-void vcd_print_scopes(FILE *fp, std::vector<vcd_trace*>& traces) {
+void vcd_print_scopes(sc_trace_buffer& out, std::vector<vcd_trace*>& traces) {
 
     vcd_scope top_scope;
 
@@ -1160,7 +1172,7 @@ void vcd_print_scopes(FILE *fp, std::vector<vcd_trace*>& traces) {
     for (std::vector<vcd_trace*>::iterator it = traces.begin(); it != traces.end(); ++it)
         top_scope.add_trace(*it, with_scopes);
 
-    top_scope.print(fp);
+    top_scope.print(out);
 }
 
 
@@ -1168,11 +1180,19 @@ void vcd_print_scopes(FILE *fp, std::vector<vcd_trace*>& traces) {
            vcd_trace_file functions
  *****************************************************************************/
 
-vcd_trace_file::vcd_trace_file(const char *name)
-  : sc_trace_file_base( name, "vcd" )
-  , vcd_name_index(0)
+vcd_trace_file::vcd_trace_file(const char *name, bool compressed)
+  : vcd_trace_file( name, compressed ? "vcd.gz" : "vcd", compressed, false )
+{}
+
+vcd_trace_file::vcd_trace_file(const char* name, const char* extension,
+                               bool compressed, bool binary)
+  : sc_trace_file_base( name, extension, compressed
+                      , std::getenv("SC_TRACE_ASYNC_WRITE") != NULL, binary )
   , previous_time_units_low(0)
   , previous_time_units_high(0)
+  , vcd_name_index(0)
+  , changes()
+  , polled_traces()
   , traces()
 {}
 
@@ -1181,17 +1201,17 @@ void
 vcd_trace_file::do_initialize()
 {
     //date:
-    std::fprintf(fp, "$date\n     %s\n$end\n\n", localtime_string().c_str() );
+    out.printf("$date\n     %s\n$end\n\n", localtime_string().c_str() );
 
     //version:
-    std::fprintf(fp, "$version\n %s\n$end\n\n", sc_version());
+    out.printf("$version\n %s\n$end\n\n", sc_version());
 
     //timescale:
-    std::fprintf(fp,"$timescale\n     %s\n$end\n\n", fs_unit_to_str(trace_unit_fs).c_str());
+    out.printf("$timescale\n     %s\n$end\n\n", fs_unit_to_str(trace_unit_fs).c_str());
 
-    vcd_print_scopes(fp, traces);
+    vcd_print_scopes(out, traces);
 
-    std::fputs("$enddefinitions  $end\n\n", fp);
+    out.put("$enddefinitions  $end\n\n");
 
     timestamp_in_trace_units(previous_time_units_high, previous_time_units_low);
 
@@ -1207,12 +1227,28 @@ vcd_trace_file::do_initialize()
 
     write_comment(ss.str());
 
-    std::fputs("$dumpvars\n",fp);
+    out.put("$dumpvars\n");
     for (int i = 0; i < (int)traces.size(); i++) {
-        traces[i]->write(fp);
-        std::fputc('\n', fp);
+        traces[i]->write(out);
+        out.put('\n');
+    }
+    out.put("$end\n\n");
+
+    initialize_changes();
+}
+
+void
+vcd_trace_file::initialize_changes()
+{
+    if (changes) {
+        // all values are written, only poll traces without channel
+        for (int i = 0; i < (int)traces.size(); i++) {
+            if (!traces[i]->change_marked)
+                polled_traces.push_back(i);
+        }
+        changes->resize(traces.size());
+        changes->clear();
     }
-    std::fputs("$end\n\n", fp);
 }
 
 void vcd_trace_file::trace( sc_trace_file* ) const {
@@ -1311,9 +1347,9 @@ vcd_trace_file::write_comment(const std::string& comment)
 {
     if(!fp) open_fp();
     //no newline in comments allowed, as some viewers may crash
-    std::fputs("$comment\n", fp);
-    std::fputs(comment.c_str(), fp);
-    std::fputs("\n$end\n\n", fp);
+    out.put("$comment\n");
+    out.put(comment);
+    out.put("\n$end\n\n");
 }
 
 void
@@ -1374,22 +1410,124 @@ vcd_trace_file::cycle(bool this_is_a_delta_cycle)
 
     // Now do the actual printing
     bool time_printed = false;
-    for (size_t i = 0; i < traces.size(); i++) {
-        vcd_trace* t = traces[i];
-        if(t->changed()) {
-            if(!time_printed){
-                print_time_stamp(now_units_high, now_units_low);
-
-                time_printed = true;
+    if (changes) {
+        // visit the marked and the polled traces in the order of traces
+        std::vector<int>& changed = changes->changed();
+        std::sort(changed.begin(), changed.end());
+        size_t c = 0, p = 0;
+        while (c < changed.size() || p < polled_traces.size()) {
+            if (p == polled_traces.size() ||
+                (c < changed.size() && changed[c] < polled_traces[p])) {
+                print_if_changed(changed[c++], time_printed,
+                                 now_units_high, now_units_low);
+            } else {
+                print_if_changed(polled_traces[p++], time_printed,
+                                 now_units_high, now_units_low);
             }
+        }
+        changes->clear();
+    } else {
+        for (size_t i = 0; i < traces.size(); i++) {
+            print_if_changed(static_cast<int>(i), time_printed,
+                             now_units_high, now_units_low);
+        }
+    }
+    if(time_printed) print_values_end();
+}
+
+void
+vcd_trace_file::print_if_changed(int index, bool& time_printed,
+                                 unit_type now_units_high,
+                                 unit_type now_units_low)
+{
+    if(traces[index]->changed()) {
+        if(!time_printed){
+            print_time_stamp(now_units_high, now_units_low);
 
-            // Write the variable
-            t->write(fp);
-            std::fputc('\n', fp);
+            time_printed = true;
         }
+
+        print_value(index);
     }
+}
+
+void
+vcd_trace_file::print_value(int index)
+{
+    // Write the variable
+    traces[index]->write(out);
+    out.put('\n');
+}
+
+void
+vcd_trace_file::print_values_end()
+{
     // Put another newline after all values are printed
-    if(time_printed) std::fputc('\n', fp);
+    out.put('\n');
+}
+
+void
+vcd_trace_file::trace_declaration(int index, std::string& name,
+                                  vcd_enum& type, int& width) const
+{
+    vcd_trace* t = traces[index];
+    t->set_width();
+    name  = t->name;
+    type  = t->vcd_var_type;
+    width = t->bit_width;
+}
+
+void
+vcd_trace_file::trace_value(int index, sc_trace_buffer& scratch,
+                            std::string& value)
+{
+    vcd_trace* t = traces[index];
+    t->write(scratch);
+    scratch.take(value);
+
+    // strip the identifier and its separator, if any
+    const std::string& id = t->vcd_name;
+    if (value.size() >= id.size() &&
+        value.compare(value.size() - id.size(), id.size(), id) == 0) {
+        value.resize(value.size() - id.size());
+        if (!value.empty() && value[value.size() - 1] == ' ')
+            value.resize(value.size() - 1);
+    }
+}
+
+void
+vcd_trace_file::change_driven(bool flag)
+{
+    if( is_initialized() )
+    {
+        std::stringstream ss;
+        ss << filename() << "\n"
+           "\tChange-driven tracing cannot be changed once tracing has begun.\n"
+           "\tTo change the mode, create a new trace file.";
+        SC_REPORT_ERROR( SC_ID_TRACING_ALREADY_INITIALIZED_
+                       , ss.str().c_str() );
+        return;
+    }
+
+    if (!flag) {
+        changes.reset();
+    } else if (!changes) {
+        changes = std::make_shared<sc_trace_changes>();
+    }
+}
+
+sc_trace_changes_ptr
+vcd_trace_file::trace_changes(const std::string& name, int& index)
+{
+    // only the trace just added can be marked by its channel
+    if (!changes || is_initialized() || traces.empty()
+        || traces.back()->name != name)
+        return sc_trace_changes_ptr();
+
+    index = static_cast<int>(traces.size()) - 1;
+    traces.back()->change_marked = true;
+    changes->resize(traces.size());
+    return changes;
 }
 
 bool vcd_trace_file::get_time_stamp(sc_trace_file_base::unit_type &now_units_high,
@@ -1403,17 +1541,16 @@ bool vcd_trace_file::get_time_stamp(sc_trace_file_base::unit_type &now_units_hig
 }
 
 void vcd_trace_file::print_time_stamp(sc_trace_file_base::unit_type now_units_high,
-                                      sc_trace_file_base::unit_type now_units_low) const
+                                      sc_trace_file_base::unit_type now_units_low)
 {
+    // let compressed blocks start at a time stamp
+    out.block_boundary();
 
-    std::stringstream ss;
+    out.put('#');
+    out.put_decimal(now_units_high);
     if(has_low_units())
-        ss << "#" << now_units_high << std::setfill('0') << std::setw(low_units_len()) << now_units_low;
-    else
-        ss << "#" << now_units_high;
-
-    fputs(ss.str().c_str(), fp);
-    fputc('\n', fp);
+        out.put_decimal(now_units_low, low_units_len());
+    out.put('\n');
 }
 
 
@@ -1538,6 +1675,17 @@ sc_create_vcd_trace_file(const char * name)
     return tf;
 }
 
+SC_API sc_trace_file*
+sc_create_vcd_gz_trace_file(const char * name)
+{
+    // compression is only possible with zlib, see sc_trace_gzip
+    bool compressed = sc_trace_gzip::available();
+    if( !compressed )
+        SC_REPORT_WARNING( SC_ID_TRACING_COMPRESSION_UNAVAILABLE_, 0 );
+    sc_trace_file * tf = new vcd_trace_file(name, compressed);
+    return tf;
+}
+
 SC_API void
 sc_close_vcd_trace_file( sc_trace_file* tf )
 {
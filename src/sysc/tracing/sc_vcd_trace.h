@@ -79,12 +79,16 @@ public:
 #endif
 
     // Create a Vcd trace file.
-    // `Name' forms the base of the name to which `.vcd' is added.
-    vcd_trace_file(const char *name);
+    // `Name' forms the base of the name to which `.vcd' is added,
+    // or `.vcd.gz' for a gzip compressed file.
+    vcd_trace_file(const char *name, bool compressed = false);
 
     // Flush results and close file.
     ~vcd_trace_file();
 
+    // Only check traced signals for changes after they have been updated.
+    void change_driven(bool flag);
+
 protected:
 
     // These are all virtual functions in sc_trace_file and
@@ -204,6 +208,43 @@ protected:
     // Write trace info for cycle.
      void cycle(bool delta_cycle);
 
+    // Change list for the last trace added as `name'.
+     sc_trace_changes_ptr trace_changes(const std::string& name, int& index);
+
+protected:
+
+    // Create a trace file in another format based on the VCD values,
+    // named `name' + `.' + `extension'.
+    vcd_trace_file(const char* name, const char* extension,
+                   bool compressed, bool binary);
+
+    // Initialize the VCD tracing
+    virtual void do_initialize();
+
+    // Start the change tracking, after the initial values are written
+    void initialize_changes();
+
+    // Output of the time stamp before the first change at a time,
+    // of a changed value and after the last change at that time
+    virtual void print_time_stamp(unit_type now_units_high,
+                                  unit_type now_units_low);
+    virtual void print_value(int index);
+    virtual void print_values_end();
+
+    bool get_time_stamp(unit_type &now_units_high, unit_type &now_units_low) const;
+
+    // Declaration of a trace: name, type and width
+    void trace_declaration(int index, std::string& name,
+                           vcd_enum& type, int& width) const;
+
+    // Current value of a trace in VCD syntax without its identifier
+    // (e.g. "1", "b1010" or "r0.5"), formatted by the scratch buffer
+    void trace_value(int index, sc_trace_buffer& scratch,
+                     std::string& value);
+
+    unit_type previous_time_units_low;
+    unit_type previous_time_units_high;
+
 private:
 
     template<typename T> const T& extract_ref(const T& object) const
@@ -214,15 +255,13 @@ private:
     // avoid hidden overload warnings
     virtual void trace( sc_trace_file* ) const;
 
-    // Initialize the VCD tracing
-    virtual void do_initialize();
-    void print_time_stamp(unit_type now_units_high, unit_type now_units_low) const;
-    bool get_time_stamp(unit_type &now_units_high, unit_type &now_units_low) const;
+    void print_if_changed(int index, bool& time_printed,
+                          unit_type now_units_high, unit_type now_units_low);
 
     unsigned vcd_name_index;           // Number of variables traced
 
-    unit_type previous_time_units_low;
-    unit_type previous_time_units_high;
+    sc_trace_changes_ptr changes;      // changed traces, if change-driven
+    std::vector<int>     polled_traces;  // traces not marked by a channel
 
 public:
 
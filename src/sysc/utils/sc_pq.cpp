@@ -37,8 +37,9 @@
 
 namespace sc_core {
 
-sc_ppq_base::sc_ppq_base( int sz, int (*cmp)( const void*, const void* ) )
-    : m_heap(0), m_size_alloc( sz ), m_heap_size( 0 ), m_compar( cmp )
+sc_ppq_base::sc_ppq_base( int sz, compare_fn_t cmp, index_fn_t idx )
+    : m_heap(0), m_size_alloc( sz ), m_heap_size( 0 ), m_compar( cmp ),
+      m_index( idx )
 {
     // m_size_alloc must be at least 2, otherwise resizing doesn't work
     if( m_size_alloc < 2 ) {
@@ -62,9 +63,14 @@ sc_ppq_base::extract_top()
 {
     sc_assert( m_heap_size > 0 );
     void* topelem = m_heap[1];
-    m_heap[1] = m_heap[m_heap_size];
     m_heap_size --;
-    heapify( 1 );
+    if( m_heap_size > 0 ) {
+        place( 1, m_heap[m_heap_size + 1] );
+        heapify( 1 );
+    }
+    if( m_index != 0 ) {
+        m_index( topelem, 0 );
+    }
     return topelem;
 }
 
@@ -85,11 +91,50 @@ sc_ppq_base::insert( void* elem )
         m_heap = new_heap;
     }
 
+    sift_up( i, elem );
+}
+
+void
+sc_ppq_base::remove( int i )
+{
+    sc_assert( i > 0 && i <= m_heap_size );
+    void* elem = m_heap[i];
+    void* last = m_heap[m_heap_size];
+    m_heap_size --;
+    if( i <= m_heap_size ) {
+        // move the last element into the hole and restore the heap order
+        if( (i > 1) && (m_compar( m_heap[parent( i )], last ) < 0) ) {
+            sift_up( i, last );
+        } else {
+            place( i, last );
+            heapify( i );
+        }
+    }
+    if( m_index != 0 ) {
+        m_index( elem, 0 );
+    }
+}
+
+void
+sc_ppq_base::update( int i )
+{
+    sc_assert( i > 0 && i <= m_heap_size );
+    void* elem = m_heap[i];
+    if( (i > 1) && (m_compar( m_heap[parent( i )], elem ) < 0) ) {
+        sift_up( i, elem );
+    } else {
+        heapify( i );
+    }
+}
+
+void
+sc_ppq_base::sift_up( int i, void* elem )
+{
     while( (i > 1) && (m_compar( m_heap[parent( i )], elem ) < 0) ) {
-        m_heap[i] = m_heap[parent( i )];
+        place( i, m_heap[parent( i )] );
         i = parent( i );
     }
-    m_heap[i] = elem;
+    place( i, elem );
 }
 
 void
@@ -107,8 +152,8 @@ sc_ppq_base::heapify( int i )
 
         if( largest != i ) {
             void* tmp = m_heap[i];
-            m_heap[i] = m_heap[largest];
-            m_heap[largest] = tmp;
+            place( i, m_heap[largest] );
+            place( largest, tmp );
             i = largest;
         } else {
             break;
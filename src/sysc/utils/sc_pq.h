@@ -39,6 +39,11 @@ namespace sc_core {
 //  CLASS : sc_ppq_base
 //
 //  Priority queue base class.
+//
+//  If an index function is supplied, it is called with the new heap
+//  position of each element that is moved within the heap (and with 0
+//  when an element leaves the heap). This allows elements to be removed
+//  from or repositioned within the queue without a search.
 // ----------------------------------------------------------------------------
 
 class SC_API sc_ppq_base
@@ -46,8 +51,9 @@ class SC_API sc_ppq_base
 public:
 
     typedef int (*compare_fn_t)( const void*, const void* );
+    typedef void (*index_fn_t)( void*, int );
 
-    sc_ppq_base( int sz, compare_fn_t cmp );
+    sc_ppq_base( int sz, compare_fn_t cmp, index_fn_t idx = 0 );
 
     ~sc_ppq_base();
 
@@ -58,6 +64,10 @@ public:
 
     void insert( void* elem );
 
+    void remove( int i );
+
+    void update( int i );
+
     int size() const
 	{ return m_heap_size; }
 
@@ -77,12 +87,18 @@ protected:
 
     void heapify( int i );
 
+    void sift_up( int i, void* elem );
+
+    void place( int i, void* elem )
+	{ m_heap[i] = elem; if( m_index != 0 ) { m_index( elem, i ); } }
+
 private:
 
     void**       m_heap;
     int          m_size_alloc;
     int          m_heap_size;
     compare_fn_t m_compar;
+    index_fn_t   m_index;
 };
 
 
@@ -101,10 +117,10 @@ class sc_ppq
 public:
 
     // constructor - specify the maximum size of the queue and
-    // give a comparison function.
+    // give a comparison function and optionally an index function.
 
-    sc_ppq( int sz, compare_fn_t cmp )
-        : sc_ppq_base( sz, cmp )
+    sc_ppq( int sz, compare_fn_t cmp, index_fn_t idx = 0 )
+        : sc_ppq_base( sz, cmp, idx )
 	{}
 
     ~sc_ppq()
@@ -124,6 +140,18 @@ public:
     void insert( T elem )
 	{ sc_ppq_base::insert( (void*) elem ); }
 
+    // remove the element at heap position i (as reported to the index
+    // function) from the priority queue.
+
+    void remove( int i )
+	{ sc_ppq_base::remove( i ); }
+
+    // restore the heap order after the priority of the element at heap
+    // position i has been changed.
+
+    void update( int i )
+	{ sc_ppq_base::update( i ); }
+
     // size() and empty() are inherited.
 };
 
@@ -31,6 +31,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <mutex>
 
 #include "sysc/kernel/sc_process.h"
 #include "sysc/kernel/sc_simcontext_int.h"
@@ -44,6 +45,37 @@ namespace sc_core {
 
 int sc_report_handler::verbosity_level = SC_MEDIUM;
 
+// serializes the reports of method processes evaluated concurrently, see
+// sc_set_parallel_method_workers(); it is only locked during a concurrent
+// evaluation, reports from the simulator thread alone don't pay for it
+// (the initialization of the function-local static is thread-safe, the
+// mutex is recursive for reports issued by report handlers)
+static std::recursive_mutex&
+report_mutex()
+{
+    static std::recursive_mutex mutex;
+    return mutex;
+}
+
+// true while methods are evaluated concurrently (without creating a
+// simulation context for reports issued before or after the simulation)
+static bool
+report_concurrently()
+{
+    return sc_curr_simcontext && sc_curr_simcontext->concurrent_evaluation();
+}
+
+// sc_stop() changes the kernel state, it is not available to methods
+// evaluated concurrently: the report fails the method instead, and its
+// error is propagated after the concurrent evaluation
+static sc_actions
+report_concurrent_actions( sc_actions actions )
+{
+    if ( actions & SC_STOP )
+	actions = ( actions & ~SC_STOP ) | SC_THROW;
+    return actions;
+}
+
 // not documented, but available
 const std::string sc_report_compose_message(const sc_report& rep)
 {
@@ -331,20 +363,26 @@ void sc_report_handler::report( sc_severity severity_,
 				const char* file_, 
 				int line_ )
 {
-    sc_msg_def * md = mdlookup(msg_type_);
-
     // If the severity of the report is SC_INFO and the specified verbosity 
     // level is greater than the maximum verbosity level of the simulator then 
     // return without any action.
 
     if ( (severity_ == SC_INFO) && (verbosity_ > verbosity_level) ) return;
 
+    bool concurrent = report_concurrently();
+    std::unique_lock<std::recursive_mutex> lock;
+    if ( concurrent )
+	lock = std::unique_lock<std::recursive_mutex>( report_mutex() );
+    sc_msg_def * md = mdlookup(msg_type_);
+
     // Process the report:
 
     if ( !md )
 	md = add_msg_type(msg_type_);
 
     sc_actions actions = execute(md, severity_);
+    if ( concurrent )
+	actions = report_concurrent_actions( actions );
     sc_report rep(severity_, md, msg_, file_, line_, verbosity_);
 
     if ( actions & SC_CACHE_REPORT )
@@ -359,13 +397,17 @@ void sc_report_handler::report(sc_severity severity_,
 			       const char * file_,
 			       int line_)
 {
-    sc_msg_def * md = mdlookup(msg_type_);
-
     // If the severity of the report is SC_INFO and the maximum verbosity
     // level is less than SC_MEDIUM return without any action.
 
     if ( (severity_ == SC_INFO) && (SC_MEDIUM > verbosity_level) ) return;
 
+    bool concurrent = report_concurrently();
+    std::unique_lock<std::recursive_mutex> lock;
+    if ( concurrent )
+	lock = std::unique_lock<std::recursive_mutex>( report_mutex() );
+    sc_msg_def * md = mdlookup(msg_type_);
+
     // Process the report:
 
 
@@ -373,6 +415,8 @@ void sc_report_handler::report(sc_severity severity_,
 	md = add_msg_type(msg_type_);
 
     sc_actions actions = execute(md, severity_);
+    if ( concurrent )
+	actions = report_concurrent_actions( actions );
     sc_report rep(severity_, md, msg_, file_, line_);
 
     if ( actions & SC_CACHE_REPORT )
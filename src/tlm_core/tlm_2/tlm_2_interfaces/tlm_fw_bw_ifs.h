@@ -56,6 +56,63 @@ public:
                            sc_core::sc_time& t) = 0;
 };
 
+//////////////////////////////////////////////////////////////////////////
+// Optional interface for blocking transport of several transactions
+//////////////////////////////////////////////////////////////////////////
+//
+// This interface is not part of tlm_fw_transport_if. A target may implement
+// it in addition to the forward interface to accept a batch of transactions
+// with a single interface method call, e.g. the bursts of a streaming DMA.
+//
+// Semantics:
+// - b_transport_batch(trans, count, t) is equivalent to calling
+//   b_transport(*trans[i], t) for i = 0 .. count-1 in this order, with the
+//   same time annotation 't' passed from one transaction to the next.
+// - The target may wait, as for b_transport. The initiator must not reuse
+//   any of the transactions before the call returns.
+// - Initiators call tlm_b_transport_batch(), which falls back to one
+//   b_transport call per transaction if the target does not implement the
+//   interface.
+//
+template <typename TRANS = tlm_generic_payload>
+class tlm_blocking_transport_batch_if : public virtual sc_core::sc_interface {
+public:
+  virtual void b_transport_batch(TRANS* const* trans,
+                                 unsigned int count,
+                                 sc_core::sc_time& t) = 0;
+};
+
+// default adapter: transport a batch through a target that may or may not
+// implement tlm_blocking_transport_batch_if
+template <typename TRANS>
+inline void
+tlm_b_transport_batch(tlm_blocking_transport_if<TRANS>& fw,
+                      tlm_blocking_transport_batch_if<TRANS>* batch_if,
+                      TRANS* const* trans,
+                      unsigned int count,
+                      sc_core::sc_time& t)
+{
+  if (batch_if) {
+    batch_if->b_transport_batch(trans, count, t);
+    return;
+  }
+  for (unsigned int i = 0; i < count; ++i) {
+    fw.b_transport(*trans[i], t);
+  }
+}
+
+template <typename TRANS>
+inline void
+tlm_b_transport_batch(tlm_blocking_transport_if<TRANS>& fw,
+                      TRANS* const* trans,
+                      unsigned int count,
+                      sc_core::sc_time& t)
+{
+  tlm_b_transport_batch(fw,
+                        dynamic_cast<tlm_blocking_transport_batch_if<TRANS>*>(&fw),
+                        trans, count, t);
+}
+
 //////////////////////////////////////////////////////////////////////////
 // DMI interfaces for getting and invalidating DMI pointers:
 //////////////////////////////////////////////////////////////////////////
@@ -202,13 +202,20 @@ class tlm_initiator_socket :
                                     tlm_fw_transport_if<TYPES>,
                                     tlm_bw_transport_if<TYPES>,
                                     N, POL> base_socket_type;
+  typedef typename TYPES::tlm_payload_type                transaction_type;
+  typedef tlm_fw_transport_if<TYPES>                      fw_if_type;
+  typedef tlm_blocking_transport_batch_if<transaction_type> batch_if_type;
 public:
   tlm_initiator_socket()
     : base_socket_type()
+    , m_batch_fw(0)
+    , m_batch_if(0)
   {}
 
   explicit tlm_initiator_socket(const char* name)
     : base_socket_type(name)
+    , m_batch_fw(0)
+    , m_batch_if(0)
   {}
 
   virtual const char* kind() const
@@ -216,6 +223,29 @@ public:
     return "tlm_initiator_socket";
   }
 
+  //
+  // Blocking transport of several transactions through the target bound
+  // to the given index, see tlm_blocking_transport_batch_if
+  // - Targets not implementing the batch interface receive one b_transport
+  //   call per transaction
+  //
+  void b_transport_batch(transaction_type* const* trans,
+                         unsigned int count,
+                         sc_core::sc_time& t,
+                         int index = 0)
+  {
+    fw_if_type* fw = (*this)[index];
+    if (fw != m_batch_fw) {
+      // remember the batch interface of the last target called
+      m_batch_fw = fw;
+      m_batch_if = dynamic_cast<batch_if_type*>(fw);
+    }
+    tlm_b_transport_batch(*fw, m_batch_if, trans, count, t);
+  }
+
+private:
+  fw_if_type*    m_batch_fw;
+  batch_if_type* m_batch_if;
 };
 
 } // namespace tlm
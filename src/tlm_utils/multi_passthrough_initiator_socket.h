@@ -245,6 +245,13 @@ public:
   //get access to sub port
   tlm::tlm_fw_transport_if<TYPES>* operator[](int i){return m_used_sockets[i];}
 
+  //blocking transport of several transactions through sub port i
+  // (see tlm::tlm_blocking_transport_batch_if)
+  void b_transport_batch(transaction_type* const* trans, unsigned int count,
+                         sc_core::sc_time& t, int i = 0){
+    tlm::tlm_b_transport_batch(*m_used_sockets[i], trans, count, t);
+  }
+
   //get the number of bound targets
   // NOTE: this is only valid at end of elaboration!
   unsigned int size() {return get_hierarch_bind()->get_sockets().size();}
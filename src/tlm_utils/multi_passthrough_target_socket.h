@@ -62,6 +62,7 @@ public:
   //  typedefs to keep the fn ptr notations short
   typedef sync_enum_type (MODULE::*nb_cb)(int, transaction_type&, phase_type&, sc_core::sc_time&);
   typedef void (MODULE::*b_cb)(int, transaction_type&, sc_core::sc_time&);
+  typedef void (MODULE::*b_batch_cb)(int, transaction_type* const*, unsigned int, sc_core::sc_time&);
   typedef unsigned int (MODULE::*dbg_cb)(int, transaction_type& txn);
   typedef bool (MODULE::*dmi_cb)(int, transaction_type& txn, tlm::tlm_dmi& dmi);
 
@@ -147,6 +148,23 @@ public:
     m_b_f.set_function(mod, cb);
   }
 
+  //register the optional callback for blocking transport of several
+  // transactions (see tlm::tlm_blocking_transport_batch_if)
+  void register_b_transport_batch(MODULE* mod,
+                                  b_batch_cb cb)
+  {
+    check_export_binding();
+
+    //warn if there already is a callback
+    if (m_b_batch_f.is_valid()){
+      display_warning("BTransportBatch callback already registered.");
+      return;
+    }
+
+    //set the functor
+    m_b_batch_f.set_function(mod, cb);
+  }
+
   //register callback for debug transport of fw interface
   void register_transport_dbg(MODULE* mod,
                               dbg_cb cb)
@@ -238,6 +256,7 @@ public:
     // iterate over all binders
     for (unsigned int i=0; i<binders.size(); i++) {
       binders[i]->set_callbacks(m_nb_f, m_b_f, m_dmi_f, m_dbg_f); //set the callbacks for the binder
+      binders[i]->set_batch_callback(m_b_batch_f);
       if (multi_binds.find(i)!=multi_binds.end()) //check if this connection is multi-multi
         //if so remember the interface
         m_sockets.push_back(multi_binds[i]);
@@ -315,6 +334,7 @@ protected:
   //  the callbacks)
   typename callback_binder_fw<TYPES>::nb_func_type    m_nb_f;
   typename callback_binder_fw<TYPES>::b_func_type     m_b_f;
+  typename callback_binder_fw<TYPES>::b_batch_func_type m_b_batch_f;
   typename callback_binder_fw<TYPES>::debug_func_type m_dbg_f;
   typename callback_binder_fw<TYPES>::dmi_func_type   m_dmi_f;
 };
@@ -108,6 +108,14 @@ TLM_DEFINE_FUNCTOR(b_transport);
 #undef TLM_FULL_ARG_LIST
 #undef TLM_ARG_LIST_WITHOUT_TYPES
 
+#define TLM_RET_VAL void
+#define TLM_FULL_ARG_LIST typename TRAITS::tlm_payload_type* const* txn, unsigned int n, sc_core::sc_time& t
+#define TLM_ARG_LIST_WITHOUT_TYPES txn,n,t
+TLM_DEFINE_FUNCTOR(b_transport_batch);
+#undef TLM_RET_VAL
+#undef TLM_FULL_ARG_LIST
+#undef TLM_ARG_LIST_WITHOUT_TYPES
+
 #define TLM_RET_VAL unsigned int
 #define TLM_FULL_ARG_LIST typename TRAITS::tlm_payload_type& txn
 #define TLM_ARG_LIST_WITHOUT_TYPES txn
@@ -143,6 +151,7 @@ of the callback binder to the signature of the call.
 template <typename TYPES>
 class callback_binder_fw
   : public tlm::tlm_fw_transport_if<TYPES>
+  , public tlm::tlm_blocking_transport_batch_if<typename TYPES::tlm_payload_type>
   , protected convenience_socket_cb_holder
 {
   public:
@@ -154,13 +163,14 @@ class callback_binder_fw
     //typedefs for the callbacks
     typedef nb_transport_functor<TYPES>    nb_func_type;
     typedef b_transport_functor<TYPES>     b_func_type;
+    typedef b_transport_batch_functor<TYPES> b_batch_func_type;
     typedef debug_transport_functor<TYPES> debug_func_type;
     typedef get_dmi_ptr_functor<TYPES>     dmi_func_type;
 
     //ctor: an ID is needed to create a callback binder
     callback_binder_fw(multi_socket_base* owner, int id)
       : convenience_socket_cb_holder(owner), m_id(id)
-      , m_nb_f(0), m_b_f(0), m_dbg_f(0), m_dmi_f(0)
+      , m_nb_f(0), m_b_f(0), m_b_batch_f(0), m_dbg_f(0), m_dmi_f(0)
       , m_caller_port(0)
     {}
 
@@ -187,6 +197,18 @@ class callback_binder_fw
 
       display_error("Call to b_transport without a registered callback for b_transport.");
     }
+
+    //the optional batch interface, split into b_transport calls
+    // if no callback is registered
+    void b_transport_batch(transaction_type* const* trans, unsigned int n,
+                           sc_core::sc_time& t){
+      if (m_b_batch_f && m_b_batch_f->is_valid()) {
+        (*m_b_batch_f)(m_id, trans, n, t); //do the callback
+        return;
+      }
+
+      for (unsigned int i=0; i<n; i++) b_transport(*trans[i], t);
+    }
     
     //the DMI method of the fw interface
     bool get_direct_mem_ptr(transaction_type& trans, tlm::tlm_dmi&  dmi_data){
@@ -225,6 +247,11 @@ class callback_binder_fw
       m_dmi_f=&cb3;
       m_dbg_f=&cb4;
     }
+
+    //register the optional batch callback
+    void set_batch_callback(b_batch_func_type& cb){
+      m_b_batch_f=&cb;
+    }
     
     //getter method to get the port that is bound to that callback binder
     // NOTE: this will only return a valid value at end of elaboration
@@ -238,6 +265,7 @@ class callback_binder_fw
     //the callbacks
     nb_func_type* m_nb_f; 
     b_func_type*  m_b_f;
+    b_batch_func_type* m_b_batch_f;
     debug_func_type* m_dbg_f;
     dmi_func_type* m_dmi_f;
     
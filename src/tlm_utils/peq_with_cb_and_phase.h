@@ -30,6 +30,14 @@
 
 namespace tlm_utils {
 
+//---------------------------------------------------------------------------
+// time_ordered_list: pending timed notifications, ordered by time and
+// by insertion order for equal times
+//
+// The entries are kept in a binary heap, so insert() and delete_top()
+// take logarithmic time in the number of pending entries. Elements are
+// recycled through a free list.
+//---------------------------------------------------------------------------
 template <typename PAYLOAD>
 class time_ordered_list
 {
@@ -44,16 +52,13 @@ public:
     element(){}
   };
 
-  element *nill;
   element *empties;
-  element *list;
   unsigned int size;
 
   time_ordered_list()
-    : nill(new element()),
-      empties(NULL),
-      list(nill),
-      size(0)
+    : empties(NULL),
+      size(0),
+      seq(0)
   {
   }
 
@@ -64,7 +69,6 @@ public:
       delete empties;
       empties=e;
     }
-    delete nill;
   }
 
   void reset() {
@@ -85,30 +89,43 @@ public:
     e->t=t;
     e->d=sc_core::sc_delta_count();
 
-    struct element * ancestor=nill;
-    struct element * iterator=list;
-    while (iterator!=nill && iterator->t<=t){
-      ancestor=iterator;
-      iterator=iterator->next;
-    }
-    if (ancestor==nill){
-      e->next=list;
-      list=e;
-    }
-    else {
-      e->next=iterator;
-      ancestor->next=e;
+    // sift up
+    heap_entry entry = { t, seq++, e };
+    heap.push_back(entry);
+    unsigned int i=size++;
+    while (i > 0) {
+      unsigned int parent=(i-1)/2;
+      if (!before(entry, heap[parent]))
+        break;
+      heap[i]=heap[parent];
+      i=parent;
     }
-    size++;
+    heap[i]=entry;
   }
 
   void delete_top(){
-    if (list != nill) {
-      struct element *e=list;
-      list=list->next;
+    if (size) {
+      struct element *e=heap[0].e;
       e->next=empties;
       empties=e;
-      size--;
+
+      // sift the last entry down from the root
+      heap_entry last=heap[--size];
+      heap.pop_back();
+      if (!size) {
+        seq=0;
+        return;
+      }
+      unsigned int i=0;
+      for (unsigned int child=1; child < size; child=2*i+1) {
+        if (child+1 < size && before(heap[child+1], heap[child]))
+          ++child;
+        if (!before(heap[child], last))
+          break;
+        heap[i]=heap[child];
+        i=child;
+      }
+      heap[i]=last;
     }
   }
 
@@ -119,22 +136,42 @@ public:
 
   PAYLOAD &top()
   {
-    return list->p;
+    return heap[0].e->p;
   }
   sc_core::sc_time top_time()
   {
-    return list->t;
+    return size ? heap[0].t : sc_core::SC_ZERO_TIME;
   }
 
   sc_dt::uint64& top_delta()
   {
-    return list->d;
+    return heap[0].e->d;
   }
 
   sc_core::sc_time next_time()
   {
-    return list->next->t;
+    if (size < 2)
+      return sc_core::SC_ZERO_TIME;
+    if (size > 2 && before(heap[2], heap[1]))
+      return heap[2].t;
+    return heap[1].t;
   }
+
+private:
+  struct heap_entry
+  {
+    sc_core::sc_time t;
+    sc_dt::uint64    seq;   // insertion order for equal times
+    element*         e;
+  };
+
+  static bool before(const heap_entry& a, const heap_entry& b)
+  {
+    return a.t < b.t || (a.t == b.t && a.seq < b.seq);
+  }
+
+  std::vector<heap_entry> heap;
+  sc_dt::uint64           seq;
 };
 
 //---------------------------------------------------------------------------
@@ -26,10 +26,21 @@
 
 #include <systemc>
 //#include <tlm>
-#include <map>
+#include <vector>
 
 namespace tlm_utils {
 
+//---------------------------------------------------------------------------
+// peq_with_get: payload event queue, the payloads are fetched with
+// get_next_transaction() after the event returned by get_event() has been
+// notified
+//
+// Scheduled payloads are kept in a binary heap, ordered by time and by
+// notification order for equal times. Payloads due at the current time
+// are moved to a ready list in one go and returned from there. Both are
+// vectors that keep their capacity, so notify() does not allocate memory
+// once the queue has grown to its working size.
+//---------------------------------------------------------------------------
 template <class PAYLOAD>
 class peq_with_get : public sc_core::sc_object
 {
@@ -39,38 +50,52 @@ public:
 
 public:
   peq_with_get(const char* name) : sc_core::sc_object(name)
+    , m_ready_pos(0)
+    , m_seq(0)
+    , m_notified(sc_core::SC_ZERO_TIME)
+    , m_delta_notified(sc_core::SC_ZERO_TIME)
   {
   }
 
   void notify(transaction_type& trans, const sc_core::sc_time& t)
   {
-    m_scheduled_events.insert(pair_type(t + sc_core::sc_time_stamp(), &trans));
-    m_event.notify(t);
+    const sc_core::sc_time now = sc_core::sc_time_stamp();
+    insert(trans, t + now);
+    notify_event(t, now);
   }
 
   void notify(transaction_type& trans)
   {
-    m_scheduled_events.insert(pair_type(sc_core::sc_time_stamp(), &trans));
-    m_event.notify(); // immediate notification
+    insert(trans, sc_core::sc_time_stamp());
+    m_event.notify(); // immediate notification, cancels a pending one
+    m_notified = sc_core::SC_ZERO_TIME;
   }
 
   // needs to be called until it returns 0
   transaction_type* get_next_transaction()
   {
-    if (m_scheduled_events.empty()) {
-      return 0;
+    if (m_ready_pos == m_ready.size()) {
+      m_ready.clear();
+      m_ready_pos = 0;
+
+      if (m_scheduled.empty()) {
+        return 0;
+      }
+
+      // move all due payloads to the ready list
+      sc_core::sc_time now = sc_core::sc_time_stamp();
+      while (!m_scheduled.empty() && m_scheduled.front().t <= now) {
+        m_ready.push_back(m_scheduled.front().trans);
+        delete_top();
+      }
+
+      if (m_ready.empty()) {
+        notify_event(m_scheduled.front().t - now, now);
+        return 0;
+      }
     }
 
-    sc_core::sc_time now = sc_core::sc_time_stamp();
-    if (m_scheduled_events.begin()->first <= now) {
-      transaction_type* trans = m_scheduled_events.begin()->second;
-      m_scheduled_events.erase(m_scheduled_events.begin());
-      return trans;
-    }
-
-    m_event.notify(m_scheduled_events.begin()->first - now);
-
-    return 0;
+    return m_ready[m_ready_pos++];
   }
 
   sc_core::sc_event& get_event()
@@ -80,13 +105,90 @@ public:
 
   // Cancel all events from the event queue
   void cancel_all() {
-    m_scheduled_events.clear();
+    m_scheduled.clear();
+    m_ready.clear();
+    m_ready_pos = 0;
+    m_seq = 0;
     m_event.cancel();
+    m_notified = sc_core::SC_ZERO_TIME;
+  }
+
+private:
+  struct entry
+  {
+    sc_core::sc_time  t;
+    sc_dt::uint64     seq;   // notification order for equal times
+    transaction_type* trans;
+  };
+
+  static bool before(const entry& a, const entry& b)
+  {
+    return a.t < b.t || (a.t == b.t && a.seq < b.seq);
+  }
+
+  // notify the event unless a timed notification is known to be pending
+  // for the same or an earlier time, i.e. m_notified is later than now
+  //
+  // A delta notification replaces a pending timed one, and a timed one is
+  // ignored while a delta notification is pending. The latter cannot be
+  // told apart from one that has already happened at the current time, so
+  // timed notifications are not recorded then.
+  void notify_event(const sc_core::sc_time& delay, const sc_core::sc_time& now)
+  {
+    const sc_core::sc_time t = now + delay;
+    if (m_notified > now && t >= m_notified)
+      return;
+    m_event.notify(delay);
+    if (delay == sc_core::SC_ZERO_TIME) {
+      m_delta_notified = now;
+      m_notified = sc_core::SC_ZERO_TIME;
+    } else {
+      m_notified = m_delta_notified == now ? sc_core::SC_ZERO_TIME : t;
+    }
+  }
+
+  void insert(transaction_type& trans, const sc_core::sc_time& t)
+  {
+    entry e = { t, m_seq++, &trans };
+    m_scheduled.push_back(e);
+    std::size_t i = m_scheduled.size() - 1;
+    while (i > 0) {
+      std::size_t parent = (i - 1) / 2;
+      if (!before(e, m_scheduled[parent]))
+        break;
+      m_scheduled[i] = m_scheduled[parent];
+      i = parent;
+    }
+    m_scheduled[i] = e;
+  }
+
+  void delete_top()
+  {
+    entry last = m_scheduled.back();
+    m_scheduled.pop_back();
+    std::size_t size = m_scheduled.size();
+    if (!size)
+      return;
+    std::size_t i = 0;
+    for (std::size_t child = 1; child < size; child = 2 * i + 1) {
+      if (child + 1 < size && before(m_scheduled[child + 1], m_scheduled[child]))
+        ++child;
+      if (!before(m_scheduled[child], last))
+        break;
+      m_scheduled[i] = m_scheduled[child];
+      i = child;
+    }
+    m_scheduled[i] = last;
   }
 
 private:
-  std::multimap<const sc_core::sc_time, transaction_type*> m_scheduled_events;
-  sc_core::sc_event m_event;
+  std::vector<entry>             m_scheduled;   // heap of future payloads
+  std::vector<transaction_type*> m_ready;       // payloads due now
+  std::size_t                    m_ready_pos;   // next ready payload
+  sc_dt::uint64                  m_seq;
+  sc_core::sc_time               m_notified;    // pending timed notification, if later than now
+  sc_core::sc_time               m_delta_notified; // time of the last delta one
+  sc_core::sc_event              m_event;
 };
 
 }
@@ -22,6 +22,7 @@
 
 #include <tlm>
 #include "tlm_utils/convenience_socket_bases.h"
+#include "tlm_utils/tlm_dmi_cache.h"
 
 namespace tlm_utils {
 
@@ -64,6 +65,13 @@ public:
     m_process.set_invalidate_direct_mem_ptr(mod, cb);
   }
 
+  // invalidate_direct_mem_ptr calls drop the affected regions from the
+  // cache before the registered callback, if any, is called
+  void register_dmi_cache(tlm_dmi_cache& cache)
+  {
+    m_process.set_dmi_cache(&cache);
+  }
+
 private:
   class process
     : public tlm::tlm_bw_transport_if<TYPES>
@@ -80,6 +88,7 @@ private:
       : convenience_socket_cb_holder(owner), m_mod(0)
       , m_transport_ptr(0)
       , m_invalidate_direct_mem_ptr(0)
+      , m_dmi_cache(0)
     {
     }
 
@@ -105,6 +114,15 @@ private:
       m_invalidate_direct_mem_ptr = p;
     }
 
+    void set_dmi_cache(tlm_dmi_cache* cache)
+    {
+      if (m_dmi_cache) {
+        display_warning("DMI cache already registered");
+        return;
+      }
+      m_dmi_cache = cache;
+    }
+
     sync_enum_type nb_transport_bw(transaction_type& trans, phase_type& phase, sc_core::sc_time& t)
     {
       if (m_transport_ptr) {
@@ -119,6 +137,9 @@ private:
     void invalidate_direct_mem_ptr(sc_dt::uint64 start_range,
                                    sc_dt::uint64 end_range)
     {
+      if (m_dmi_cache) {
+        m_dmi_cache->invalidate(start_range, end_range);
+      }
       if (m_invalidate_direct_mem_ptr) {
         // forward call
         sc_assert(m_mod);
@@ -130,6 +151,7 @@ private:
     MODULE* m_mod;
     TransportPtr m_transport_ptr;
     InvalidateDirectMemPtr m_invalidate_direct_mem_ptr;
+    tlm_dmi_cache* m_dmi_cache;
   };
 
 private:
@@ -207,6 +229,13 @@ public:
     m_process.set_invalidate_dmi_user_id(id);
   }
 
+  // invalidate_direct_mem_ptr calls drop the affected regions from the
+  // cache before the registered callback, if any, is called
+  void register_dmi_cache(tlm_dmi_cache& cache)
+  {
+    m_process.set_dmi_cache(&cache);
+  }
+
 private:
   class process
     : public tlm::tlm_bw_transport_if<TYPES>
@@ -225,6 +254,7 @@ private:
       : convenience_socket_cb_holder(owner), m_mod(0)
       , m_transport_ptr(0)
       , m_invalidate_direct_mem_ptr(0)
+      , m_dmi_cache(0)
       , m_transport_user_id(0)
       , m_invalidate_direct_mem_user_id(0)
     {
@@ -255,6 +285,15 @@ private:
       m_invalidate_direct_mem_ptr = p;
     }
 
+    void set_dmi_cache(tlm_dmi_cache* cache)
+    {
+      if (m_dmi_cache) {
+        display_warning("DMI cache already registered");
+        return;
+      }
+      m_dmi_cache = cache;
+    }
+
     sync_enum_type nb_transport_bw(transaction_type& trans, phase_type& phase, sc_core::sc_time& t)
     {
       if (m_transport_ptr) {
@@ -269,6 +308,9 @@ private:
     void invalidate_direct_mem_ptr(sc_dt::uint64 start_range,
                                    sc_dt::uint64 end_range)
     {
+      if (m_dmi_cache) {
+        m_dmi_cache->invalidate(start_range, end_range);
+      }
       if (m_invalidate_direct_mem_ptr) {
         // forward call
         sc_assert(m_mod);
@@ -280,6 +322,7 @@ private:
     MODULE* m_mod;
     TransportPtr m_transport_ptr;
     InvalidateDirectMemPtr m_invalidate_direct_mem_ptr;
+    tlm_dmi_cache* m_dmi_cache;
     int m_transport_user_id;
     int m_invalidate_direct_mem_user_id;
   };
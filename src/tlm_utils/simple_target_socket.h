@@ -64,10 +64,21 @@ public:
     : base_type(n)
     , m_fw_process(this)
     , m_bw_process(this)
+    , m_free_pending(0)
   {
     bind(m_fw_process);
   }
 
+  ~simple_target_socket_b()
+  {
+    // slots still attached to a transaction are left to it
+    while (m_free_pending) {
+      pending_trans_ext* slot = m_free_pending;
+      m_free_pending = slot->m_outer;
+      delete slot;
+    }
+  }
+
   using base_type::bind;
 
   // bw transport must come thru us.
@@ -91,6 +102,18 @@ public:
     m_fw_process.set_b_transport_ptr(mod, cb);
   }
 
+  // optional: blocking transport of several transactions in one call, see
+  // tlm::tlm_blocking_transport_batch_if; without this callback, batches
+  // are split into b_transport calls
+  void register_b_transport_batch(MODULE* mod,
+                                  void (MODULE::*cb)(transaction_type* const*,
+                                                     unsigned int,
+                                                     sc_core::sc_time&))
+  {
+    elaboration_check("register_b_transport_batch");
+    m_fw_process.set_b_transport_batch_ptr(mod, cb);
+  }
+
   void register_transport_dbg(MODULE* mod,
                               unsigned int (MODULE::*cb)(transaction_type&))
   {
@@ -106,7 +129,21 @@ public:
     m_fw_process.set_get_direct_mem_ptr(mod, cb);
   }
 
+  // number of threads for the nb->b conversion to spawn at the end of
+  // elaboration, further threads are spawned on demand
+  void set_nb2b_thread_pool_size(unsigned int n)
+  {
+    elaboration_check("set_nb2b_thread_pool_size");
+    m_fw_process.set_nb2b_thread_pool_size(n);
+  }
+
 protected:
+  void end_of_elaboration()
+  {
+    base_type::end_of_elaboration();
+    m_fw_process.end_of_elaboration();
+  }
+
   void start_of_simulation()
   {
     base_type::start_of_simulation();
@@ -136,10 +173,9 @@ private:
 
     sync_enum_type nb_transport_bw(transaction_type &trans, phase_type &phase, sc_core::sc_time &t)
     {
-      typename std::map<transaction_type*, sc_core::sc_event *>::iterator it =
-        m_owner->m_pending_trans.find(&trans);
+      pending_trans_ext* pending = m_owner->get_pending(trans);
 
-      if(it == m_owner->m_pending_trans.end()) {
+      if(!pending) {
         // Not a blocking call, forward.
         return m_owner->bw_nb_transport(trans, phase, t);
 
@@ -154,8 +190,7 @@ private:
           m_owner->m_end_request.notify(sc_core::SC_ZERO_TIME);
         }
         //TODO: add response-accept delay?
-        it->second->notify(t);
-        m_owner->m_pending_trans.erase(it);
+        pending->finish(t);
         return tlm::TLM_COMPLETED;
       }
       m_owner->display_error("invalid phase received");
@@ -172,6 +207,7 @@ private:
   };
 
   class fw_process : public tlm::tlm_fw_transport_if<TYPES>,
+                    public tlm::tlm_blocking_transport_batch_if<transaction_type>,
                     public tlm::tlm_mm_interface
   {
   public:
@@ -180,6 +216,9 @@ private:
                                                      sc_core::sc_time&);
     typedef void (MODULE::*BTransportPtr)(transaction_type&,
                                           sc_core::sc_time&);
+    typedef void (MODULE::*BTransportBatchPtr)(transaction_type* const*,
+                                               unsigned int,
+                                               sc_core::sc_time&);
     typedef unsigned int (MODULE::*TransportDbgPtr)(transaction_type&);
     typedef bool (MODULE::*GetDirectMemPtr)(transaction_type&,
                                             tlm::tlm_dmi&);
@@ -189,12 +228,28 @@ private:
       m_mod(0),
       m_nb_transport_ptr(0),
       m_b_transport_ptr(0),
+      m_b_transport_batch_ptr(0),
       m_transport_dbg_ptr(0),
       m_get_direct_mem_ptr(0),
       m_peq(sc_core::sc_gen_unique_name("m_peq")),
-      m_response_in_progress(false)
+      m_response_in_progress(false),
+      m_nb2b_thread_pool_size(0)
     {}
 
+    void set_nb2b_thread_pool_size(unsigned int n)
+    {
+      m_nb2b_thread_pool_size = n;
+    }
+
+    void end_of_elaboration()
+    {
+      if (m_b_transport_ptr && !m_nb_transport_ptr) { // only spawn nb2b_threads, if needed
+        for (unsigned int i = 0; i < m_nb2b_thread_pool_size; ++i) {
+          m_process_handle.suspend_handle(spawn_nb2b_thread(0));
+        }
+      }
+    }
+
     void start_of_simulation()
     {
       if (!m_b_transport_ptr && m_nb_transport_ptr) { // only spawn b2nb_thread, if needed
@@ -228,6 +283,17 @@ private:
       m_b_transport_ptr = p;
     }
 
+    void set_b_transport_batch_ptr(MODULE* mod, BTransportBatchPtr p)
+    {
+      if (m_b_transport_batch_ptr) {
+        m_owner->display_warning("blocking batch callback already registered");
+        return;
+      }
+      sc_assert(!m_mod || m_mod == mod);
+      m_mod = mod;
+      m_b_transport_batch_ptr = p;
+    }
+
     void set_transport_dbg_ptr(MODULE* mod, TransportDbgPtr p)
     {
       if (m_transport_dbg_ptr) {
@@ -267,17 +333,7 @@ private:
           process_handle_class * ph = m_process_handle.get_handle(&trans);
 
           if (!ph) { // create new dynamic process
-            sc_core::sc_hierarchy_scope scope( m_owner->get_hierarchy_scope() );
-
-            ph = new process_handle_class(&trans);
-            m_process_handle.put_handle(ph);
-
-            sc_core::sc_spawn_options opts;
-            opts.dont_initialize();
-            opts.set_sensitivity(&ph->m_e);
-
-            sc_core::sc_spawn(sc_bind(&fw_process::nb2b_thread,this, ph),
-                            sc_core::sc_gen_unique_name("nb2b_thread"), &opts);
+            ph = spawn_nb2b_thread(&trans);
           }
 
           ph->m_e.notify(t);
@@ -319,9 +375,9 @@ private:
         }
 
         // wait until transaction is finished
-        sc_core::sc_event end_event;
-        m_owner->m_pending_trans[&trans] = &end_event;
-        sc_core::wait(end_event);
+        pending_trans_ext* pending = m_owner->attach_pending(trans);
+        sc_core::wait(pending->m_done);
+        m_owner->detach_pending(trans, pending);
 
         if (mm_added) {
           // release will not delete the transaction, it will notify mm_ext.done
@@ -338,6 +394,23 @@ private:
       m_owner->display_error("no blocking transport callback registered");
     }
 
+    void b_transport_batch(transaction_type* const* trans,
+                           unsigned int count,
+                           sc_core::sc_time& t)
+    {
+      if (m_b_transport_batch_ptr) {
+        // forward call
+        sc_assert(m_mod);
+        (m_mod->*m_b_transport_batch_ptr)(trans, count, t);
+        return;
+      }
+
+      // one transaction after the other, incl. b->nb conversion
+      for (unsigned int i = 0; i < count; ++i) {
+        b_transport(*trans[i], t);
+      }
+    }
+
     unsigned int transport_dbg(transaction_type& trans)
     {
       if (m_transport_dbg_ptr) {
@@ -371,16 +444,16 @@ private:
     class process_handle_class {
     public:
       explicit process_handle_class(transaction_type * trans)
-        : m_trans(trans),m_suspend(false) {}
+        : m_trans(trans), m_next(0) {}
 
-      transaction_type*  m_trans;
-      sc_core::sc_event  m_e;
-      bool m_suspend;
+      transaction_type*     m_trans;
+      sc_core::sc_event     m_e;
+      process_handle_class* m_next; // next suspended process
     };
 
     class process_handle_list {
     public:
-      process_handle_list() {}
+      process_handle_list() : m_suspended(0) {}
 
       ~process_handle_list() {
         for( typename std::vector<process_handle_class*>::iterator
@@ -390,16 +463,13 @@ private:
 
       process_handle_class* get_handle(transaction_type *trans)
       {
-        typename std::vector<process_handle_class*>::iterator it;
-
-        for(it = v.begin(); it != v.end(); it++) {
-          if ((*it)->m_suspend) {  // found suspended dynamic process, re-use it
-            (*it)->m_trans   = trans; // replace to new one
-            (*it)->m_suspend = false;
-            return *it;
-          }
+        process_handle_class* ph = m_suspended;
+        if (ph) {  // found suspended dynamic process, re-use it
+          m_suspended = ph->m_next;
+          ph->m_trans = trans; // replace to new one
+          ph->m_next  = 0;
         }
-        return NULL; // no suspended process
+        return ph; // NULL, if no suspended process
       }
 
       void put_handle(process_handle_class* ph)
@@ -407,12 +477,36 @@ private:
         v.push_back(ph);
       }
 
+      // the process waits for its next transaction
+      void suspend_handle(process_handle_class* ph)
+      {
+        ph->m_next  = m_suspended;
+        m_suspended = ph;
+      }
+
     private:
       std::vector<process_handle_class*> v;
+      process_handle_class* m_suspended; // free list of suspended processes
     };
 
     process_handle_list m_process_handle;
 
+    process_handle_class* spawn_nb2b_thread(transaction_type* trans)
+    {
+      sc_core::sc_hierarchy_scope scope( m_owner->get_hierarchy_scope() );
+
+      process_handle_class* ph = new process_handle_class(trans);
+      m_process_handle.put_handle(ph);
+
+      sc_core::sc_spawn_options opts;
+      opts.dont_initialize();
+      opts.set_sensitivity(&ph->m_e);
+
+      sc_core::sc_spawn(sc_bind(&fw_process::nb2b_thread, this, ph),
+                        sc_core::sc_gen_unique_name("nb2b_thread"), &opts);
+      return ph;
+    }
+
 
     void nb2b_thread(process_handle_class* h)
     {
@@ -440,7 +534,7 @@ private:
         }
 
         // suspend until next transaction
-        h->m_suspend = true;
+        m_process_handle.suspend_handle(h);
         sc_core::wait();
       }
     }
@@ -459,11 +553,9 @@ private:
           case tlm::TLM_COMPLETED:
           {
             // notify transaction is finished
-            typename std::map<transaction_type*, sc_core::sc_event *>::iterator it =
-              m_owner->m_pending_trans.find(trans);
-            sc_assert(it != m_owner->m_pending_trans.end());
-            it->second->notify(t);
-            m_owner->m_pending_trans.erase(it);
+            pending_trans_ext* pending = m_owner->get_pending(*trans);
+            sc_assert(pending);
+            pending->finish(t);
             break;
           }
 
@@ -488,11 +580,9 @@ private:
               (m_mod->*m_nb_transport_ptr)(*trans, phase, t);
 
               // notify transaction is finished
-              typename std::map<transaction_type*, sc_core::sc_event *>::iterator it =
-                m_owner->m_pending_trans.find(trans);
-              sc_assert(it != m_owner->m_pending_trans.end());
-              it->second->notify(t);
-              m_owner->m_pending_trans.erase(it);
+              pending_trans_ext* pending = m_owner->get_pending(*trans);
+              sc_assert(pending);
+              pending->finish(t);
               break;
             }
 
@@ -532,19 +622,84 @@ private:
     MODULE* m_mod;
     NBTransportPtr m_nb_transport_ptr;
     BTransportPtr m_b_transport_ptr;
+    BTransportBatchPtr m_b_transport_batch_ptr;
     TransportDbgPtr m_transport_dbg_ptr;
     GetDirectMemPtr m_get_direct_mem_ptr;
     peq_with_get<transaction_type> m_peq;
     bool m_response_in_progress;
     sc_core::sc_event m_end_response;
+    unsigned int m_nb2b_thread_pool_size;
   };
 
 private:
   const sc_core::sc_object* get_socket() const { return this; }
+
+  // marks a transaction waiting in b_transport for the b->nb conversion of
+  // this socket; the slots are pooled by the socket and chained in the
+  // transaction, if it passes through several sockets of this type
+  struct pending_trans_ext : public tlm::tlm_extension<pending_trans_ext>
+  {
+    pending_trans_ext() : m_owner(0), m_outer(0) {}
+    tlm::tlm_extension_base* clone() const { return NULL; }
+    void free() {}
+    void copy_from(tlm::tlm_extension_base const &) {}
+
+    // notify the waiting b_transport call, the transaction is no
+    // longer pending afterwards
+    void finish(const sc_core::sc_time& t)
+    {
+      m_done.notify(t);
+      m_owner = 0;
+    }
+
+    const sc_core::sc_object* m_owner;
+    pending_trans_ext* m_outer; // next slot in the transaction or free list
+    sc_core::sc_event m_done;
+  };
+
+  pending_trans_ext* attach_pending(transaction_type& trans)
+  {
+    pending_trans_ext* slot = m_free_pending;
+    if (slot) {
+      m_free_pending = slot->m_outer;
+    } else {
+      slot = new pending_trans_ext;
+    }
+    slot->m_owner = this;
+    slot->m_outer = trans.set_extension(slot);
+    return slot;
+  }
+
+  pending_trans_ext* get_pending(transaction_type& trans) const
+  {
+    pending_trans_ext* slot = trans.template get_extension<pending_trans_ext>();
+    while (slot && slot->m_owner != this) {
+      slot = slot->m_outer;
+    }
+    return slot;
+  }
+
+  void detach_pending(transaction_type& trans, pending_trans_ext* slot)
+  {
+    pending_trans_ext* head = trans.template get_extension<pending_trans_ext>();
+    if (head == slot) {
+      trans.set_extension(slot->m_outer);
+    } else {
+      while (head && head->m_outer != slot) {
+        head = head->m_outer;
+      }
+      if (head) {
+        head->m_outer = slot->m_outer;
+      }
+    }
+    slot->m_outer = m_free_pending;
+    m_free_pending = slot;
+  }
+
 private:
   fw_process m_fw_process;
   bw_process m_bw_process;
-  std::map<transaction_type*, sc_core::sc_event *> m_pending_trans;
+  pending_trans_ext* m_free_pending; // slots not attached to a transaction
   sc_core::sc_event m_end_request;
   transaction_type* m_current_transaction = nullptr;
 };
@@ -596,10 +751,21 @@ public:
     : base_type(n)
     , m_fw_process(this)
     , m_bw_process(this)
+    , m_free_pending(0)
   {
     bind(m_fw_process);
   }
 
+  ~simple_target_socket_tagged_b()
+  {
+    // slots still attached to a transaction are left to it
+    while (m_free_pending) {
+      pending_trans_ext* slot = m_free_pending;
+      m_free_pending = slot->m_outer;
+      delete slot;
+    }
+  }
+
   using base_type::bind;
 
   // bw transport must come thru us.
@@ -629,6 +795,21 @@ public:
     m_fw_process.set_b_transport_user_id(id);
   }
 
+  // optional: blocking transport of several transactions in one call, see
+  // tlm::tlm_blocking_transport_batch_if; without this callback, batches
+  // are split into b_transport calls
+  void register_b_transport_batch(MODULE* mod,
+                                  void (MODULE::*cb)(int id,
+                                                     transaction_type* const*,
+                                                     unsigned int,
+                                                     sc_core::sc_time&),
+                                  int id)
+  {
+    elaboration_check("register_b_transport_batch");
+    m_fw_process.set_b_transport_batch_ptr(mod, cb);
+    m_fw_process.set_b_transport_batch_user_id(id);
+  }
+
   void register_transport_dbg(MODULE* mod,
                               unsigned int (MODULE::*cb)(int id,
                                                          transaction_type&),
@@ -650,7 +831,21 @@ public:
     m_fw_process.set_get_dmi_user_id(id);
   }
 
+  // number of threads for the nb->b conversion to spawn at the end of
+  // elaboration, further threads are spawned on demand
+  void set_nb2b_thread_pool_size(unsigned int n)
+  {
+    elaboration_check("set_nb2b_thread_pool_size");
+    m_fw_process.set_nb2b_thread_pool_size(n);
+  }
+
 protected:
+  void end_of_elaboration()
+  {
+    base_type::end_of_elaboration();
+    m_fw_process.end_of_elaboration();
+  }
+
   void start_of_simulation()
   {
     base_type::start_of_simulation();
@@ -680,10 +875,9 @@ private:
 
     sync_enum_type nb_transport_bw(transaction_type &trans, phase_type &phase, sc_core::sc_time &t)
     {
-      typename std::map<transaction_type*, sc_core::sc_event *>::iterator it =
-        m_owner->m_pending_trans.find(&trans);
+      pending_trans_ext* pending = m_owner->get_pending(trans);
 
-      if(it == m_owner->m_pending_trans.end()) {
+      if(!pending) {
         // Not a blocking call, forward.
         return m_owner->bw_nb_transport(trans, phase, t);
       }
@@ -696,8 +890,7 @@ private:
           m_owner->m_end_request.notify(sc_core::SC_ZERO_TIME);
         }
         //TODO: add response-accept delay?
-        it->second->notify(t);
-        m_owner->m_pending_trans.erase(it);
+        pending->finish(t);
         return tlm::TLM_COMPLETED;
       }
       m_owner->display_error("invalid phase received");
@@ -714,6 +907,7 @@ private:
   };
 
   class fw_process : public tlm::tlm_fw_transport_if<TYPES>,
+                     public tlm::tlm_blocking_transport_batch_if<transaction_type>,
                      public tlm::tlm_mm_interface
   {
   public:
@@ -724,6 +918,10 @@ private:
     typedef void (MODULE::*BTransportPtr)(int id,
                                           transaction_type&,
                                           sc_core::sc_time&);
+    typedef void (MODULE::*BTransportBatchPtr)(int id,
+                                               transaction_type* const*,
+                                               unsigned int,
+                                               sc_core::sc_time&);
     typedef unsigned int (MODULE::*TransportDbgPtr)(int id,
                                                     transaction_type&);
     typedef bool (MODULE::*GetDirectMemPtr)(int id,
@@ -735,16 +933,33 @@ private:
       m_mod(0),
       m_nb_transport_ptr(0),
       m_b_transport_ptr(0),
+      m_b_transport_batch_ptr(0),
       m_transport_dbg_ptr(0),
       m_get_direct_mem_ptr(0),
       m_nb_transport_user_id(0),
       m_b_transport_user_id(0),
+      m_b_transport_batch_user_id(0),
       m_transport_dbg_user_id(0),
       m_get_dmi_user_id(0),
       m_peq(sc_core::sc_gen_unique_name("m_peq")),
-      m_response_in_progress(false)
+      m_response_in_progress(false),
+      m_nb2b_thread_pool_size(0)
     {}
 
+    void set_nb2b_thread_pool_size(unsigned int n)
+    {
+      m_nb2b_thread_pool_size = n;
+    }
+
+    void end_of_elaboration()
+    {
+      if (m_b_transport_ptr && !m_nb_transport_ptr) { // only spawn nb2b_threads, if needed
+        for (unsigned int i = 0; i < m_nb2b_thread_pool_size; ++i) {
+          m_process_handle.suspend_handle(spawn_nb2b_thread(0));
+        }
+      }
+    }
+
     void start_of_simulation()
     {
       if (!m_b_transport_ptr && m_nb_transport_ptr) { // only spawn b2nb_thread, if needed
@@ -758,6 +973,7 @@ private:
 
     void set_nb_transport_user_id(int id) { m_nb_transport_user_id = id; }
     void set_b_transport_user_id(int id) { m_b_transport_user_id = id; }
+    void set_b_transport_batch_user_id(int id) { m_b_transport_batch_user_id = id; }
     void set_transport_dbg_user_id(int id) { m_transport_dbg_user_id = id; }
     void set_get_dmi_user_id(int id) { m_get_dmi_user_id = id; }
 
@@ -783,6 +999,17 @@ private:
       m_b_transport_ptr = p;
     }
 
+    void set_b_transport_batch_ptr(MODULE* mod, BTransportBatchPtr p)
+    {
+      if (m_b_transport_batch_ptr) {
+        m_owner->display_warning("blocking batch callback already registered");
+        return;
+      }
+      sc_assert(!m_mod || m_mod == mod);
+      m_mod = mod;
+      m_b_transport_batch_ptr = p;
+    }
+
     void set_transport_dbg_ptr(MODULE* mod, TransportDbgPtr p)
     {
       if (m_transport_dbg_ptr) {
@@ -822,15 +1049,7 @@ private:
           process_handle_class * ph = m_process_handle.get_handle(&trans);
 
           if (!ph) { // create new dynamic process
-            ph = new process_handle_class(&trans);
-            m_process_handle.put_handle(ph);
-
-            sc_core::sc_spawn_options opts;
-            opts.dont_initialize();
-            opts.set_sensitivity(&ph->m_e);
-
-            sc_core::sc_spawn(sc_bind(&fw_process::nb2b_thread, this, ph),
-                            sc_core::sc_gen_unique_name("nb2b_thread"), &opts);
+            ph = spawn_nb2b_thread(&trans);
           }
 
           ph->m_e.notify(t);
@@ -873,9 +1092,9 @@ private:
         }
 
         // wait until transaction is finished
-        sc_core::sc_event end_event;
-        m_owner->m_pending_trans[&trans] = &end_event;
-        sc_core::wait(end_event);
+        pending_trans_ext* pending = m_owner->attach_pending(trans);
+        sc_core::wait(pending->m_done);
+        m_owner->detach_pending(trans, pending);
 
         if (mm_added) {
           // release will not delete the transaction, it will notify mm_ext.done
@@ -891,6 +1110,23 @@ private:
       m_owner->display_error("no transport callback registered");
     }
 
+    void b_transport_batch(transaction_type* const* trans,
+                           unsigned int count,
+                           sc_core::sc_time& t)
+    {
+      if (m_b_transport_batch_ptr) {
+        // forward call
+        sc_assert(m_mod);
+        (m_mod->*m_b_transport_batch_ptr)(m_b_transport_batch_user_id, trans, count, t);
+        return;
+      }
+
+      // one transaction after the other, incl. b->nb conversion
+      for (unsigned int i = 0; i < count; ++i) {
+        b_transport(*trans[i], t);
+      }
+    }
+
     unsigned int transport_dbg(transaction_type& trans)
     {
       if (m_transport_dbg_ptr) {
@@ -923,16 +1159,16 @@ private:
     class process_handle_class {
     public:
       explicit process_handle_class(transaction_type * trans)
-        : m_trans(trans),m_suspend(false){}
+        : m_trans(trans), m_next(0) {}
 
-      transaction_type*  m_trans;
-      sc_core::sc_event  m_e;
-      bool m_suspend;
+      transaction_type*     m_trans;
+      sc_core::sc_event     m_e;
+      process_handle_class* m_next; // next suspended process
     };
 
     class process_handle_list {
     public:
-      process_handle_list() {}
+      process_handle_list() : m_suspended(0) {}
 
       ~process_handle_list() {
         for( typename std::vector<process_handle_class*>::iterator
@@ -942,16 +1178,13 @@ private:
 
       process_handle_class* get_handle(transaction_type *trans)
       {
-        typename std::vector<process_handle_class*>::iterator it;
-
-        for(it = v.begin(); it != v.end(); it++) {
-          if ((*it)->m_suspend) {  // found suspended dynamic process, re-use it
-            (*it)->m_trans   = trans; // replace to new one
-            (*it)->m_suspend = false;
-            return *it;
-          }
+        process_handle_class* ph = m_suspended;
+        if (ph) {  // found suspended dynamic process, re-use it
+          m_suspended = ph->m_next;
+          ph->m_trans = trans; // replace to new one
+          ph->m_next  = 0;
         }
-        return NULL; // no suspended process
+        return ph; // NULL, if no suspended process
       }
 
       void put_handle(process_handle_class* ph)
@@ -959,12 +1192,36 @@ private:
         v.push_back(ph);
       }
 
+      // the process waits for its next transaction
+      void suspend_handle(process_handle_class* ph)
+      {
+        ph->m_next  = m_suspended;
+        m_suspended = ph;
+      }
+
     private:
       std::vector<process_handle_class*> v;
+      process_handle_class* m_suspended; // free list of suspended processes
     };
 
     process_handle_list m_process_handle;
 
+    process_handle_class* spawn_nb2b_thread(transaction_type* trans)
+    {
+      sc_core::sc_hierarchy_scope scope( m_owner->get_hierarchy_scope() );
+
+      process_handle_class* ph = new process_handle_class(trans);
+      m_process_handle.put_handle(ph);
+
+      sc_core::sc_spawn_options opts;
+      opts.dont_initialize();
+      opts.set_sensitivity(&ph->m_e);
+
+      sc_core::sc_spawn(sc_bind(&fw_process::nb2b_thread, this, ph),
+                        sc_core::sc_gen_unique_name("nb2b_thread"), &opts);
+      return ph;
+    }
+
     void nb2b_thread(process_handle_class* h)
     {
 
@@ -991,7 +1248,7 @@ private:
         }
 
         // suspend until next transaction
-        h->m_suspend = true;
+        m_process_handle.suspend_handle(h);
         sc_core::wait();
       }
     }
@@ -1010,11 +1267,9 @@ private:
           case tlm::TLM_COMPLETED:
           {
             // notify transaction is finished
-            typename std::map<transaction_type*, sc_core::sc_event *>::iterator it =
-              m_owner->m_pending_trans.find(trans);
-            sc_assert(it != m_owner->m_pending_trans.end());
-            it->second->notify(t);
-            m_owner->m_pending_trans.erase(it);
+            pending_trans_ext* pending = m_owner->get_pending(*trans);
+            sc_assert(pending);
+            pending->finish(t);
             break;
           }
 
@@ -1039,11 +1294,9 @@ private:
               (m_mod->*m_nb_transport_ptr)(m_nb_transport_user_id, *trans, phase, t);
 
               // notify transaction is finished
-              typename std::map<transaction_type*, sc_core::sc_event *>::iterator it =
-                m_owner->m_pending_trans.find(trans);
-              sc_assert(it != m_owner->m_pending_trans.end());
-              it->second->notify(t);
-              m_owner->m_pending_trans.erase(it);
+              pending_trans_ext* pending = m_owner->get_pending(*trans);
+              sc_assert(pending);
+              pending->finish(t);
               break;
             }
 
@@ -1083,23 +1336,89 @@ private:
     MODULE* m_mod;
     NBTransportPtr m_nb_transport_ptr;
     BTransportPtr m_b_transport_ptr;
+    BTransportBatchPtr m_b_transport_batch_ptr;
     TransportDbgPtr m_transport_dbg_ptr;
     GetDirectMemPtr m_get_direct_mem_ptr;
     int m_nb_transport_user_id;
     int m_b_transport_user_id;
+    int m_b_transport_batch_user_id;
     int m_transport_dbg_user_id;
     int m_get_dmi_user_id;
     peq_with_get<transaction_type> m_peq;
     bool m_response_in_progress;
     sc_core::sc_event m_end_response;
+    unsigned int m_nb2b_thread_pool_size;
   };
 
 private:
   const sc_core::sc_object* get_socket() const { return this; }
+
+  // marks a transaction waiting in b_transport for the b->nb conversion of
+  // this socket; the slots are pooled by the socket and chained in the
+  // transaction, if it passes through several sockets of this type
+  struct pending_trans_ext : public tlm::tlm_extension<pending_trans_ext>
+  {
+    pending_trans_ext() : m_owner(0), m_outer(0) {}
+    tlm::tlm_extension_base* clone() const { return NULL; }
+    void free() {}
+    void copy_from(tlm::tlm_extension_base const &) {}
+
+    // notify the waiting b_transport call, the transaction is no
+    // longer pending afterwards
+    void finish(const sc_core::sc_time& t)
+    {
+      m_done.notify(t);
+      m_owner = 0;
+    }
+
+    const sc_core::sc_object* m_owner;
+    pending_trans_ext* m_outer; // next slot in the transaction or free list
+    sc_core::sc_event m_done;
+  };
+
+  pending_trans_ext* attach_pending(transaction_type& trans)
+  {
+    pending_trans_ext* slot = m_free_pending;
+    if (slot) {
+      m_free_pending = slot->m_outer;
+    } else {
+      slot = new pending_trans_ext;
+    }
+    slot->m_owner = this;
+    slot->m_outer = trans.set_extension(slot);
+    return slot;
+  }
+
+  pending_trans_ext* get_pending(transaction_type& trans) const
+  {
+    pending_trans_ext* slot = trans.template get_extension<pending_trans_ext>();
+    while (slot && slot->m_owner != this) {
+      slot = slot->m_outer;
+    }
+    return slot;
+  }
+
+  void detach_pending(transaction_type& trans, pending_trans_ext* slot)
+  {
+    pending_trans_ext* head = trans.template get_extension<pending_trans_ext>();
+    if (head == slot) {
+      trans.set_extension(slot->m_outer);
+    } else {
+      while (head && head->m_outer != slot) {
+        head = head->m_outer;
+      }
+      if (head) {
+        head->m_outer = slot->m_outer;
+      }
+    }
+    slot->m_outer = m_free_pending;
+    m_free_pending = slot;
+  }
+
 private:
   fw_process m_fw_process;
   bw_process m_bw_process;
-  std::map<transaction_type*, sc_core::sc_event *> m_pending_trans;
+  pending_trans_ext* m_free_pending; // slots not attached to a transaction
   sc_core::sc_event m_end_request;
   transaction_type* m_current_transaction = nullptr;
 };
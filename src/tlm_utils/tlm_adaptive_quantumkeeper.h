@@ -0,0 +1,205 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+#ifndef TLM_UTILS_TLM_ADAPTIVE_QUANTUMKEEPER_H_INCLUDED_
+#define TLM_UTILS_TLM_ADAPTIVE_QUANTUMKEEPER_H_INCLUDED_
+
+#include "tlm_utils/tlm_quantumkeeper.h"
+
+#include <chrono>
+
+namespace tlm_utils {
+
+  //
+  // tlm_adaptive_quantumkeeper class
+  //
+  // A tlm_quantumkeeper that records synchronization statistics of its
+  // initiator and can adapt the quantum of the initiator at run time.
+  //
+  // Statistics: the number of syncs, the time the local time overshot the
+  // sync point when sync() was called, the simulated time waited in sync()
+  // and the host time spent in these waits.
+  //
+  // Adaptation is enabled by set_quantum_bounds(). Whenever another
+  // component observes state that this initiator has not updated yet
+  // because it runs ahead, e.g. a shared target seeing accesses out of
+  // time order, it calls report_stale_access(). At each reset() the
+  // quantum is halved if stale accesses were reported since the previous
+  // reset, and grown by a quarter otherwise, within the bounds. Sync
+  // points are aligned to multiples of the current quantum. Derived
+  // classes may override adapt_quantum() to use another policy.
+  //
+  class tlm_adaptive_quantumkeeper : public tlm_quantumkeeper
+  {
+  public:
+    tlm_adaptive_quantumkeeper() :
+      m_adaptive(false),
+      m_quantum(sc_core::SC_ZERO_TIME),
+      m_min_quantum(sc_core::SC_ZERO_TIME),
+      m_max_quantum(sc_core::SC_ZERO_TIME),
+      m_window_stale_accesses(0)
+    {
+      reset_statistics();
+    }
+
+    //
+    // Synchronize to systemC and record the synchronization.
+    //
+    virtual void sync()
+    {
+      const sc_core::sc_time current = get_current_time();
+      if (current > m_next_sync_point) {
+        m_total_overshoot += current - m_next_sync_point;
+      }
+      m_total_sync_time += m_local_time;
+      ++m_num_syncs;
+
+      const std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+      sc_core::wait(m_local_time);
+      m_host_wait_time += std::chrono::steady_clock::now() - start;
+
+      reset();
+    }
+
+    //
+    // Statistics
+    //
+    unsigned long long get_num_syncs() const { return m_num_syncs; }
+
+    // average time the local time ran past the sync point before sync()
+    sc_core::sc_time get_average_overshoot() const
+    {
+      return m_num_syncs ? m_total_overshoot / static_cast<double>(m_num_syncs)
+                         : sc_core::SC_ZERO_TIME;
+    }
+
+    // simulated time waited in sync()
+    const sc_core::sc_time& get_total_sync_time() const
+    {
+      return m_total_sync_time;
+    }
+
+    // host time spent in the waits of sync(), in seconds
+    double get_host_wait_time() const
+    {
+      return std::chrono::duration<double>(m_host_wait_time).count();
+    }
+
+    unsigned long long get_num_stale_accesses() const
+    {
+      return m_num_stale_accesses;
+    }
+
+    void reset_statistics()
+    {
+      m_num_syncs = 0;
+      m_num_stale_accesses = 0;
+      m_total_overshoot = sc_core::SC_ZERO_TIME;
+      m_total_sync_time = sc_core::SC_ZERO_TIME;
+      m_host_wait_time = std::chrono::steady_clock::duration::zero();
+    }
+
+    //
+    // Adaptation
+    //
+
+    // enable adaptation of the quantum between the given bounds, starting
+    // from the global quantum
+    void set_quantum_bounds(const sc_core::sc_time& min_quantum,
+                            const sc_core::sc_time& max_quantum)
+    {
+      sc_assert(sc_core::SC_ZERO_TIME < min_quantum);
+      sc_assert(min_quantum <= max_quantum);
+      m_adaptive = true;
+      m_min_quantum = min_quantum;
+      m_max_quantum = max_quantum;
+      m_quantum = clamp(get_global_quantum());
+    }
+
+    void disable_adaptation() { m_adaptive = false; }
+    bool is_adaptive() const { return m_adaptive; }
+
+    // current quantum of this initiator
+    sc_core::sc_time get_quantum() const
+    {
+      return m_adaptive ? m_quantum : get_global_quantum();
+    }
+
+    // state not yet updated by this initiator has been observed
+    void report_stale_access()
+    {
+      ++m_num_stale_accesses;
+      ++m_window_stale_accesses;
+    }
+
+  protected:
+    //
+    // Adapt the quantum once per reset() and compute the next local quantum.
+    //
+    virtual sc_core::sc_time compute_local_quantum()
+    {
+      if (!m_adaptive) {
+        return tlm_quantumkeeper::compute_local_quantum();
+      }
+      m_quantum = clamp(adapt_quantum(m_quantum, m_window_stale_accesses));
+      m_window_stale_accesses = 0;
+      return m_quantum - (sc_core::sc_time_stamp() % m_quantum);
+    }
+
+    //
+    // New quantum given the stale accesses reported since the last reset(),
+    // the result is clamped to the bounds.
+    //
+    virtual sc_core::sc_time adapt_quantum(const sc_core::sc_time& quantum,
+                                           unsigned int stale_accesses)
+    {
+      if (stale_accesses) {
+        return quantum / 2.0;
+      }
+      const sc_core::sc_time step = quantum / 4.0;
+      return quantum + (step != sc_core::SC_ZERO_TIME
+                        ? step : sc_core::sc_get_time_resolution());
+    }
+
+  private:
+    sc_core::sc_time clamp(const sc_core::sc_time& t) const
+    {
+      if (t < m_min_quantum) return m_min_quantum;
+      if (t > m_max_quantum) return m_max_quantum;
+      return t;
+    }
+
+  protected:
+    bool m_adaptive;
+    sc_core::sc_time m_quantum;
+    sc_core::sc_time m_min_quantum;
+    sc_core::sc_time m_max_quantum;
+    unsigned int m_window_stale_accesses;
+
+    unsigned long long m_num_syncs;
+    unsigned long long m_num_stale_accesses;
+    sc_core::sc_time m_total_overshoot;
+    sc_core::sc_time m_total_sync_time;
+    std::chrono::steady_clock::duration m_host_wait_time;
+  };
+
+} // namespace tlm_utils
+
+#endif // TLM_UTILS_TLM_ADAPTIVE_QUANTUMKEEPER_H_INCLUDED_
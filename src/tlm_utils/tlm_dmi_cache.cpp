@@ -0,0 +1,125 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+#include "tlm_utils/tlm_dmi_cache.h"
+
+#include <algorithm>
+
+namespace tlm_utils {
+
+namespace {
+
+bool ends_before(const tlm::tlm_dmi& dmi, sc_dt::uint64 address)
+{
+  return dmi.get_end_address() < address;
+}
+
+bool starts_after(sc_dt::uint64 address, const tlm::tlm_dmi& dmi)
+{
+  return address < dmi.get_start_address();
+}
+
+} // anonymous namespace
+
+tlm_dmi_cache::tlm_dmi_cache()
+  : m_regions()
+  , m_last_hit(0)
+{}
+
+std::vector<tlm::tlm_dmi>::iterator
+tlm_dmi_cache::first_ending_after(sc_dt::uint64 address)
+{
+  // the regions do not overlap, so their end addresses are sorted as well
+  return std::lower_bound(m_regions.begin(), m_regions.end(), address,
+                          ends_before);
+}
+
+void
+tlm_dmi_cache::insert(const tlm::tlm_dmi& dmi)
+{
+  sc_assert(dmi.get_start_address() <= dmi.get_end_address());
+
+  std::vector<tlm::tlm_dmi>::iterator first =
+    first_ending_after(dmi.get_start_address());
+  std::vector<tlm::tlm_dmi>::iterator last = first;
+  while (last != m_regions.end() &&
+         last->get_start_address() <= dmi.get_end_address())
+    ++last;
+
+  if (first != last) {
+    // reuse the slot of the first overlapped region
+    *first = dmi;
+    first = m_regions.erase(first + 1, last) - 1;
+  } else {
+    first = m_regions.insert(first, dmi);
+  }
+  m_last_hit = first - m_regions.begin();
+}
+
+const tlm::tlm_dmi*
+tlm_dmi_cache::lookup(sc_dt::uint64 address, unsigned int length,
+                      tlm::tlm_command cmd) const
+{
+  const tlm::tlm_dmi* dmi = 0;
+  if (m_last_hit < m_regions.size() &&
+      m_regions[m_last_hit].get_start_address() <= address &&
+      address <= m_regions[m_last_hit].get_end_address()) {
+    dmi = &m_regions[m_last_hit];
+  } else {
+    std::vector<tlm::tlm_dmi>::const_iterator it =
+      std::upper_bound(m_regions.begin(), m_regions.end(), address,
+                       starts_after);
+    if (it == m_regions.begin() || address > (--it)->get_end_address())
+      return 0;
+    m_last_hit = it - m_regions.begin();
+    dmi = &*it;
+  }
+
+  if (length > 1 && length - 1 > dmi->get_end_address() - address)
+    return 0;
+
+  switch (cmd) {
+  case tlm::TLM_READ_COMMAND:
+    return dmi->is_read_allowed() ? dmi : 0;
+  case tlm::TLM_WRITE_COMMAND:
+    return dmi->is_write_allowed() ? dmi : 0;
+  default:
+    return dmi;
+  }
+}
+
+void
+tlm_dmi_cache::invalidate(sc_dt::uint64 start, sc_dt::uint64 end)
+{
+  std::vector<tlm::tlm_dmi>::iterator first = first_ending_after(start);
+  std::vector<tlm::tlm_dmi>::iterator last = first;
+  while (last != m_regions.end() && last->get_start_address() <= end)
+    ++last;
+  m_regions.erase(first, last);
+  m_last_hit = 0;
+}
+
+void
+tlm_dmi_cache::clear()
+{
+  m_regions.clear();
+  m_last_hit = 0;
+}
+
+} // namespace tlm_utils
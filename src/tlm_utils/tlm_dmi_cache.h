@@ -0,0 +1,86 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+#ifndef TLM_UTILS_TLM_DMI_CACHE_H_INCLUDED_
+#define TLM_UTILS_TLM_DMI_CACHE_H_INCLUDED_
+
+#include "tlm_core/tlm_2/tlm_2_interfaces/tlm_dmi.h"
+#include "tlm_core/tlm_2/tlm_generic_payload/tlm_gp.h"
+
+#include <vector>
+
+namespace tlm_utils {
+
+//---------------------------------------------------------------------------
+// tlm_dmi_cache: the DMI regions granted to an initiator
+//
+// Regions returned by get_direct_mem_ptr are inserted into the cache and
+// looked up before each access:
+//
+//   const tlm::tlm_dmi* dmi = cache.lookup( address, 4, tlm::TLM_READ_COMMAND );
+//   if( !dmi && socket->get_direct_mem_ptr( trans, dmi_data ) ) {
+//     cache.insert( dmi_data );
+//     dmi = cache.lookup( address, 4, tlm::TLM_READ_COMMAND );
+//   }
+//   if( dmi ) { ... dmi->get_dmi_ptr() + ( address - dmi->get_start_address() ) }
+//
+// The regions are kept sorted by address and do not overlap: a region
+// replaces all cached regions it overlaps. Lookups check the region hit
+// last before searching the table, so sequential accesses take constant
+// time. Regions granted without any access (allow_none) may be inserted
+// to remember where DMI was denied, they are only returned for lookups
+// with TLM_IGNORE_COMMAND.
+//
+// A cache registered with simple_initiator_socket::register_dmi_cache()
+// drops invalidated regions before the invalidate_direct_mem_ptr callback
+// of the module, if any, is called.
+//---------------------------------------------------------------------------
+
+class SC_API tlm_dmi_cache
+{
+public:
+  tlm_dmi_cache();
+
+  // add a region, the regions it overlaps are removed
+  void insert(const tlm::tlm_dmi& dmi);
+
+  // region containing the bytes [address, address + length - 1] and
+  // allowing the command, 0 if there is none
+  const tlm::tlm_dmi* lookup(sc_dt::uint64 address,
+                             unsigned int length = 1,
+                             tlm::tlm_command cmd = tlm::TLM_IGNORE_COMMAND) const;
+
+  // remove all regions overlapping [start, end]
+  void invalidate(sc_dt::uint64 start, sc_dt::uint64 end);
+  void clear();
+
+  std::size_t size() const { return m_regions.size(); }
+  bool empty() const { return m_regions.empty(); }
+
+private:
+  // first region ending at or after the address
+  std::vector<tlm::tlm_dmi>::iterator first_ending_after(sc_dt::uint64 address);
+
+private:
+  std::vector<tlm::tlm_dmi> m_regions;   // sorted by address
+  mutable std::size_t       m_last_hit;
+};
+
+} // namespace tlm_utils
+
+#endif // TLM_UTILS_TLM_DMI_CACHE_H_INCLUDED_
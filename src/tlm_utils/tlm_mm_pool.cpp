@@ -0,0 +1,184 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+#include "tlm_utils/tlm_mm_pool.h"
+
+#include <sstream>
+
+namespace tlm_utils {
+
+tlm_mm_pool::payload::payload(tlm_mm_pool* pool)
+  : tlm::tlm_generic_payload(pool)
+  , m_pool(pool)
+  , m_pooled()
+  , m_data_buf(0)
+  , m_data_size(0)
+  , m_byte_enable_buf(0)
+  , m_byte_enable_size(0)
+  , m_next(0)
+  , m_in_pool(false)
+{}
+
+tlm_mm_pool::payload::~payload()
+{
+  // pooled extensions still attached (to a detached payload) are not freed
+  // by ~tlm_generic_payload
+  for (unsigned int i = 0; i < m_pooled.size(); i++) {
+    if (m_pooled[i].ext) {
+      if (get_extension(i) == m_pooled[i].ext)
+        set_extension(i, 0);
+      m_pooled[i].ext->free();
+    }
+  }
+  delete [] m_data_buf;
+  delete [] m_byte_enable_buf;
+}
+
+tlm_mm_pool::tlm_mm_pool()
+  : m_mutex()
+  , m_payloads()
+  , m_free(0)
+  , m_num_free(0)
+{}
+
+tlm_mm_pool::~tlm_mm_pool()
+{
+  // payloads still in use are detached, their release() must not call the
+  // destroyed pool
+  for (std::size_t i = 0; i < m_payloads.size(); i++) {
+    payload* p = m_payloads[i];
+    if (p->m_in_pool) {
+      delete p;
+    } else {
+      p->set_mm(0);
+      p->m_pool = 0;
+    }
+  }
+}
+
+tlm_mm_pool::payload*
+tlm_mm_pool::get_payload()
+{
+  payload* p = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_free) {
+      p = m_free;
+      m_free = p->m_next;
+      m_num_free--;
+    }
+  }
+  if (!p) {
+    p = new payload(this);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_payloads.push_back(p);
+  }
+  p->m_next = 0;
+  p->m_in_pool = false;
+  return p;
+}
+
+tlm::tlm_generic_payload*
+tlm_mm_pool::allocate()
+{
+  return get_payload();
+}
+
+tlm::tlm_generic_payload*
+tlm_mm_pool::allocate(unsigned int length, unsigned int byte_enable_length)
+{
+  payload* p = get_payload();
+  if (length > p->m_data_size) {
+    delete [] p->m_data_buf;
+    p->m_data_buf = new unsigned char[length];
+    p->m_data_size = length;
+  }
+  if (byte_enable_length > p->m_byte_enable_size) {
+    delete [] p->m_byte_enable_buf;
+    p->m_byte_enable_buf = new unsigned char[byte_enable_length];
+    p->m_byte_enable_size = byte_enable_length;
+  }
+  p->set_data_ptr(length ? p->m_data_buf : 0);
+  p->set_data_length(length);
+  p->set_streaming_width(length);
+  p->set_byte_enable_ptr(byte_enable_length ? p->m_byte_enable_buf : 0);
+  p->set_byte_enable_length(byte_enable_length);
+  return p;
+}
+
+void
+tlm_mm_pool::free(tlm::tlm_generic_payload* trans)
+{
+  // the payload has to be managed by this pool
+  payload* p = dynamic_cast<payload*>(trans);
+  sc_assert(p && p->m_pool == this);
+
+  // detach and reset the pooled extensions, free the auto extensions
+  for (unsigned int i = 0; i < p->m_pooled.size(); i++) {
+    extension_slot& slot = p->m_pooled[i];
+    if (slot.ext) {
+      if (p->get_extension(i) == slot.ext)
+        p->set_extension(i, 0);
+      slot.reset(slot.ext);
+    }
+  }
+  p->reset(); // also resets the gp option
+
+  // default attributes for the next transaction
+  p->set_command(tlm::TLM_IGNORE_COMMAND);
+  p->set_address(0);
+  p->set_data_ptr(0);
+  p->set_data_length(0);
+  p->set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+  p->set_dmi_allowed(false);
+  p->set_byte_enable_ptr(0);
+  p->set_byte_enable_length(0);
+  p->set_streaming_width(0);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  p->m_next = m_free;
+  p->m_in_pool = true;
+  m_free = p;
+  m_num_free++;
+}
+
+void
+tlm_mm_pool::report_pooled_extension_error(unsigned int id) const
+{
+  std::stringstream s;
+  s << "set_pooled_extension: the payload already carries another "
+       "extension with ID " << id;
+  SC_REPORT_ERROR("/OSCI_TLM-2/tlm_mm_pool", s.str().c_str());
+}
+
+unsigned int
+tlm_mm_pool::get_num_allocated() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return static_cast<unsigned int>(m_payloads.size());
+}
+
+unsigned int
+tlm_mm_pool::get_num_free() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_num_free;
+}
+
+} // namespace tlm_utils
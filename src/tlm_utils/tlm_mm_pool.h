@@ -0,0 +1,153 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+#ifndef TLM_UTILS_TLM_MM_POOL_H_INCLUDED_
+#define TLM_UTILS_TLM_MM_POOL_H_INCLUDED_
+
+#include "tlm_core/tlm_2/tlm_generic_payload/tlm_gp.h"
+
+#include <mutex>
+#include <vector>
+
+namespace tlm_utils {
+
+//---------------------------------------------------------------------------
+// tlm_mm_pool: a memory manager recycling generic payloads
+//
+// allocate() returns a payload managed by the pool, with all attributes
+// set to their default values and a reference count of zero. Once the
+// last reference is released, the payload returns to the pool together
+// with its data and byte enable buffers and its pooled extensions:
+//
+//   tlm::tlm_generic_payload* trans = pool.allocate( 64, 8 );
+//   trans->acquire();
+//   my_extension* ext = pool.set_pooled_extension<my_extension>( *trans );
+//   ...
+//   trans->release();  // back to the pool
+//
+// Pooled extensions are created once per payload and reset by assigning a
+// default constructed extension when the payload is freed, instead of being
+// deleted. Auto extensions are freed as usual (see tlm_generic_payload::
+// reset()).
+//
+// Only the list of free payloads is shared: allocate() and free() may be
+// called from several host threads, but a payload and its extensions must
+// only be used by one thread at a time. Payloads still in use when the pool
+// is destroyed are detached from it (see tlm_generic_payload::set_mm()),
+// their owner has to delete them.
+//---------------------------------------------------------------------------
+
+class SC_API tlm_mm_pool : public tlm::tlm_mm_interface
+{
+public:
+  tlm_mm_pool();
+  ~tlm_mm_pool();
+
+  // payload without data and byte enable buffers
+  tlm::tlm_generic_payload* allocate();
+
+  // payload with data and byte enable buffers of the given lengths,
+  // the streaming width is set to the data length
+  tlm::tlm_generic_payload* allocate(unsigned int length,
+                                     unsigned int byte_enable_length = 0);
+
+  // attach the preallocated extension of type T to a payload allocated
+  // from this pool (checked), an error is reported if the payload already
+  // carries another extension of type T
+  template <typename T> T* set_pooled_extension(tlm::tlm_generic_payload& trans);
+
+  virtual void free(tlm::tlm_generic_payload* trans);
+
+  // number of payloads created by this pool and payloads in the pool
+  unsigned int get_num_allocated() const;
+  unsigned int get_num_free() const;
+
+private:
+  struct extension_slot
+  {
+    tlm::tlm_extension_base* ext;
+    void (*reset)(tlm::tlm_extension_base*);
+  };
+
+  class payload : public tlm::tlm_generic_payload
+  {
+  public:
+    explicit payload(tlm_mm_pool* pool);
+    ~payload();
+
+    tlm_mm_pool*                m_pool;     // memory manager, 0 if detached
+    std::vector<extension_slot> m_pooled;   // pooled extensions by ID
+    unsigned char*              m_data_buf;
+    unsigned int                m_data_size;
+    unsigned char*              m_byte_enable_buf;
+    unsigned int                m_byte_enable_size;
+    payload*                    m_next;     // next free payload
+    bool                        m_in_pool;  // in the free list
+  };
+
+  template <typename T>
+  static void reset_extension(tlm::tlm_extension_base* ext)
+    { *static_cast<T*>(ext) = T(); }
+
+  payload* get_payload();
+  void report_pooled_extension_error(unsigned int id) const;
+
+private:
+  mutable std::mutex    m_mutex;
+  std::vector<payload*> m_payloads;   // all payloads created by the pool
+  payload*              m_free;       // free payloads
+  unsigned int          m_num_free;
+
+private:
+  // disabled
+  tlm_mm_pool(const tlm_mm_pool&);
+  tlm_mm_pool& operator=(const tlm_mm_pool&);
+};
+
+template <typename T>
+T*
+tlm_mm_pool::set_pooled_extension(tlm::tlm_generic_payload& trans)
+{
+  // the payload has to be managed by this pool
+  payload* pp = dynamic_cast<payload*>(&trans);
+  sc_assert(pp && pp->m_pool == this);
+  payload& p = *pp;
+  unsigned int id = T::ID;
+  if (id >= p.m_pooled.size()) {
+    extension_slot none = { 0, 0 };
+    p.m_pooled.resize(id + 1, none);
+  }
+  extension_slot& slot = p.m_pooled[id];
+  if (!slot.ext) {
+    slot.ext = new T();
+    slot.reset = &reset_extension<T>;
+  }
+  trans.resize_extensions();
+  tlm::tlm_extension_base* ext = trans.get_extension(id);
+  if (ext && ext != slot.ext) {
+    // neither overwritten (and leaked) nor freed, it may be in use elsewhere
+    report_pooled_extension_error(id);
+    return static_cast<T*>(slot.ext);
+  }
+  trans.set_extension(id, slot.ext);
+  return static_cast<T*>(slot.ext);
+}
+
+} // namespace tlm_utils
+
+#endif // TLM_UTILS_TLM_MM_POOL_H_INCLUDED_
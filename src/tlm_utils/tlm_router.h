@@ -0,0 +1,414 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+#ifndef TLM_UTILS_TLM_ROUTER_H_INCLUDED_
+#define TLM_UTILS_TLM_ROUTER_H_INCLUDED_
+
+#include <tlm>
+#include "tlm_utils/multi_passthrough_initiator_socket.h"
+#include "tlm_utils/multi_passthrough_target_socket.h"
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+namespace tlm_utils {
+
+//---------------------------------------------------------------------------
+// tlm_router: an address decoding interconnect
+//
+// Any number of initiators bind to target_socket, any number of targets
+// bind to initiator_socket. Each target serves one or more address
+// regions, which are registered with add_region() before the end of
+// elaboration:
+//
+//   tlm_utils::tlm_router<> router("router");
+//   cpu.socket.bind(router.target_socket);
+//   router.initiator_socket.bind(ram.socket);    // target 0
+//   router.initiator_socket.bind(uart.socket);   // target 1
+//   router.add_region(0, 0x00000000, 0x0fffffff);
+//   router.add_region(1, 0x10000000, 0x100000ff);
+//
+// Transactions are forwarded to the target of the region containing
+// their address, with the address relative to the region start unless
+// the region was added with relative == false. The translated address is
+// not restored on return. Accesses outside of all regions complete with
+// TLM_ADDRESS_ERROR_RESPONSE.
+//
+// The regions are kept sorted by address and decoded by binary search.
+// The region hit last by each initiator is checked first. Blocking,
+// non-blocking, debug and batch transport, DMI requests and DMI
+// invalidations are forwarded, with the DMI address ranges translated
+// between the address spaces of the initiators and of the targets. The
+// router does not arbitrate: non-blocking calls are passed through in
+// both directions, the backward path is found with a private extension
+// on the transaction.
+//---------------------------------------------------------------------------
+
+template <unsigned int BUSWIDTH = 32,
+          typename TYPES = tlm::tlm_base_protocol_types>
+class tlm_router : public sc_core::sc_module
+{
+public:
+  typedef typename TYPES::tlm_payload_type              transaction_type;
+  typedef typename TYPES::tlm_phase_type                phase_type;
+  typedef tlm::tlm_sync_enum                            sync_enum_type;
+
+  multi_passthrough_target_socket<tlm_router, BUSWIDTH, TYPES>    target_socket;
+  multi_passthrough_initiator_socket<tlm_router, BUSWIDTH, TYPES> initiator_socket;
+
+public:
+  explicit tlm_router(const sc_core::sc_module_name& name)
+    : sc_core::sc_module(name)
+    , target_socket("target_socket")
+    , initiator_socket("initiator_socket")
+  {
+    target_socket.register_b_transport(this, &tlm_router::b_transport);
+    target_socket.register_b_transport_batch(this, &tlm_router::b_transport_batch);
+    target_socket.register_nb_transport_fw(this, &tlm_router::nb_transport_fw);
+    target_socket.register_transport_dbg(this, &tlm_router::transport_dbg);
+    target_socket.register_get_direct_mem_ptr(this, &tlm_router::get_direct_mem_ptr);
+    initiator_socket.register_nb_transport_bw(this, &tlm_router::nb_transport_bw);
+    initiator_socket.register_invalidate_direct_mem_ptr(this,
+      &tlm_router::invalidate_direct_mem_ptr);
+  }
+
+  // the routes of transactions still pending are taken off them first
+  ~tlm_router()
+  {
+    for (std::size_t i = 0; i < m_routes.size(); ++i) {
+      if (m_routes[i]->trans)
+        pop_route(*m_routes[i]->trans);
+      delete m_routes[i];
+    }
+  }
+
+  virtual const char* kind() const { return "tlm_router"; }
+
+  // route the addresses [start, end] to the target bound to
+  // initiator_socket[target], regions must not overlap
+  void add_region(unsigned int target, sc_dt::uint64 start, sc_dt::uint64 end,
+                  bool relative = true)
+  {
+    if (start > end) {
+      report_error("empty address region", start, end);
+      return;
+    }
+
+    region r;
+    r.start  = start;
+    r.end    = end;
+    r.offset = relative ? start : 0;
+    r.target = target;
+
+    typename std::vector<region>::iterator it =
+      std::upper_bound(m_regions.begin(), m_regions.end(), start, starts_after);
+    if ((it != m_regions.end() && it->start <= end) ||
+        (it != m_regions.begin() && (it - 1)->end >= start)) {
+      report_error("overlapping address region", start, end);
+      return;
+    }
+    m_regions.insert(it, r);
+    m_last_hit.assign(m_last_hit.size(), 0);
+  }
+
+  std::size_t get_num_regions() const { return m_regions.size(); }
+
+private:
+  struct region
+  {
+    sc_dt::uint64 start;
+    sc_dt::uint64 end;
+    sc_dt::uint64 offset;   // subtracted from the address for the target
+    unsigned int  target;
+  };
+
+  static bool starts_after(sc_dt::uint64 address, const region& r)
+    { return address < r.start; }
+
+  // region containing the address, 0 if unmapped
+  const region* decode(int initiator, sc_dt::uint64 address)
+  {
+    if (static_cast<std::size_t>(initiator) >= m_last_hit.size())
+      m_last_hit.resize(initiator + 1, 0);
+
+    std::size_t& last = m_last_hit[initiator];
+    if (last < m_regions.size()) {
+      const region& r = m_regions[last];
+      if (r.start <= address && address <= r.end)
+        return &r;
+    }
+
+    typename std::vector<region>::const_iterator it =
+      std::upper_bound(m_regions.begin(), m_regions.end(), address, starts_after);
+    if (it == m_regions.begin() || address > (--it)->end)
+      return 0;
+
+    last = it - m_regions.begin();
+    return &*it;
+  }
+
+  void report_error(const char* msg, sc_dt::uint64 start, sc_dt::uint64 end)
+  {
+    std::stringstream s;
+    s << msg << " [0x" << std::hex << start << ", 0x" << end << "]";
+    SC_REPORT_ERROR(name(), s.str().c_str());
+  }
+
+  //
+  // forward path
+  //
+
+  void b_transport(int id, transaction_type& trans, sc_core::sc_time& t)
+  {
+    const region* r = decode(id, trans.get_address());
+    if (!r) {
+      trans.set_response_status(tlm::TLM_ADDRESS_ERROR_RESPONSE);
+      return;
+    }
+    trans.set_address(trans.get_address() - r->offset);
+    initiator_socket[r->target]->b_transport(trans, t);
+  }
+
+  // forward consecutive transactions to the same target as one batch
+  void b_transport_batch(int id, transaction_type* const* trans,
+                         unsigned int count, sc_core::sc_time& t)
+  {
+    unsigned int first = 0;
+    unsigned int target = 0;
+    for (unsigned int i = 0; i < count; ++i) {
+      const region* r = decode(id, trans[i]->get_address());
+      if (r && r->target == target && i > first) {
+        trans[i]->set_address(trans[i]->get_address() - r->offset);
+        continue;
+      }
+      if (i > first)
+        initiator_socket.b_transport_batch(trans + first, i - first, t, target);
+      if (!r) {
+        trans[i]->set_response_status(tlm::TLM_ADDRESS_ERROR_RESPONSE);
+        first = i + 1;
+        continue;
+      }
+      trans[i]->set_address(trans[i]->get_address() - r->offset);
+      first = i;
+      target = r->target;
+    }
+    if (count > first)
+      initiator_socket.b_transport_batch(trans + first, count - first, t, target);
+  }
+
+  sync_enum_type nb_transport_fw(int id, transaction_type& trans,
+                                 phase_type& phase, sc_core::sc_time& t)
+  {
+    route_extension* route;
+    if (phase == tlm::BEGIN_REQ) {
+      const region* r = decode(id, trans.get_address());
+      if (!r) {
+        trans.set_response_status(tlm::TLM_ADDRESS_ERROR_RESPONSE);
+        return tlm::TLM_COMPLETED;
+      }
+      trans.set_address(trans.get_address() - r->offset);
+      route = push_route(trans, id, r->target);
+    } else {
+      route = find_route(trans);
+      if (!route) {
+        SC_REPORT_ERROR(name(), "nb_transport_fw: unknown transaction");
+        return tlm::TLM_COMPLETED;
+      }
+    }
+
+    const unsigned int target = route->target;
+    if (phase == tlm::END_RESP)
+      pop_route(trans);
+    sync_enum_type status =
+      initiator_socket[target]->nb_transport_fw(trans, phase, t);
+    if (status == tlm::TLM_COMPLETED)
+      pop_route(trans);
+    return status;
+  }
+
+  unsigned int transport_dbg(int id, transaction_type& trans)
+  {
+    const region* r = decode(id, trans.get_address());
+    if (!r)
+      return 0;
+    trans.set_address(trans.get_address() - r->offset);
+    return initiator_socket[r->target]->transport_dbg(trans);
+  }
+
+  bool get_direct_mem_ptr(int id, transaction_type& trans, tlm::tlm_dmi& dmi)
+  {
+    const sc_dt::uint64 address = trans.get_address();
+    const region* r = decode(id, address);
+    if (!r) {
+      // no DMI in the gap around the address
+      typename std::vector<region>::const_iterator it =
+        std::upper_bound(m_regions.begin(), m_regions.end(), address,
+                         starts_after);
+      dmi.allow_none();
+      dmi.set_end_address(it == m_regions.end() ? ~sc_dt::uint64(0)
+                                                : it->start - 1);
+      dmi.set_start_address(it == m_regions.begin() ? 0 : (it - 1)->end + 1);
+      return false;
+    }
+
+    trans.set_address(address - r->offset);
+    bool status = initiator_socket[r->target]->get_direct_mem_ptr(trans, dmi);
+
+    // translate and clip the range to the region
+    sc_dt::uint64 start = dmi.get_start_address() + r->offset;
+    sc_dt::uint64 end = dmi.get_end_address();
+    end = (end > r->end - r->offset) ? r->end : end + r->offset;
+    if (start < r->start) {
+      if (dmi.get_dmi_ptr())
+        dmi.set_dmi_ptr(dmi.get_dmi_ptr() + (r->start - start));
+      start = r->start;
+    }
+    dmi.set_start_address(start);
+    dmi.set_end_address(end);
+    return status;
+  }
+
+  //
+  // backward path
+  //
+
+  sync_enum_type nb_transport_bw(int /*target*/, transaction_type& trans,
+                                 phase_type& phase, sc_core::sc_time& t)
+  {
+    route_extension* route = find_route(trans);
+    if (!route) {
+      SC_REPORT_ERROR(name(), "nb_transport_bw: unknown transaction");
+      return tlm::TLM_COMPLETED;
+    }
+
+    // the initiator may release the transaction before returning, so the
+    // route is restored afterwards only if the transaction is still pending
+    const int initiator = route->initiator;
+    const unsigned int target = route->target;
+    pop_route(trans);
+    sync_enum_type status =
+      target_socket[initiator]->nb_transport_bw(trans, phase, t);
+    if (status == tlm::TLM_ACCEPTED ||
+        (status == tlm::TLM_UPDATED && phase != tlm::END_RESP))
+      push_route(trans, initiator, target);
+    return status;
+  }
+
+  void invalidate_direct_mem_ptr(int target, sc_dt::uint64 start,
+                                 sc_dt::uint64 end)
+  {
+    for (std::size_t i = 0; i < m_regions.size(); ++i) {
+      const region& r = m_regions[i];
+      if (r.target != static_cast<unsigned int>(target))
+        continue;
+
+      // part of the region in the address space of the target
+      sc_dt::uint64 low = std::max(start, r.start - r.offset);
+      sc_dt::uint64 high = std::min(end, r.end - r.offset);
+      if (low > high)
+        continue;
+
+      for (unsigned int j = 0; j < target_socket.size(); ++j) {
+        target_socket[j]->invalidate_direct_mem_ptr(low + r.offset,
+                                                    high + r.offset);
+      }
+    }
+  }
+
+  //
+  // routes of pending non-blocking transactions
+  //
+
+  // the initiator and target of a transaction passing this router, routes
+  // of several routers on the path of a transaction are chained
+  //
+  // The routes stay owned by their routers. A transaction freeing its
+  // extensions, e.g. when it is deleted, only detaches the chain from it.
+  struct route_extension : public tlm::tlm_extension<route_extension>
+  {
+    tlm::tlm_extension_base* clone() const { return NULL; }
+    void free()
+    {
+      for (route_extension* route = this; route; route = route->outer)
+        route->trans = 0;
+    }
+    void copy_from(tlm::tlm_extension_base const &) {}
+
+    const tlm_router* owner;
+    transaction_type* trans;   // transaction carrying the route, if any
+    int               initiator;
+    unsigned int      target;
+    route_extension*  outer;   // route of the router before this one
+  };
+
+  route_extension* push_route(transaction_type& trans, int initiator,
+                              unsigned int target)
+  {
+    route_extension* route;
+    if (m_free_routes.empty()) {
+      route = new route_extension;
+      m_routes.push_back(route);
+    } else {
+      route = m_free_routes.back();
+      m_free_routes.pop_back();
+    }
+    route->owner = this;
+    route->trans = &trans;
+    route->initiator = initiator;
+    route->target = target;
+    route->outer = trans.set_extension(route);
+    return route;
+  }
+
+  route_extension* find_route(transaction_type& trans)
+  {
+    route_extension* route = trans.template get_extension<route_extension>();
+    while (route && route->owner != this)
+      route = route->outer;
+    return route;
+  }
+
+  void pop_route(transaction_type& trans)
+  {
+    route_extension* inner = 0;
+    route_extension* route = trans.template get_extension<route_extension>();
+    while (route && route->owner != this) {
+      inner = route;
+      route = route->outer;
+    }
+    if (!route)
+      return;
+    if (inner)
+      inner->outer = route->outer;
+    else
+      trans.set_extension(route->outer);
+    route->trans = 0;
+    m_free_routes.push_back(route);
+  }
+
+private:
+  std::vector<region>           m_regions;      // sorted by address
+  std::vector<std::size_t>      m_last_hit;     // region index per initiator
+  std::vector<route_extension*> m_routes;       // all routes allocated
+  std::vector<route_extension*> m_free_routes;
+};
+
+} // namespace tlm_utils
+
+#endif // TLM_UTILS_TLM_ROUTER_H_INCLUDED_
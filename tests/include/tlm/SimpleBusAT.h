@@ -28,6 +28,8 @@
 
 #include "tlm_utils/peq_with_get.h"
 
+#include <map>
+
 template <int NR_OF_INITIATORS, int NR_OF_TARGETS>
 class SimpleBusAT : public sc_core::sc_module
 {
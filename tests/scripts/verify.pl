@@ -2267,6 +2267,14 @@ sub do_diff
         ( $logfile = $file ) =~ s/\.\w+$/.log/; # change test to log
     }
 
+    # compressed trace files are compared after decompression
+    if( ! ( -e "$rt_output_dir/$logfile" ) &&
+        ( -e "$rt_output_dir/$logfile.gz" ) ) {
+        $command = "gzip -dc $rt_output_dir/$logfile.gz " .
+                   "> $rt_output_dir/$logfile";
+        ( $exit_code, $signal ) = &rt_system( $command );
+    }
+
     if( ! ( -e "$rt_output_dir/$logfile" ) ) {
         &print_log( "Error: cannot find logfile '$logfile'\n" );
         return 'missolog';
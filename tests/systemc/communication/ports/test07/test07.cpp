@@ -0,0 +1,189 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  test07.cpp -- creation and destruction of modules with ports, exports and
+                primitive channels during elaboration
+
+  The modules are destroyed out of construction order, so the port, export
+  and primitive channel registries and the lists of child objects and
+  events have to remove entries from their middle.
+
+  Compile with -DBENCHMARK to measure the elaboration and destruction of a
+  hierarchy with 1M ports.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+#ifdef BENCHMARK
+# include <chrono>
+#endif
+
+#define PORT_N 4
+
+typedef sc_port<sc_signal_in_if<int>, 1, SC_ZERO_OR_MORE_BOUND> leaf_port;
+
+SC_MODULE(leaf)
+{
+    leaf_port                               in[PORT_N];
+    sc_export<sc_signal_in_if<int> >        out;
+    sc_signal<int>                          sig;
+    sc_event                                ev;
+
+    SC_CTOR(leaf)
+    {
+        out( sig );
+    }
+};
+
+SC_MODULE(top)
+{
+    std::vector<leaf*>     leaves;
+    std::vector<sc_event*> events;
+
+    top( sc_module_name name_, int n )
+      : sc_module( name_ ), leaves( n ), events( n )
+    {
+        for( int i = 0; i < n; ++ i ) {
+            leaves[i] = new leaf( sc_gen_unique_name( "leaf" ) );
+            events[i] = new sc_event( sc_gen_unique_name( "event" ) );
+        }
+    }
+
+    ~top()
+    {
+        for( std::size_t i = 0; i < leaves.size(); ++ i ) {
+            delete leaves[i];
+            delete events[i];
+        }
+    }
+
+    // destroys every step-th leaf starting with the first one
+    void prune( int step )
+    {
+        std::vector<leaf*>     kept;
+        std::vector<sc_event*> kept_events;
+        for( std::size_t i = 0; i < leaves.size(); ++ i ) {
+            if( i % step == 0 ) {
+                delete leaves[i];
+                delete events[i];
+            } else {
+                kept.push_back( leaves[i] );
+                kept_events.push_back( events[i] );
+            }
+        }
+        leaves.swap( kept );
+        events.swap( kept_events );
+    }
+
+    void print() const
+    {
+        const std::vector<sc_object*>& children = get_child_objects();
+        cout << name() << ":";
+        for( std::size_t i = 0; i < children.size(); ++ i ) {
+            cout << " " << children[i]->basename();
+        }
+        cout << endl;
+        const std::vector<sc_event*>& child_events = get_child_events();
+        cout << name() << ":";
+        for( std::size_t i = 0; i < child_events.size(); ++ i ) {
+            cout << " " << child_events[i]->basename();
+        }
+        cout << endl;
+    }
+};
+
+void print_top_level()
+{
+    const std::vector<sc_object*>& objects = sc_get_top_level_objects();
+    cout << "top level:";
+    for( std::size_t i = 0; i < objects.size(); ++ i ) {
+        cout << " " << objects[i]->basename();
+    }
+    cout << endl;
+}
+
+#ifdef BENCHMARK
+void benchmark()
+{
+    typedef std::chrono::steady_clock clock;
+
+    const int leaf_n = 1000000 / PORT_N;
+    clock::time_point start = clock::now();
+    top* t = new top( "bench", leaf_n );
+    clock::time_point built = clock::now();
+    t->prune( 1 );
+    clock::time_point destroyed = clock::now();
+    delete t;
+
+    cout << "benchmark " << leaf_n * PORT_N << " ports: build "
+         << std::chrono::duration<double>( built - start ).count()
+         << " s, destroy "
+         << std::chrono::duration<double>( destroyed - built ).count()
+         << " s" << endl;
+}
+#endif
+
+int sc_main( int, char*[] )
+{
+#ifdef BENCHMARK
+    benchmark();
+#endif
+
+    top* t1 = new top( "t1", 12 );
+    top  t2( "t2", 7 );
+    sc_signal<int> s( "s" );
+    t1->print();
+    t2.print();
+    print_top_level();
+
+    t1->prune( 3 );
+    t2.prune( 2 );
+    t1->print();
+    t2.print();
+
+    top* t3 = new top( "t3", 5 );
+    t1->prune( 2 );
+    t3->print();
+    t1->print();
+    print_top_level();
+
+    delete t1;
+    print_top_level();
+
+    for( std::size_t i = 0; i < t2.leaves.size(); ++ i ) {
+        t2.leaves[i]->in[0]( s );
+    }
+
+    sc_start( 1, SC_NS );
+    s.write( 42 );
+    sc_start( 1, SC_NS );
+    for( std::size_t i = 0; i < t2.leaves.size(); ++ i ) {
+        cout << t2.leaves[i]->name() << " "
+             << t2.leaves[i]->in[0]->read() << endl;
+    }
+
+    delete t3;
+    print_top_level();
+
+    cout << "Program completed" << endl;
+    return 0;
+}
@@ -0,0 +1,182 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  test21.cpp -- Test of async_request_update from several host threads
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+// test of sc_prim_channel::async_request_update() with and without payload
+
+#include <systemc.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#ifdef BENCHMARK
+#include <chrono>
+static const int producers = 8;
+static const int samples   = 1000000;
+#else
+static const int producers = 4;
+static const int samples   = 10000;
+#endif
+
+struct sample : sc_async_payload
+{
+    sample( int p, int s ) : producer( p ), seq( s ) {}
+    int producer;
+    int seq;
+};
+
+// receives payloads, checks that each producer's order is preserved
+class collector : public sc_prim_channel
+{
+public:
+    collector( const char* nm )
+      : sc_prim_channel( nm ), next( producers, 0 ), count( 0 ),
+        updates( 0 ), in_order( true )
+      { async_attach_suspending(); }
+
+    sc_event         done;
+    std::vector<int> next;
+    long             count;
+    long             updates;
+    bool             in_order;
+
+protected:
+    virtual void async_update( sc_async_payload* payload )
+    {
+        sample* s = static_cast<sample*>( payload );
+        if( s->seq != next[s->producer]++ )
+            in_order = false;
+        ++count;
+        delete s;
+    }
+
+    virtual void update()
+    {
+        ++updates;
+        if( count == long( producers ) * samples ) {
+            async_detach_suspending();
+            done.notify( SC_ZERO_TIME );
+        }
+    }
+};
+
+// plain requests: the last value written must be seen by an update
+class ticker : public sc_prim_channel
+{
+public:
+    ticker( const char* nm )
+      : sc_prim_channel( nm ), value( 0 ), seen( 0 ), updates( 0 )
+      { async_attach_suspending(); }
+
+    void tick()
+    {
+        value.fetch_add( 1 );
+        async_request_update();
+    }
+
+    sc_event         done;
+    std::atomic<int> value;
+    int              seen;
+    long             updates;
+
+protected:
+    virtual void update()
+    {
+        ++updates;
+        seen = value.load();
+        if( seen == producers * samples ) {
+            async_detach_suspending();
+            done.notify( SC_ZERO_TIME );
+        }
+    }
+};
+
+SC_MODULE( top )
+{
+    collector col;
+    ticker    tck;
+    std::vector<std::thread> threads;
+
+    SC_CTOR( top ) : col( "col" ), tck( "tck" )
+    {
+        SC_THREAD( main );
+    }
+
+    void produce( int p )
+    {
+        for( int i = 0; i < samples; ++i ) {
+            col.async_request_update( new sample( p, i ) );
+            tck.tick();
+        }
+    }
+
+    void main()
+    {
+        for( int p = 0; p < producers; ++p )
+            threads.emplace_back( &top::produce, this, p );
+
+        wait( col.done & tck.done );
+
+        cout << "payloads received: " << col.count << endl;
+        cout << "payloads in order: " << ( col.in_order ? "yes" : "no" ) << endl;
+        cout << "payload updates coalesced: "
+             << ( col.updates <= col.count ? "yes" : "no" ) << endl;
+        cout << "ticks seen: " << tck.seen << endl;
+        cout << "tick updates coalesced: "
+             << ( tck.updates <= tck.seen ? "yes" : "no" ) << endl;
+    }
+};
+
+int
+sc_main( int, char*[] )
+{
+    top t( "top" );
+
+#ifdef BENCHMARK
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+#endif
+    sc_start();
+#ifdef BENCHMARK
+    std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+    cout << "elapsed: " << elapsed.count() << " s" << endl;
+#endif
+
+    for( std::size_t i = 0; i < t.threads.size(); ++i )
+        t.threads[i].join();
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*****************************************************************************
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  test04.cpp -- Resolution of wide sc_signal_rv vectors with several writers
+
+  Original Author: agent, 2026-10-16
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+// bit i of writer k drives digit k of i in base 4, so the low 64 bits cover
+// all combinations of three writers.
+
+sc_lv<70> driven( int writer, int step )
+{
+    sc_lv<70> value;
+    for( int i = 0; i < 70; ++ i ) {
+        int digit = ( ( i + step ) >> ( 2 * writer ) ) & 3;
+        value[i] = sc_dt::sc_logic_value_t( digit );
+    }
+    return value;
+}
+
+SC_MODULE( mod_a )
+{
+    // ports
+    sc_in<sc_lv<70> >  in;
+    sc_out<sc_lv<70> > out[3];
+
+    // events
+    sc_event ready;
+
+    void out_action0() { out_action( 0 ); }
+    void out_action1() { out_action( 1 ); }
+    void out_action2() { out_action( 2 ); }
+
+    void out_action( int writer )
+    {
+        for( int step = 0; step < 3; ++ step ) {
+            out[writer].write( driven( writer, step ) );
+            wait( 1, SC_NS );
+        }
+    }
+
+    void in_action()
+    {
+        for( int step = 0; step < 3; ++ step ) {
+            wait( 1, SC_NS );
+            cout << in.read() << endl;
+            for( int i = 0; i < 64; i += 16 ) {
+                for( int writer = 0; writer < 3; ++ writer ) {
+                    cout << driven( writer, step ).range( i + 15, i ) << " ";
+                }
+                cout << "-> " << in.read().range( i + 15, i ) << endl;
+            }
+        }
+    }
+
+    SC_CTOR( mod_a )
+    {
+        SC_THREAD( out_action0 );
+        SC_THREAD( out_action1 );
+        SC_THREAD( out_action2 );
+        SC_THREAD( in_action );
+    }
+};
+
+int
+sc_main( int, char*[] )
+{
+    sc_signal_rv<70> sig_rv;
+
+    mod_a a( "a" );
+
+    a.out[0]( sig_rv );
+    a.out[1]( sig_rv );
+    a.out[2]( sig_rv );
+    a.in( sig_rv );
+
+    sc_start();
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  test01.cpp -- Reduce functions and bitwise assignments of bit vectors
+
+  Original Author: agent, 2026-10-16
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+// fill the vector from a linear congruential sequence; 'kinds' selects
+// how many of the values 0, 1, Z and X are used.
+
+template <class X>
+void fill( sc_dt::sc_proxy<X>& px, unsigned& seed, int kinds )
+{
+    X& x = px.back_cast();
+    for( int i = 0; i < x.length(); ++ i ) {
+        seed = seed * 1103515245u + 12345u;
+        x[i] = sc_logic( sc_dt::sc_logic_value_t( ( seed >> 16 ) % kinds ) );
+    }
+}
+
+void reduce( const sc_lv_base& lv )
+{
+    sc_bv_base bv( lv.length() );
+    cout << lv.and_reduce() << lv.or_reduce() << lv.xor_reduce()
+         << lv.nand_reduce() << lv.nor_reduce() << lv.xnor_reduce();
+    if( lv.is_01() ) {
+        bv = lv;
+        cout << " " << bv.and_reduce() << bv.or_reduce() << bv.xor_reduce()
+             << " " << lv.range( 0, lv.length() - 1 ).xor_reduce()
+             << ( lv, sc_lv<3>( "011" ) ).xor_reduce();
+    }
+    cout << endl;
+}
+
+// a reversed full-width range combined with its own vector must give the
+// same result as combining it with a copy
+
+void alias( const sc_lv_base& lv )
+{
+    int len = lv.length();
+    for( int op = 0; op < 3; ++ op ) {
+        sc_lv_base v( lv );
+        sc_dt::sc_subref<sc_lv_base> r( v.range( 0, len - 1 ) );
+        sc_lv_base expect( len );
+        expect = lv.range( 0, len - 1 );
+        switch( op ) {
+          case 0: expect &= lv; r &= v; break;
+          case 1: expect |= lv; r |= v; break;
+          default: expect ^= lv; r ^= v; break;
+        }
+        sc_lv_base result( len );
+        result = r;
+        cout << ( result == expect ? "" : "aliasing error " );
+    }
+    cout << "alias " << lv << endl;
+}
+
+int
+sc_main( int, char*[] )
+{
+    // the longer vectors also cover the word-parallel paths
+    const int lengths[] = { 1, 5, 31, 32, 33, 64, 65, 100, 160, 257 };
+    unsigned seed = 1;
+
+    for( int l = 0; l < 10; ++ l ) {
+        int len = lengths[l];
+        sc_lv_base lv( len );
+        sc_lv_base lv2( len );
+        sc_bv_base bv( len );
+
+        cout << "length " << len << endl;
+
+        lv = 0;
+        reduce( lv );
+        lv = -1;
+        reduce( lv );
+        lv[len-1] = '0';
+        reduce( lv );
+        lv = 0;
+        lv[len-1] = '1';
+        reduce( lv );
+        lv[len-1] = 'Z';
+        reduce( lv );
+        lv = -1;
+        lv[0] = 'X';
+        reduce( lv );
+        lv = -1;
+        lv[0] = '0';
+        reduce( lv );
+        lv = 0;
+        lv[0] = '1';
+        reduce( lv );
+
+        for( int kinds = 2; kinds <= 4; ++ kinds ) {
+            for( int n = 0; n < 4; ++ n ) {
+                fill( lv, seed, kinds );
+                reduce( lv );
+                fill( lv2, seed, 4 );
+                fill( bv, seed, 2 );
+                sc_lv_base lv_and( lv ), lv_or( lv ), lv_xor( lv );
+                lv_and &= lv2;
+                lv_or |= bv;
+                lv_xor ^= lv2;
+                cout << lv_and << " " << lv_or << " " << lv_xor << endl;
+                lv_and = lv;
+                lv_and &= lv_and;
+                if( lv_and.is_01() ) {
+                    bv &= lv_and.range( len - 1, 0 );
+                }
+                cout << lv_and << " " << bv << " " << ( lv ^ bv ) << endl;
+                alias( lv );
+            }
+        }
+    }
+
+    cout << "Program completed" << endl;
+    return 0;
+}
@@ -0,0 +1,247 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  wide_arithmetic.cpp -- checksums of additions, subtractions,
+                         multiplications, divisions and shifts of wide
+                         signed and unsigned values
+
+  The output does not depend on the digit arithmetic used, so a library
+  and test built with SC_ENABLE_64BIT_LIMBS have to reproduce the golden
+  log.  The test wide_arithmetic_limb64 builds this file and only runs in
+  that configuration.
+
+  Compile with -DBENCHMARK to measure the arithmetic of sc_biguint<W> for
+  256 to 4096 bits, with and without -DSC_ENABLE_64BIT_LIMBS to compare the
+  64-bit limb arithmetic against the 32-bit digit arithmetic, and with
+  different -DSC_KARATSUBA_WORDS=N to tune the multiplication.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+#ifdef BENCHMARK
+# include <chrono>
+#endif
+
+// Platform independent random numbers (64-bit linear congruential
+// generator, upper half of the state).
+
+class lcg
+{
+  public:
+    lcg() : m_state( 1 ) {}
+
+    unsigned int rand()
+    {
+	m_state = m_state * 6364136223846793005ULL + 1442695040888963407ULL;
+	return (unsigned int)( m_state >> 32 );
+    }
+
+  private:
+    uint64 m_state;
+};
+
+lcg rng;
+
+#define COUNT_N 24
+
+// FNV-1a hash of the hexadecimal representation of the values
+
+class checksum
+{
+  public:
+    checksum() : m_hash( 14695981039346656037ULL ) {}
+
+    template<typename T>
+    void add( const T& value )
+    {
+	std::string text = value.to_string( SC_HEX );
+	for ( std::size_t char_i = 0; char_i < text.size(); ++char_i ) {
+	    m_hash = ( m_hash ^ (unsigned char)text[char_i] ) * 1099511628211ULL;
+	}
+    }
+
+    uint64 value() const { return m_hash; }
+
+  private:
+    uint64 m_hash;
+};
+
+// Random values, with the extreme values of the width mixed in.
+
+template<typename T>
+void load( int count, T& target )
+{
+    int bits_n = target.length();
+    switch ( count ) {
+      case 0:  target = 0; return;
+      case 1:  target = -1; return;
+      case 2:  target = 0; target[bits_n-1] = 1; return;
+      case 3:  target = -1; target[bits_n-1] = 0; return;
+      default: break;
+    }
+    target = rng.rand();
+    for ( int digit_i = 1; digit_i < DIV_CEIL(bits_n); ++digit_i ) {
+	target = (target << 32) + rng.rand();
+    }
+}
+
+template<typename L, typename R>
+void test( const char* kind, int left_width, int right_width )
+{
+    L left(left_width);
+    R right(right_width);
+    checksum add, sub, mul, div, shift;
+
+    for ( int count = 0; count < COUNT_N; ++count ) {
+	load( count, left );
+	load( (count+3) % COUNT_N, right );
+	shift.add( left << ( count * 13 ) % left_width );
+	shift.add( left >> ( count * 13 ) % left_width );
+	L shifted( left );
+	shifted <<= ( count * 7 ) % left_width;
+	shift.add( shifted );
+	add.add( left + right );
+	sub.add( left - right );
+	sub.add( right - left );
+	mul.add( left * right );
+	mul.add( right * left );
+	if ( right != 0 ) {
+	    div.add( left / right );
+	    div.add( left % right );
+	}
+	if ( left != 0 ) {
+	    div.add( right / left );
+	    div.add( right % left );
+	}
+    }
+    cout << kind << " " << left_width << " x " << right_width << ": "
+         << hex << add.value() << " " << sub.value() << " " << mul.value()
+         << " " << div.value() << " " << shift.value() << dec << endl;
+}
+
+template<int W>
+void test_bigint()
+{
+    sc_bigint<W>    left;
+    sc_biguint<W-7> right;
+    checksum        add, sub, mul, div, shift;
+
+    for ( int count = 0; count < COUNT_N; ++count ) {
+	load( count, left );
+	load( count, right );
+	shift.add( left << ( count * 13 ) % W );
+	shift.add( left >> ( count * 13 ) % W );
+	shift.add( right >> ( count * 7 ) % W );
+	add.add( left + right );
+	sub.add( left - right );
+	mul.add( left * right );
+	mul.add( left * left );
+	mul.add( right * right );
+	if ( right != 0 ) {
+	    div.add( left / right );
+	    div.add( left % right );
+	}
+    }
+    cout << "sc_bigint<" << W << "> x sc_biguint<" << W-7 << ">: "
+         << hex << add.value() << " " << sub.value() << " " << mul.value()
+         << " " << div.value() << " " << shift.value() << dec << endl;
+}
+
+#ifdef BENCHMARK
+template<int W>
+void benchmark()
+{
+    const int   repeat_n = 4096 * 1024 / W;
+    sc_biguint<W> a[16];
+    sc_biguint<W> b[16];
+    sc_biguint<W+W> product;
+    sc_biguint<W+1> sum;
+
+    for ( int value_i = 0; value_i < 16; ++value_i ) {
+	load( 4+value_i, a[value_i] );
+	load( 4+value_i, b[value_i] );
+    }
+
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+    for ( int repeat_i = 0; repeat_i < repeat_n; ++repeat_i ) {
+	product = a[repeat_i & 15] * b[(repeat_i >> 4) & 15];
+	a[repeat_i & 15][0] = product[W];
+    }
+    std::chrono::duration<double> multiply =
+      std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for ( int repeat_i = 0; repeat_i < 64*repeat_n; ++repeat_i ) {
+	sum = a[repeat_i & 15] + b[(repeat_i >> 4) & 15];
+	a[repeat_i & 15][0] = sum[W];
+    }
+    std::chrono::duration<double> add =
+      std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for ( int repeat_i = 0; repeat_i < repeat_n; ++repeat_i ) {
+	product = a[repeat_i & 15] * b[(repeat_i >> 4) & 15] + repeat_i;
+	a[repeat_i & 15] = product / b[(repeat_i >> 4) & 15];
+    }
+    std::chrono::duration<double> divide =
+      std::chrono::steady_clock::now() - start;
+
+    cout << "sc_biguint<" << W << ">: multiply "
+         << 1e9 * multiply.count() / repeat_n << " ns, add "
+         << 1e9 * add.count() / (64*repeat_n) << " ns, divide "
+         << 1e9 * (divide - multiply).count() / repeat_n << " ns" << endl;
+}
+#endif
+
+int sc_main( int, char*[] )
+{
+    static const int widths[] = { 31, 32, 63, 64, 65, 127, 128, 129, 257,
+                                  1000, 2048 };
+    static const int widths_n = sizeof(widths) / sizeof(widths[0]);
+
+#ifdef BENCHMARK
+    benchmark<256>();
+    benchmark<512>();
+    benchmark<1024>();
+    benchmark<2048>();
+    benchmark<4096>();
+#else
+    for ( int left_i = 0; left_i < widths_n; ++left_i ) {
+	for ( int right_i = 0; right_i <= left_i; ++right_i ) {
+	    test<sc_signed,sc_signed>( "signed", widths[left_i],
+	                               widths[right_i] );
+	    test<sc_unsigned,sc_unsigned>( "unsigned", widths[left_i],
+	                                   widths[right_i] );
+	    test<sc_signed,sc_unsigned>( "mixed", widths[left_i],
+	                                 widths[right_i] );
+	}
+    }
+    test_bigint<64>();
+    test_bigint<200>();
+    test_bigint<1024>();
+    test_bigint<4096>();
+#endif
+
+    cout << "Program completed" << endl;
+    return 0;
+}
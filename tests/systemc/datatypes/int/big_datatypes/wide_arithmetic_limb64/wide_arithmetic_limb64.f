@@ -0,0 +1 @@
+wide_arithmetic_limb64/../wide_arithmetic/wide_arithmetic.cpp
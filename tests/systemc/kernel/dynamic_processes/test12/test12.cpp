@@ -0,0 +1,129 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  test12.cpp -- test reuse of stacks of short-lived spawned threads
+
+  Waves of threads with different stack sizes are spawned and finish,
+  so that later threads run on the stacks of earlier ones.  Each thread
+  keeps a pattern on its stack across wait() calls, which must not be
+  disturbed by other threads.
+
+  Compile with -DBENCHMARK to measure the cost of spawning threads.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc>
+
+#ifdef BENCHMARK
+# include <chrono>
+# include <iostream>
+  static const unsigned num_waves   = 10000;
+  static const unsigned num_threads = 100;
+#else
+  static const unsigned num_waves   = 20;
+  static const unsigned num_threads = 10;
+#endif
+
+using namespace sc_core;
+
+SC_MODULE( top )
+{
+  unsigned finished;
+  unsigned corrupted;
+
+  void worker( unsigned id )
+  {
+    unsigned pattern[256];
+    for( unsigned i = 0; i < 256; ++i )
+      pattern[i] = id * 256 + i;
+
+    wait( sc_time( 1 + id % 3, SC_NS ) );
+    wait( SC_ZERO_TIME );
+
+    for( unsigned i = 0; i < 256; ++i )
+      if( pattern[i] != id * 256 + i )
+        corrupted++;
+    finished++;
+  }
+
+  void spawner()
+  {
+    sc_spawn_options small_stack, large_stack;
+    small_stack.set_stack_size( 0x10000 );
+    large_stack.set_stack_size( 0x40000 );
+
+    for( unsigned wave = 0; wave < num_waves; ++wave )
+    {
+      sc_event_and_list done;
+      for( unsigned t = 0; t < num_threads; ++t ) {
+        unsigned id = wave * num_threads + t;
+        sc_process_handle h =
+          sc_spawn( sc_bind( &top::worker, this, id ), nullptr,
+                    ( id % 2 ) ? &large_stack : &small_stack );
+        done &= h.terminated_event();
+      }
+      wait( done );
+    }
+
+    SC_REPORT_INFO( "test12", "all waves done" );
+  }
+
+  SC_CTOR( top )
+    : finished( 0 ), corrupted( 0 )
+  {
+    SC_THREAD( spawner );
+  }
+};
+
+int sc_main( int, char*[] )
+{
+  top t( "top" );
+
+#ifdef BENCHMARK
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  sc_start();
+  std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+  std::cout << num_waves * num_threads << " threads spawned in "
+            << d.count() << " s" << std::endl;
+#else
+  sc_start();
+#endif
+
+  sc_assert( t.finished == num_waves * num_threads );
+  sc_assert( t.corrupted == 0 );
+
+  std::cout << "finished: " << t.finished << std::endl;
+  std::cout << "corrupted: " << t.corrupted << std::endl;
+  std::cout << "time: " << sc_time_stamp() << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,287 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  parallel_methods.cpp -- Test for the concurrent evaluation of method
+                          processes marked with set_parallel_safe()
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+#include <algorithm>
+
+using namespace sc_core;
+
+static const int width = 256;
+
+// one adder per output, all of them sensitive to the same inputs
+
+SC_MODULE(adder)
+{
+    sc_in<int>  a;
+    sc_in<int>  b;
+    sc_out<int> sum;
+
+    SC_CTOR(adder)
+    {
+        SC_METHOD(add);
+          sensitive << a << b;
+          dont_initialize();
+          set_parallel_safe();
+    }
+
+    void add()
+    {
+        sum.write( a.read() + b.read() );
+    }
+};
+
+// parallel-safe methods with dynamic sensitivity, interleaved in the method
+// queue with methods that are not parallel-safe
+
+static int markers_run = 0; // only changed by the markers
+
+SC_MODULE(ticker)
+{
+    sc_process_handle handle;
+    int               ticks;
+    int               first_seen; // markers_run at the first evaluation
+    int               last_seen;  // markers_run at the last evaluation
+    bool              current_ok;
+
+    SC_CTOR(ticker)
+      : ticks(0), first_seen(-1), last_seen(-1), current_ok(true)
+    {
+        SC_METHOD(tick);
+          set_parallel_safe();
+        handle = sc_get_last_created_process_handle();
+    }
+
+    void tick()
+    {
+        current_ok &= ( sc_get_current_process_handle() == handle );
+        if( ticks == 0 )
+            first_seen = markers_run;
+        last_seen = markers_run;
+        if( ++ticks < 4 )
+            next_trigger( 5, SC_NS );
+        else if( std::string( name() ) == "top.tickers1_50" )
+            SC_REPORT_INFO( "parallel_methods", "last tick" );
+    }
+};
+
+SC_MODULE(marker)
+{
+    int runs;
+
+    SC_CTOR(marker)
+      : runs(0)
+    {
+        SC_METHOD(mark);
+    }
+
+    void mark()
+    {
+        ++markers_run;
+        if( ++runs < 4 )
+            next_trigger( 5, SC_NS );
+    }
+};
+
+// parallel-safe methods waiting for temporary event lists
+
+SC_MODULE(waiter)
+{
+    const sc_event* a;
+    const sc_event* b;
+    int             wakeups;
+
+    SC_CTOR(waiter)
+      : a(0), b(0), wakeups(0)
+    {
+        SC_METHOD(wake);
+          set_parallel_safe();
+    }
+
+    void wake()
+    {
+        if( ++wakeups % 2 )
+            next_trigger( *a | *b );
+        else
+            next_trigger( *a & *b );
+    }
+};
+
+static void print_tickers( const sc_vector<ticker>& tickers )
+{
+    int  ticks[2]  = { tickers[0].ticks, tickers[0].ticks };
+    int  first[2]  = { tickers[0].first_seen, tickers[0].first_seen };
+    int  last[2]   = { tickers[0].last_seen, tickers[0].last_seen };
+    bool current_ok = true;
+    for( std::size_t i = 0; i < tickers.size(); ++i ) {
+        ticks[0] = std::min( ticks[0], tickers[i].ticks );
+        ticks[1] = std::max( ticks[1], tickers[i].ticks );
+        first[0] = std::min( first[0], tickers[i].first_seen );
+        first[1] = std::max( first[1], tickers[i].first_seen );
+        last[0]  = std::min( last[0], tickers[i].last_seen );
+        last[1]  = std::max( last[1], tickers[i].last_seen );
+        current_ok &= tickers[i].current_ok;
+    }
+    std::cout << tickers.name() << ": ticks " << ticks[0] << "-" << ticks[1]
+              << ", markers seen first " << first[0] << "-" << first[1]
+              << ", last " << last[0] << "-" << last[1]
+              << ( current_ok ? ", current process ok" : ", WRONG PROCESS" )
+              << std::endl;
+}
+
+static void print_waiters( const sc_vector<waiter>& waiters )
+{
+    int wakeups[2] = { waiters[0].wakeups, waiters[0].wakeups };
+    for( std::size_t i = 0; i < waiters.size(); ++i ) {
+        wakeups[0] = std::min( wakeups[0], waiters[i].wakeups );
+        wakeups[1] = std::max( wakeups[1], waiters[i].wakeups );
+    }
+    std::cout << waiters.name() << ": wakeups " << wakeups[0] << "-"
+              << wakeups[1] << std::endl;
+}
+
+SC_MODULE(top)
+{
+    sc_signal<int>                    in;
+    sc_vector< sc_signal<int> >       offset;
+    sc_vector< sc_signal<int> >       stage1;
+    sc_vector< sc_signal<int> >       stage2;
+    sc_vector< adder >                adders1;
+    sc_vector< adder >                adders2;
+    sc_vector< ticker >               tickers0;
+    marker                            marker0;
+    sc_vector< ticker >               tickers1;
+    marker                            marker1;
+    sc_vector< ticker >               tickers2;
+    sc_event                          ev_a;
+    sc_event                          ev_b;
+    sc_vector< waiter >               waiters;
+    int                               checked;
+
+    SC_CTOR(top)
+      : in("in")
+      , offset("offset", width)
+      , stage1("stage1", width)
+      , stage2("stage2", width / 2)
+      , adders1("adders1", width)
+      , adders2("adders2", width / 2)
+      , tickers0("tickers0", 100)
+      , marker0("marker0")
+      , tickers1("tickers1", 100)
+      , marker1("marker1")
+      , tickers2("tickers2", 100)
+      , ev_a("ev_a")
+      , ev_b("ev_b")
+      , waiters("waiters", 100)
+      , checked(0)
+    {
+        for( int i = 0; i < width; ++i ) {
+            offset[i].write(i);
+            adders1[i].a( in );
+            adders1[i].b( offset[i] );
+            adders1[i].sum( stage1[i] );
+        }
+        for( int i = 0; i < width / 2; ++i ) {
+            adders2[i].a( stage1[2 * i] );
+            adders2[i].b( stage1[2 * i + 1] );
+            adders2[i].sum( stage2[i] );
+        }
+        for( std::size_t i = 0; i < waiters.size(); ++i ) {
+            waiters[i].a = &ev_a;
+            waiters[i].b = &ev_b;
+        }
+
+        SC_METHOD(check);
+          for( int i = 0; i < width / 2; ++i )
+            sensitive << stage2[i];
+          dont_initialize();
+
+        SC_THREAD(stimulus);
+
+        SC_THREAD(idle);
+          set_parallel_safe(); // not a method: ignored
+        sc_spawn_options opt;
+        opt.set_parallel_safe();
+        sc_spawn( sc_bind( &top::idle, this ), "spawned_idle", &opt );
+    }
+
+    void idle() {}
+
+    void check()
+    {
+        ++checked;
+    }
+
+    void stimulus()
+    {
+        for( int value = 1; value <= 4; ++value )
+        {
+            in.write( value * 1000 );
+            ev_a.notify( SC_ZERO_TIME );
+            if( value % 2 )
+                ev_b.notify( SC_ZERO_TIME );
+            wait( 10, SC_NS );
+
+            long long sum = 0;
+            bool      ok  = true;
+            for( int i = 0; i < width / 2; ++i ) {
+                sum += stage2[i].read();
+                ok  &= ( stage2[i].read() == 2 * value * 1000 + 4 * i + 1 );
+            }
+            std::cout << sc_time_stamp() << ": in = " << in.read()
+                      << ", sum = " << sum
+                      << ( ok ? ", results match" : ", MISMATCH" )
+                      << std::endl;
+        }
+        std::cout << "check() ran " << checked << " times" << std::endl;
+        print_tickers( tickers0 );
+        print_tickers( tickers1 );
+        print_tickers( tickers2 );
+        print_waiters( waiters );
+        sc_stop();
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    sc_set_parallel_method_workers( 4 );
+    sc_assert( sc_get_parallel_method_workers() == 4 );
+
+    top t("top");
+    sc_start();
+
+    sc_set_parallel_method_workers( 0 );
+    return 0;
+}
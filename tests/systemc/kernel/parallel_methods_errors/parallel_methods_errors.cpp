@@ -0,0 +1,157 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  parallel_methods_errors.cpp -- Test that the restrictions of concurrently
+                                 evaluated methods are checked in every build
+
+  The errors are only counted, so that the simulation continues after
+  each of them, in whatever order the host threads report them.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+#include <cstring>
+
+using namespace sc_core;
+
+// enough methods for a concurrent evaluation, see crunch_concurrent_methods,
+// split into 4 chunks per host thread
+static const int count = 64;
+static const int host_threads = 4;
+static const int chunk_size = count / ( 4 * host_threads );
+
+SC_MODULE(worker)
+{
+    sc_signal<int>*                       own;
+    sc_signal<int, SC_UNCHECKED_WRITERS>* shared;
+    sc_event*                             event;  // only set for one worker
+    int                                   id;
+    int                                   runs;
+
+    SC_CTOR(worker)
+      : own(0), shared(0), event(0), id(0), runs(0)
+    {
+        SC_METHOD(work);
+          set_parallel_safe();
+    }
+
+    void work()
+    {
+        ++runs;
+        own->write( runs );
+        if( runs == 2 && shared )
+            shared->write( id + 1 ); // a new value from each worker
+        if( runs == 3 && event )
+            event->notify( SC_ZERO_TIME );
+        if( runs == 4 && event ) // stops the simulation, see sc_main
+            SC_REPORT_WARNING( "parallel_methods_errors", "stop" );
+        if( runs < 4 )
+            next_trigger( 10, SC_NS );
+    }
+};
+
+SC_MODULE(top)
+{
+    sc_vector< sc_signal<int> >          own;
+    sc_signal<int, SC_UNCHECKED_WRITERS> shared;
+    sc_event                             ev;
+    sc_vector< worker >                  workers;
+
+    SC_CTOR(top)
+      : own("own", count)
+      , shared("shared")
+      , ev("ev")
+      , workers("workers", count)
+    {
+        for( int i = 0; i < count; ++i ) {
+            workers[i].own = &own[i];
+            workers[i].id = i;
+        }
+        // all workers write the shared signal: the methods of one chunk of
+        // the batch may do so, those of the other chunks fail
+        for( int i = 0; i < count; ++i )
+            workers[i].shared = &shared;
+        workers[count / 2].event = &ev;
+    }
+};
+
+static int update_errors = 0;
+static int notify_errors = 0;
+
+static void count_handler( const sc_report& rep, const sc_actions& actions )
+{
+    // reports are serialized, see sc_report_handler::report
+    if( !std::strcmp( rep.get_msg_type(), SC_ID_CONCURRENT_UPDATE_REQUEST_ ) ) {
+        ++update_errors;
+    } else if( !std::strcmp( rep.get_msg_type(),
+                             SC_ID_CONCURRENT_NOTIFICATION_ ) ) {
+        ++notify_errors;
+    } else {
+        sc_report_handler::default_handler( rep, actions );
+    }
+}
+
+int sc_main( int, char*[] )
+{
+    sc_report_handler::set_handler( count_handler );
+    sc_report_handler::set_actions( SC_ID_CONCURRENT_UPDATE_REQUEST_,
+                                     SC_DISPLAY );
+    sc_report_handler::set_actions( SC_ID_CONCURRENT_NOTIFICATION_,
+                                     SC_DISPLAY );
+    sc_report_handler::set_actions( "parallel_methods_errors",
+                                     SC_DISPLAY | SC_STOP );
+    sc_set_parallel_method_workers( host_threads );
+
+    top t("top");
+    sc_start( 30, SC_NS );
+
+    int runs = 0;
+    for( int i = 0; i < count; ++i )
+        runs += t.workers[i].runs;
+    std::cout << sc_time_stamp() << ": " << runs << " runs, own[0] = "
+              << t.own[0].read() << std::endl;
+    std::cout << "update request errors: "
+              << ( update_errors == count - chunk_size ? "one per method "
+                   "of the other chunks" : "WRONG NUMBER" ) << std::endl;
+    std::cout << "notification errors: " << notify_errors << std::endl;
+
+    // sc_stop() is not available to the method, the report fails it instead
+    try {
+        sc_start( 10, SC_NS );
+        std::cout << "simulation not stopped" << std::endl;
+    } catch( const sc_report& rep ) {
+        std::cout << "caught: " << rep.get_msg_type() << ": "
+                  << rep.get_msg() << std::endl;
+    }
+
+    sc_set_parallel_method_workers( 0 );
+    return 0;
+}
@@ -0,0 +1,174 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  profiling.cpp -- Test of the kernel profile written to SC_PROFILE
+
+  The library has to be built with SC_ENABLE_PROFILING, the test is
+  skipped otherwise.  The CSV profile of a known mix of processes is read
+  back after sc_stop() and printed without the wall times.  The target
+  thread is reset and killed by another thread, which must not count
+  another activation of the preempted thread, but another context switch
+  to it.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace sc_core;
+
+SC_MODULE(top)
+{
+    sc_event          tick;
+    sc_process_handle target_h;
+
+    SC_CTOR(top)
+      : tick("tick")
+    {
+        SC_THREAD(driver);
+        SC_METHOD(ticker);
+          sensitive << tick;
+          dont_initialize();
+        SC_THREAD(target);
+          target_h = sc_get_current_process_handle();
+        SC_THREAD(resetter);
+    }
+
+    // 6 activations and context switches: at 0 ns and after each of the
+    // 5 waits
+    void driver()
+    {
+        for( int i = 0; i < 5; ++i ) {
+            wait( 10, SC_NS );
+            tick.notify();
+        }
+    }
+
+    // 5 activations: at 10, 20, 30, 40 and 50 ns, no context switches
+    void ticker()
+    {
+    }
+
+    // 7 activations and context switches: at 0, 10, 20 ns, the reset at
+    // 25 ns, at 30, 40 ns and the kill at 45 ns
+    void target()
+    {
+        for( ;; ) {
+            wait( tick );
+        }
+    }
+
+    // 4 activations: at 0, 25, 45 and 55 ns, and 6 context switches, as
+    // the thread is resumed after the reset and the kill
+    void resetter()
+    {
+        wait( 25, SC_NS );
+        target_h.reset();
+        wait( 20, SC_NS );
+        target_h.kill();
+        wait( 10, SC_NS );
+        sc_stop();
+    }
+};
+
+// splits a CSV line, the names in this test contain no quotes or commas
+
+static std::vector<std::string>
+fields( const std::string& line )
+{
+    std::vector<std::string> result( 1 );
+    for( std::string::size_type i = 0; i < line.size(); ++i ) {
+        if( line[i] == ',' ) {
+            result.push_back( std::string() );
+        } else if( line[i] != '"' ) {
+            result.back() += line[i];
+        }
+    }
+    return result;
+}
+
+int
+sc_main( int, char*[] )
+{
+    static char profile[] = "SC_PROFILE=profiling.csv";
+    putenv( profile );
+
+    top t( "top" );
+    sc_start();
+
+    std::ifstream csv( "profiling.csv" );
+    sc_assert( csv );
+
+    std::string line;
+    std::getline( csv, line );
+    std::cout << line << std::endl;
+
+    std::vector<std::string> processes;
+    std::vector<std::string> events;
+    std::vector<std::string> time_steps;
+    while( std::getline( csv, line ) ) {
+        std::vector<std::string> f = fields( line );
+        sc_assert( f.size() == 6 );
+        if( f[0] == "kernel" ) {
+            sc_assert( std::atof( f[5].c_str() ) >= 0.0 );
+        } else if( f[0] == "process" ) {
+            sc_assert( std::atof( f[5].c_str() ) >= 0.0 );
+            processes.push_back( f[1] + " " + f[2] + " " + f[3] + " " + f[4] );
+        } else if( f[0] == "event" ) {
+            events.push_back( f[1] + " " + f[3] );
+        } else {
+            sc_assert( f[0] == "time_step" && f[2] == "delta_cycles" );
+            time_steps.push_back( f[1] + " " + f[3] );
+        }
+    }
+
+    // processes and events are sorted by their (varying) wall times and
+    // trigger counts in the file
+    std::sort( processes.begin(), processes.end() );
+    std::sort( events.begin(), events.end() );
+
+    std::cout << "processes:" << std::endl;
+    for( std::size_t i = 0; i < processes.size(); ++i )
+        std::cout << "  " << processes[i] << std::endl;
+    std::cout << "events:" << std::endl;
+    for( std::size_t i = 0; i < events.size(); ++i )
+        std::cout << "  " << events[i] << std::endl;
+    std::cout << "delta cycles:" << std::endl;
+    for( std::size_t i = 0; i < time_steps.size(); ++i )
+        std::cout << "  " << time_steps[i] << std::endl;
+
+    return 0;
+}
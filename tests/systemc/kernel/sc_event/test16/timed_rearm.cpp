@@ -0,0 +1,176 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  timed_rearm.cpp -- test cancelling and re-arming timed notifications
+
+  Compile with -DBENCHMARK to measure the cost of re-arming timeouts,
+  i.e. of cancelled and moved entries in the timed event queue.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+#include <iomanip>
+
+#ifdef BENCHMARK
+# include <chrono>
+  static const unsigned num_watchdogs  = 1000;
+  static const unsigned num_iterations = 10000;
+# define CHECK(expr) ((void)0)
+#else
+  static const unsigned num_watchdogs  = 8;
+  static const unsigned num_iterations = 4;
+# define CHECK(expr) sc_assert(expr)
+#endif
+
+using namespace sc_core;
+
+SC_MODULE( module )
+{
+  sc_vector<sc_event> kick;    // restart the watchdogs
+  sc_event            ev;      // explicit re-notification checks
+  unsigned            timeouts;
+  unsigned            kicks;
+
+  SC_CTOR( module )
+    : kick("kick", num_watchdogs)
+    , timeouts()
+    , kicks()
+  {
+    SC_THREAD(renotify);
+    SC_METHOD(ev_method);
+      sensitive << ev;
+      dont_initialize();
+
+    for(unsigned i = 0; i < num_watchdogs; ++i)
+      sc_spawn( sc_bind( &module::watchdog, this, i ) );
+    SC_THREAD(driver);
+  }
+
+private:
+
+  void log(const char* msg)
+  {
+#ifndef BENCHMARK
+    using namespace std;
+    cout << setw(6) << sc_time_stamp()
+         << " (" << sc_delta_count() << "): " << msg << endl;
+#endif
+  }
+
+  void ev_method()
+    { log("ev triggered"); }
+
+  // re-notification of a pending timed event
+  void renotify()
+  {
+    log("ev.notify(10 ns), ev.notify(5 ns) -> 5 ns");
+    ev.notify(10, SC_NS);
+    ev.notify(5, SC_NS);
+    wait(20, SC_NS);
+
+    log("ev.notify(5 ns), ev.notify(10 ns) -> 5 ns");
+    ev.notify(5, SC_NS);
+    ev.notify(10, SC_NS);
+    wait(20, SC_NS);
+
+    log("ev.notify(10 ns), ev.cancel(), ev.notify(15 ns) -> 15 ns");
+    ev.notify(10, SC_NS);
+    ev.cancel();
+    ev.notify(15, SC_NS);
+    wait(20, SC_NS);
+
+    log("ev.notify(10 ns), ev.notify(SC_ZERO_TIME) -> delta");
+    ev.notify(10, SC_NS);
+    ev.notify(SC_ZERO_TIME);
+    wait(20, SC_NS);
+
+    log("ev.notify(10 ns), ev.notify() -> now");
+    ev.notify(10, SC_NS);
+    ev.notify();
+    wait(20, SC_NS);
+
+    log("ev.notify(10 ns), ev.cancel() -> never");
+    ev.notify(10, SC_NS);
+    ev.cancel();
+    wait(20, SC_NS);
+  }
+
+  // restarted before every timeout except for the last one
+  void watchdog(unsigned id)
+  {
+    const sc_time timeout(100 + id, SC_NS);
+    while(true) {
+      wait(timeout, kick[id]);
+      if (!kick[id].triggered()) {
+        ++timeouts;
+        log((std::string("timeout of ") + kick[id].basename()).c_str());
+        break;
+      }
+      ++kicks;
+    }
+  }
+
+  void driver()
+  {
+    for(unsigned iter = 0; iter < num_iterations; ++iter) {
+      wait(50, SC_NS);
+      for(unsigned i = 0; i < num_watchdogs; ++i) {
+        kick[i].notify(sc_time(i % 10, SC_NS));
+      }
+    }
+    log("driver done");
+  }
+};
+
+
+int
+sc_main( int, char*[] )
+{
+    module m("m");
+
+#ifdef BENCHMARK
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+#endif
+    sc_start();
+#ifdef BENCHMARK
+    std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+    std::cout << num_watchdogs * num_iterations << " re-arms in "
+              << elapsed.count() << " s" << std::endl;
+#endif
+
+    CHECK( m.kicks == num_watchdogs * num_iterations );
+    CHECK( m.timeouts == num_watchdogs );
+    std::cout << m.kicks << " kicks, " << m.timeouts << " timeouts at "
+              << sc_time_stamp() << std::endl;
+    return 0;
+}
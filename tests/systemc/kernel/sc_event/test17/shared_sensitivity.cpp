@@ -0,0 +1,194 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  shared_sensitivity.cpp -- test many delta notified events waking the same
+                            statically sensitive processes
+
+  Compile with -DBENCHMARK to measure the cost of the notification phase
+  for a large number of events sharing the same static sensitivity.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+#include <iomanip>
+
+#ifdef BENCHMARK
+# include <chrono>
+  static const unsigned num_events = 2000;
+  static const unsigned num_rounds = 20000;
+#else
+  static const unsigned num_events = 16;
+  static const unsigned num_rounds = 3;
+#endif
+
+using namespace sc_core;
+
+SC_MODULE( module )
+{
+  sc_vector<sc_event> ev;
+  unsigned            m0_runs, m1_runs, t0_runs, t1_runs, spawned_runs;
+  sc_dt::uint64       m0_delta;
+  sc_process_handle   m1_h;
+
+  SC_CTOR( module )
+    : ev("ev", num_events)
+    , m0_runs(), m1_runs(), t0_runs(), t1_runs(), spawned_runs()
+    , m0_delta( ~sc_dt::UINT64_ZERO )
+  {
+    SC_METHOD(m0);
+      for( unsigned i = 0; i < num_events; ++i ) sensitive << ev[i];
+      dont_initialize();
+    SC_METHOD(m1);
+      for( unsigned i = 0; i < num_events; ++i ) sensitive << ev[i];
+      dont_initialize();
+    m1_h = sc_get_current_process_handle();
+    SC_THREAD(t0);
+      for( unsigned i = 0; i < num_events; ++i ) sensitive << ev[i];
+    SC_THREAD(t1);
+      for( unsigned i = 0; i < num_events; ++i ) sensitive << ev[i];
+    SC_THREAD(driver);
+  }
+
+private:
+
+  void log(const char* msg)
+  {
+#ifndef BENCHMARK
+    using namespace std;
+    cout << setw(6) << sc_time_stamp()
+         << " (" << sc_delta_count() << "): " << msg
+         << " -- m0 " << m0_runs << ", m1 " << m1_runs
+         << ", t0 " << t0_runs << ", t1 " << t1_runs
+         << ", spawned " << spawned_runs << endl;
+#endif
+  }
+
+  void m0()
+  {
+    // at most once per delta cycle
+    sc_assert( m0_delta != sc_delta_count() );
+    m0_delta = sc_delta_count();
+    ++m0_runs;
+  }
+
+  void m1()
+    { ++m1_runs; }
+
+  void spawned()
+    { ++spawned_runs; }
+
+  void t0()
+  {
+    wait();
+    for(;;) {
+      ++t0_runs;
+      wait();
+    }
+  }
+
+  // each triggering event counts against the wait count
+  void t1()
+  {
+    wait();
+    for(;;) {
+      ++t1_runs;
+      wait(2);
+    }
+  }
+
+  void notify_all()
+  {
+    for( unsigned i = 0; i < num_events; ++i )
+      ev[i].notify(SC_ZERO_TIME);
+  }
+
+  void driver()
+  {
+    log("start");
+
+    for( unsigned r = 0; r < num_rounds; ++r ) {
+      notify_all();
+      wait(1, SC_NS);
+    }
+    log("all events notified");
+
+    ev[num_events - 1].notify(SC_ZERO_TIME);
+    wait(1, SC_NS);
+    log("single event notified");
+
+    m1_h.disable();
+    notify_all();
+    wait(1, SC_NS);
+    log("m1 disabled, all events notified");
+    m1_h.enable();
+
+    sc_spawn_options opt;
+    opt.spawn_method();
+    opt.dont_initialize();
+    opt.set_sensitivity( &ev[0] );
+    opt.set_sensitivity( &ev[num_events / 2] );
+    sc_spawn( sc_bind( &module::spawned, this ), "spawned", &opt );
+    notify_all();
+    wait(1, SC_NS);
+    log("spawned method, all events notified");
+
+    // immediate notification in the evaluation phase, followed by the
+    // delta notifications of the same events in the notification phase
+    ev[0].notify();
+    wait(SC_ZERO_TIME);
+    log("immediate notification");
+    notify_all();
+    wait(1, SC_NS);
+    log("all events notified");
+  }
+};
+
+
+int
+sc_main( int, char*[] )
+{
+    module m("m");
+
+#ifdef BENCHMARK
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+#endif
+    sc_start();
+#ifdef BENCHMARK
+    std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+    std::cout << num_events * (num_rounds + 3) << " notifications in "
+              << elapsed.count() << " s" << std::endl;
+#endif
+
+    std::cout << m.m0_runs << " m0 runs at " << sc_time_stamp() << std::endl;
+    return 0;
+}
@@ -0,0 +1,191 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  compact_waiters.cpp -- test the order in which static and dynamic waiters
+                         of an event are woken while they are added and
+                         removed, and the names of events and kernel events
+
+  Compile with -DBENCHMARK to measure the creation and notification of 5M
+  events.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc>
+
+#ifdef BENCHMARK
+# include <chrono>
+#endif
+
+using namespace sc_core;
+using std::cout;
+using std::endl;
+
+SC_MODULE( module )
+{
+  sc_event              ev;
+  sc_event              other;
+  sc_signal<bool>       sig;
+  std::vector<sc_process_handle> handles;
+
+  SC_CTOR( module )
+    : ev( "ev" ), other( "other" ), sig( "sig" )
+  {
+    // static waiters of both kinds
+    sc_spawn_options method_opt;
+    method_opt.spawn_method();
+    method_opt.set_sensitivity( &ev );
+    method_opt.dont_initialize();
+    sc_spawn_options thread_opt;
+    thread_opt.set_sensitivity( &ev );
+    thread_opt.dont_initialize();
+    for( int i = 0; i < 3; ++i ) {
+      handles.push_back( sc_spawn( sc_bind( &module::static_method, this, i ),
+                                   sc_gen_unique_name( "static_method" ),
+                                   &method_opt ) );
+      handles.push_back( sc_spawn( sc_bind( &module::static_thread, this, i ),
+                                   sc_gen_unique_name( "static_thread" ),
+                                   &thread_opt ) );
+    }
+    for( int i = 0; i < 4; ++i ) {
+      sc_spawn( sc_bind( &module::dynamic_thread, this, i ),
+                sc_gen_unique_name( "dynamic_thread" ) );
+    }
+    SC_THREAD( driver );
+  }
+
+  void static_method( int i )
+  {
+    cout << "  static_method " << i << endl;
+  }
+
+  void static_thread( int i )
+  {
+    for( ;; ) {
+      cout << "  static_thread " << i << endl;
+      wait();
+    }
+  }
+
+  void dynamic_thread( int i )
+  {
+    for( int k = 0; ; ++k ) {
+      if( ( i + k ) % 2 )
+        wait( ev | other );
+      else
+        wait( ev );
+      cout << "  dynamic_thread " << i << endl;
+      if( i == 3 && k == 1 )
+        spawn_late_method();
+    }
+  }
+
+  void spawn_late_method()
+  {
+    sc_spawn_options opt;
+    opt.spawn_method();
+    opt.dont_initialize();
+    opt.set_sensitivity( &ev );
+    handles.push_back( sc_spawn( sc_bind( &module::static_method, this, 9 ),
+                                 "late_static_method", &opt ) );
+  }
+
+  void driver()
+  {
+    for( int round = 0; round < 5; ++round ) {
+      wait( 1, SC_NS );
+      cout << sc_time_stamp() << ": notify ev" << endl;
+      switch( round ) {
+        case 1: other.notify(); break;                  // or-list waiters
+        case 2: handles[1].kill(); handles[2].kill(); break;  // static removal
+        case 3: handles[4].disable(); break;
+        default: ;
+      }
+      ev.notify();
+    }
+  }
+};
+
+void print_event( const sc_event& e )
+{
+  cout << "'" << e.name() << "' '" << e.basename() << "' "
+       << e.in_hierarchy() << " " << ( e.get_parent_object() != 0 ) << endl;
+}
+
+#ifdef BENCHMARK
+void benchmark()
+{
+  typedef std::chrono::steady_clock clock;
+
+  const int event_n = 5000000;
+  clock::time_point start = clock::now();
+  std::vector<sc_event*> events( event_n );
+  for( int i = 0; i < event_n; ++i )
+    events[i] = new sc_event;
+  clock::time_point built = clock::now();
+  for( int i = 0; i < event_n; ++i )
+    delete events[i];
+  clock::time_point destroyed = clock::now();
+
+  cout << "benchmark " << event_n << " events: build "
+       << std::chrono::duration<double>( built - start ).count()
+       << " s, destroy "
+       << std::chrono::duration<double>( destroyed - built ).count()
+       << " s" << endl;
+}
+#endif
+
+int sc_main( int, char*[] )
+{
+#ifdef BENCHMARK
+  benchmark();
+#endif
+
+  module top( "top" );
+
+  print_event( top.ev );
+  print_event( top.sig.value_changed_event() );
+  sc_set_unnamed_kernel_events( true );
+  print_event( top.sig.posedge_event() );
+  sc_set_unnamed_kernel_events( false );
+  print_event( top.sig.negedge_event() );
+  sc_event unnamed;
+  print_event( unnamed );
+  cout << ( sc_find_event( "top.ev" ) == &top.ev ) << endl;
+
+  sc_start();
+
+  sc_event during_simulation;
+  print_event( during_simulation );
+
+  cout << "Program completed" << endl;
+  return 0;
+}
@@ -0,0 +1,171 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  event_expressions.cpp -- test repeated waits on temporary event
+                           expressions, whose lists are reused
+
+  Compile with -DBENCHMARK to measure 1M waits of a thread and 1M
+  next_trigger calls of a method on temporary event expressions.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc>
+
+#ifdef BENCHMARK
+# include <chrono>
+  static const int num_iterations = 1000000;
+#else
+  static const int num_iterations = 4;
+#endif
+
+using namespace sc_core;
+using std::cout;
+using std::endl;
+
+SC_MODULE( module )
+{
+  sc_event          a, b, c, d;
+  sc_event_or_list  named_or;
+  sc_process_handle victim;
+  int               method_count;
+
+  SC_CTOR( module )
+    : a( "a" ), b( "b" ), c( "c" ), d( "d" ), method_count( 0 )
+  {
+    // an expression copied into a named list
+    named_or = a | b;
+    named_or |= c;
+    cout << "named_or " << named_or.size() << endl;
+
+    // expressions that are never waited for
+    {
+      sc_event_and_list unused = a & b & c & d;
+      cout << "unused " << unused.size() << endl;
+    }
+    {
+      sc_event_or_expr expr = a | b | a;
+    }
+
+    SC_THREAD( waiter );
+    SC_METHOD( method );
+    dont_initialize();
+    sensitive << d;
+    victim = sc_spawn( sc_bind( &module::victim_thread, this ), "victim" );
+    SC_THREAD( driver );
+  }
+
+  void waiter()
+  {
+    for( int i = 0; i < num_iterations; ++i ) {
+      wait( a | b | c );
+      report( "or" );
+      wait( a & b );
+      report( "and" );
+      wait( 5, SC_NS, c | d );
+      report( "or with timeout" );
+      wait( named_or );
+      report( "named or" );
+    }
+  }
+
+  void method()
+  {
+    if( ++method_count > 2 * num_iterations ) {
+      next_trigger( d );
+      return;
+    }
+    report( "method" );
+    if( method_count % 2 )
+      next_trigger( a | b );
+    else
+      next_trigger( b & c & d );
+  }
+
+  void victim_thread()
+  {
+    for( ;; ) {
+      wait( a & b & c & d );
+      report( "victim" );
+    }
+  }
+
+  void report( const char* what )
+  {
+#ifndef BENCHMARK
+    cout << sc_time_stamp() << ": " << what << endl;
+#endif
+  }
+
+  void driver()
+  {
+    d.notify();
+    wait( SC_ZERO_TIME );
+    for( int i = 0; i < num_iterations; ++i ) {
+      wait( 1, SC_NS );
+      a.notify();
+      wait( 1, SC_NS );
+      b.notify();
+      wait( 1, SC_NS );
+      c.notify();
+      d.notify( SC_ZERO_TIME );
+      wait( 1, SC_NS );
+      b.notify();
+      if( i == 1 )
+        victim.kill();
+      wait( 10, SC_NS );
+      c.notify();
+    }
+  }
+};
+
+int sc_main( int, char*[] )
+{
+  module top( "top" );
+
+#ifdef BENCHMARK
+  typedef std::chrono::steady_clock clock;
+  clock::time_point start = clock::now();
+#endif
+
+  sc_start();
+
+#ifdef BENCHMARK
+  clock::time_point stop = clock::now();
+  cout << "benchmark " << num_iterations << " iterations: "
+       << std::chrono::duration<double>( stop - start ).count() << " s"
+       << endl;
+#endif
+
+  cout << sc_time_stamp() << " method " << top.method_count << endl;
+  cout << "Program completed" << endl;
+  return 0;
+}
@@ -0,0 +1,195 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  test04.cpp -- lookup of objects, events and external names by their
+                hierarchical names, while they are created and destroyed
+
+  Compile with -DBENCHMARK to measure the creation, lookup and destruction
+  of 1M objects in a deep hierarchy with long names.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+#ifdef BENCHMARK
+# include <chrono>
+#endif
+
+class leaf : public sc_object
+{
+  public:
+    explicit leaf( const char* name_ ) : sc_object( name_ ) {}
+};
+
+SC_MODULE(node)
+{
+    std::vector<node*>     nodes;
+    std::vector<leaf*>     leaves;
+    std::vector<sc_event*> events;
+
+    node( sc_module_name name_, int depth, int fanout, int leaf_n )
+      : sc_module( name_ )
+    {
+        for( int i = 0; depth > 0 && i < fanout; ++ i ) {
+            nodes.push_back( new node( sc_gen_unique_name( "sub_module" ),
+                                       depth - 1, fanout, leaf_n ) );
+        }
+        for( int i = 0; i < leaf_n; ++ i ) {
+            leaves.push_back( new leaf( sc_gen_unique_name( "leaf_object" ) ) );
+            events.push_back( new sc_event( sc_gen_unique_name( "event" ) ) );
+        }
+    }
+
+    ~node()
+    {
+        for( std::size_t i = 0; i < nodes.size(); ++ i ) {
+            delete nodes[i];
+        }
+        for( std::size_t i = 0; i < leaves.size(); ++ i ) {
+            delete leaves[i];
+            delete events[i];
+        }
+    }
+};
+
+void find( const char* name )
+{
+    sc_object* object_p = sc_find_object( name );
+    sc_event*  event_p = sc_find_event( name );
+    cout << "find " << name << ":";
+    if( object_p ) {
+        cout << " object " << object_p->name() << " (" << object_p->kind()
+             << ")";
+    }
+    if( event_p ) {
+        cout << " event " << event_p->name();
+    }
+    if( sc_hierarchical_name_exists( name ) ) {
+        cout << " exists " << sc_get_hierarchical_name( name );
+    }
+    cout << endl;
+}
+
+void walk()
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    cout << "objects:";
+    for( sc_object* obj_p = simc_p->first_object(); obj_p;
+         obj_p = simc_p->next_object() ) {
+        cout << " " << obj_p->name();
+    }
+    cout << endl;
+}
+
+#ifdef BENCHMARK
+void benchmark()
+{
+    typedef std::chrono::steady_clock clock;
+
+    // 8 levels of 5 modules with 3 objects and 3 events each: ~1M names
+    clock::time_point start = clock::now();
+    node* top_p = new node( "benchmark_top_level_module", 7, 5, 3 );
+    clock::time_point built = clock::now();
+
+    int found = 0;
+    for( int i = 0; i < 3; ++ i ) {
+        std::string name = top_p->name();
+        for( node* node_p = top_p; !node_p->nodes.empty(); ) {
+            node_p = node_p->nodes[i];
+            name = node_p->name();
+        }
+        for( int j = 0; j < 100000; ++ j ) {
+            found += sc_find_object( ( name + ".leaf_object_0" ).c_str() ) != 0;
+        }
+    }
+    clock::time_point looked_up = clock::now();
+    delete top_p;
+    clock::time_point destroyed = clock::now();
+
+    cout << "benchmark: build "
+         << std::chrono::duration<double>( built - start ).count()
+         << " s, " << found << " lookups "
+         << std::chrono::duration<double>( looked_up - built ).count()
+         << " s, destroy "
+         << std::chrono::duration<double>( destroyed - looked_up ).count()
+         << " s" << endl;
+}
+#endif
+
+int sc_main( int, char*[] )
+{
+#ifdef BENCHMARK
+    benchmark();
+#endif
+
+    node* top_p = new node( "top", 2, 2, 1 );
+    node  other( "top-other", 0, 0, 2 );
+    leaf  x( "x" );
+    sc_event e( "e" );
+
+    walk();
+    find( "top" );
+    find( "top.sub_module_1.sub_module_0" );
+    find( "top.sub_module_1.sub_module_0.leaf_object_0" );
+    find( "top.sub_module_1.event_0" );
+    find( "top.sub_module_1." );
+    find( "top..sub_module_1" );
+    find( "top-other.leaf_object_1" );
+    find( "top.leaf_object_1" );
+    find( "x" );
+    find( "e" );
+    find( "" );
+
+    // external names share the name space of objects and events
+    sc_register_hierarchical_name( "top.external" );
+    sc_register_hierarchical_name( top_p->nodes[0], "external" );
+    sc_register_hierarchical_name( "top.sub_module_0" );
+    sc_register_hierarchical_name( "outside.deep.name" );
+    find( "top.external" );
+    find( "top.sub_module_0.external" );
+    find( "outside.deep.name" );
+    find( "outside.deep" );
+    sc_unregister_hierarchical_name( "top.external" );
+    find( "top.external" );
+
+    // destroyed objects leave their names to new objects
+    delete top_p->nodes[1];
+    top_p->nodes.pop_back();
+    find( "top.sub_module_1" );
+    find( "top.sub_module_1.event_0" );
+    walk();
+
+    leaf relocated( "relocated" );
+    find( "relocated" );
+    {
+        sc_event tmp( "x" );
+        find( "x_0" );
+    }
+    find( "x_0" );
+
+    delete top_p;
+    find( "top" );
+    find( "top.sub_module_0.external" );
+    walk();
+
+    cout << "Program completed" << endl;
+    return 0;
+}
@@ -0,0 +1,341 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  test01.cpp -- test of VCB tracing (value change blocks)
+
+  Enough changes are traced to fill several blocks.  The file is read back
+  the way a viewer would: through the index at its end, decoding only the
+  chunks of the signals and blocks asked for.  The output doesn't depend on
+  whether the chunks have been compressed.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include "systemc.h"
+#include "sysc/tracing/sc_trace_gzip.h"
+
+#include <cstdlib>
+#include <fstream>
+
+SC_MODULE( counter )
+{
+    sc_in_clk clk;
+
+    sc_out<sc_uint<32> > count;
+    sc_out<sc_lv<8> >    bus;
+    double               level;
+
+    void step()
+    {
+        sc_uint<32> next = count.read() + 1;
+        count = next;
+        if( next[0] )
+            bus = sc_lv<8>( SC_LOGIC_Z );
+        else
+            bus = sc_lv<8>( next.range( 7, 0 ) );
+        level = next.to_double() / 8;
+    }
+
+    SC_CTOR( counter )
+      : level( 0 )
+    {
+        SC_METHOD( step );
+        sensitive << clk.pos();
+        dont_initialize();
+    }
+};
+
+// format errors end the test, its output is compared with the golden log
+static void
+expect( bool ok, const char* what )
+{
+    if( !ok ) {
+        cout << "error: " << what << endl;
+        std::exit( 1 );
+    }
+}
+
+// ----------------------------------------------------------------------------
+//  reader of VCB files, see sc_vcb_trace.h for the format
+// ----------------------------------------------------------------------------
+
+struct vcb_reader
+{
+    struct change
+    {
+        sc_dt::uint64 time;
+        std::string   value;
+    };
+
+    struct block
+    {
+        sc_dt::uint64 first_time;
+        sc_dt::uint64 last_time;
+        sc_dt::uint64 offset;
+    };
+
+    std::ifstream            in;
+    sc_dt::uint64            timescale_fs;
+    std::vector<std::string> names;
+    std::vector<int>         types;
+    std::vector<int>         widths;
+    std::vector<block>       blocks;
+
+    explicit vcb_reader( const char* name )
+      : in( name, std::ios::binary ), timescale_fs( 0 )
+    {
+        char magic[8];
+        in.read( magic, 8 );
+        expect( in && std::string( magic, 8 ) == "SCVCB01\n", "header magic" );
+
+        timescale_fs = varint();
+        read_string(); // date
+        read_string(); // version
+        names.resize( varint() );
+        for( std::size_t i = 0; i < names.size(); ++i ) {
+            names[i] = read_string();
+            types.push_back( in.get() );
+            widths.push_back( static_cast<int>( varint() ) );
+        }
+
+        // the index, from the trailer at the end
+        char trailer[16];
+        in.seekg( -16, std::ios::end );
+        in.read( trailer, 16 );
+        expect( in && std::string( trailer + 8, 8 ) == "SCVCBIDX", "trailer magic" );
+        sc_dt::uint64 index_offset = 0;
+        for( int i = 7; i >= 0; --i )
+            index_offset = ( index_offset << 8 )
+                         | static_cast<unsigned char>( trailer[i] );
+        in.seekg( index_offset );
+        expect( in.get() == 'I', "index tag" );
+        blocks.resize( varint() );
+        for( std::size_t b = 0; b < blocks.size(); ++b ) {
+            blocks[b].first_time = varint();
+            blocks[b].last_time  = varint();
+            blocks[b].offset     = varint();
+        }
+    }
+
+    sc_dt::uint64 varint()
+    {
+        sc_dt::uint64 value = 0;
+        int shift = 0;
+        int c;
+        do {
+            c = in.get();
+            expect( c != EOF, "end of file" );
+            value |= sc_dt::uint64( c & 0x7f ) << shift;
+            shift += 7;
+        } while( c & 0x80 );
+        return value;
+    }
+
+    std::string read_string()
+    {
+        std::string s( varint(), '\0' );
+        if( !s.empty() )
+            in.read( &s[0], s.size() );
+        return s;
+    }
+
+    // block containing time t (the last one starting at or before it)
+    std::size_t find_block( sc_dt::uint64 t ) const
+    {
+        std::size_t b = 0;
+        while( b + 1 < blocks.size() && blocks[b + 1].first_time <= t )
+            ++b;
+        return b;
+    }
+
+    // append the changes of a trace in block b, reading only its chunk
+    void read_changes( std::size_t b, int trace, std::vector<change>& changes )
+    {
+        in.seekg( blocks[b].offset );
+        expect( in.get() == 'B', "block tag" );
+        std::vector<sc_dt::uint64> times( varint() );
+        for( std::size_t t = 0; t < times.size(); ++t )
+            times[t] = varint() + ( t ? times[t - 1] : 0 );
+        expect( times.front() == blocks[b].first_time, "block start time" );
+        expect( times.back() == blocks[b].last_time, "block end time" );
+
+        // directory: skip the chunks of the other traces
+        std::size_t count = varint();
+        sc_dt::uint64 skip = 0, stored = 0, size = 0;
+        int method = -1;
+        for( std::size_t c = 0; c < count; ++c ) {
+            int t = static_cast<int>( varint() );
+            int m = in.get();
+            sc_dt::uint64 s = varint();
+            sc_dt::uint64 n = varint();
+            if( t == trace ) {
+                method = m;
+                stored = s;
+                size   = n;
+            } else if( method < 0 ) {
+                skip += s;
+            }
+        }
+        if( method < 0 )
+            return; // no changes in this block
+
+        in.seekg( skip, std::ios::cur );
+        std::string data( stored, '\0' );
+        in.read( &data[0], stored );
+        if( method == 1 ) {
+            std::string raw;
+            expect( sc_trace_gzip::uncompress( data.data(), data.size()
+                                             , raw, size ), "chunk data" );
+            data.swap( raw );
+        }
+        expect( data.size() == size, "chunk size" );
+
+        // changes: time index delta, value length, value
+        std::size_t pos = 0, index = 0;
+        while( pos < data.size() ) {
+            index += get_varint( data, pos );
+            change ch;
+            ch.time = times[index];
+            std::size_t len = get_varint( data, pos );
+            ch.value = data.substr( pos, len );
+            pos += len;
+            changes.push_back( ch );
+        }
+    }
+
+    static sc_dt::uint64 get_varint( const std::string& data, std::size_t& pos )
+    {
+        sc_dt::uint64 value = 0;
+        int shift = 0;
+        unsigned char c;
+        do {
+            c = static_cast<unsigned char>( data[pos++] );
+            value |= sc_dt::uint64( c & 0x7f ) << shift;
+            shift += 7;
+        } while( c & 0x80 );
+        return value;
+    }
+};
+
+static void
+check_file( const char* name )
+{
+    static const char* types[] = { "wire", "real", "event", "time" };
+
+    vcb_reader r( name );
+    cout << "timescale: " << r.timescale_fs << " fs" << endl;
+    for( std::size_t i = 0; i < r.names.size(); ++i )
+        cout << "trace " << r.names[i] << ": " << types[r.types[i]]
+             << " " << r.widths[i] << endl;
+
+    cout << r.blocks.size() << " blocks" << endl;
+    for( std::size_t b = 0; b < r.blocks.size(); ++b ) {
+        cout << "  block " << b << ": " << r.blocks[b].first_time
+             << " - " << r.blocks[b].last_time << endl;
+        expect( b == 0 || r.blocks[b].first_time > r.blocks[b - 1].last_time
+              , "block order" );
+    }
+
+    // all changes of each trace, block by block
+    for( int i = 0; i < static_cast<int>( r.names.size() ); ++i ) {
+        std::vector<vcb_reader::change> changes;
+        for( std::size_t b = 0; b < r.blocks.size(); ++b )
+            r.read_changes( b, i, changes );
+
+        cout << r.names[i] << ": " << changes.size() << " changes, first";
+        for( std::size_t c = 0; c < 3 && c < changes.size(); ++c )
+            cout << " " << changes[c].value << "@" << changes[c].time;
+        cout << ", last " << changes.back().value << "@"
+             << changes.back().time << endl;
+
+        for( std::size_t c = 1; c < changes.size(); ++c ) {
+            if( changes[c].time <= changes[c - 1].time ) {
+                cout << "  time not increasing at change " << c << endl;
+                break;
+            }
+        }
+        // the counter increments once per clock cycle
+        if( r.names[i] == "count" ) {
+            for( std::size_t c = 1; c < changes.size(); ++c ) {
+                // binary vector values, "b" followed by the bits
+                unsigned long long prev =
+                    std::strtoull( changes[c - 1].value.c_str() + 1, 0, 2 );
+                unsigned long long curr =
+                    std::strtoull( changes[c].value.c_str() + 1, 0, 2 );
+                if( curr != prev + 1
+                    || changes[c].time != changes[c - 1].time + 1000 ) {
+                    cout << "  unexpected change " << c << ": "
+                         << changes[c].value << "@" << changes[c].time << endl;
+                    break;
+                }
+            }
+        }
+    }
+
+    // random access: a single trace at a given time
+    const sc_dt::uint64 t = 45678000; // 45678 ns, in ps
+    std::size_t b = r.find_block( t );
+    std::vector<vcb_reader::change> changes;
+    r.read_changes( b, 1, changes );
+    std::string value;
+    for( std::size_t c = 0; c < changes.size() && changes[c].time <= t; ++c )
+        value = changes[c].value;
+    cout << r.names[1] << " at " << t << " (block " << b << "): "
+         << value << endl;
+}
+
+int
+sc_main( int, char*[] )
+{
+    sc_clock clk;
+
+    sc_signal<sc_uint<32> > count;
+    sc_signal<sc_lv<8> >    bus;
+
+    counter c( "c" );
+    c.clk( clk );
+    c.count( count );
+    c.bus( bus );
+
+    sc_trace_file* tf = sc_create_vcb_trace_file( "test01" );
+
+    sc_trace( tf, clk,     "clk" );
+    sc_trace( tf, count,   "count" );
+    sc_trace( tf, bus,     "bus" );
+    sc_trace( tf, c.level, "c.level" );
+
+    sc_start( 60, SC_US );
+
+    sc_close_vcb_trace_file( tf );
+
+    check_file( "test01.vcb" );
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  test18.cpp -- test of gzip compressed VCD tracing
+
+  The trace file is written as test18.vcd.gz and compared with the
+  golden VCD after decompression.  The test is run a second time with
+  SC_TRACE_ASYNC_WRITE set, to cover the background writer as well.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+SC_MODULE( counter )
+{
+    sc_in_clk clk;
+
+    sc_out<sc_uint<12> > count;
+    sc_out<bool>         wrap;
+    double               ratio;
+
+    void step()
+    {
+        sc_uint<12> next = count.read() + 7;
+        wrap  = ( next < count.read() );
+        count = next;
+        ratio = next.to_double() / 4096;
+    }
+
+    SC_CTOR( counter )
+      : ratio( 0 )
+    {
+        SC_METHOD( step );
+        sensitive << clk.pos();
+        dont_initialize();
+    }
+};
+
+int
+sc_main( int, char*[] )
+{
+    sc_clock clk;
+
+    sc_signal<sc_uint<12> > count;
+    sc_signal<bool>         wrap;
+
+    counter c( "c" );
+    c.clk( clk );
+    c.count( count );
+    c.wrap( wrap );
+
+    sc_trace_file* tf = sc_create_vcd_gz_trace_file( "test18" );
+
+    sc_trace( tf, clk,     "clk" );
+    sc_trace( tf, count,   "count" );
+    sc_trace( tf, wrap,    "wrap" );
+    sc_trace( tf, c.ratio, "c.ratio" );
+
+    sc_start( 1200, SC_NS );
+
+    sc_close_vcd_trace_file( tf );
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  test19.cpp -- test of VCD tracing without closing the trace file
+
+  The trace file is left open when sc_main returns, its buffered output
+  is written at exit, like that of an unflushed stdio stream.  The test
+  is run a second time with SC_TRACE_ASYNC_WRITE set, where the
+  background writer has to be waited for at exit.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+SC_MODULE( counter )
+{
+    sc_in_clk clk;
+
+    sc_out<sc_uint<16> > count;
+    sc_out<bool>         odd;
+
+    void step()
+    {
+        sc_uint<16> next = count.read() + 1;
+        count = next;
+        odd = next[0];
+    }
+
+    SC_CTOR( counter )
+    {
+        SC_METHOD( step );
+        sensitive << clk.pos();
+        dont_initialize();
+    }
+};
+
+int
+sc_main( int, char*[] )
+{
+    sc_clock clk;
+
+    sc_signal<sc_uint<16> > count;
+    sc_signal<bool>         odd;
+
+    counter c( "c" );
+    c.clk( clk );
+    c.count( count );
+    c.odd( odd );
+
+    sc_trace_file* tf = sc_create_vcd_trace_file( "test19" );
+    sc_trace( tf, clk,   "clk" );
+    sc_trace( tf, count, "count" );
+    sc_trace( tf, odd,   "odd" );
+
+    sc_start( 20, SC_NS );
+
+    // no sc_close_vcd_trace_file( tf )
+    return 0;
+}
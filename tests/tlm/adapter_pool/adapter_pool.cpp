@@ -0,0 +1,211 @@
+// Unit test for the b2nb and nb2b adapters of simple_target_socket and
+// simple_target_socket_tagged with many outstanding transactions:
+// pending blocking calls are tracked per transaction, and suspended nb2b
+// threads are reused for later transactions
+
+#include "systemc"
+using namespace sc_core;
+using namespace std;
+
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "tlm_utils/peq_with_cb_and_phase.h"
+
+#include <map>
+
+static const int num_trans = 8;
+
+int count_nb2b_threads(const std::vector<sc_object*>& objects);
+
+
+struct Target: sc_module
+{
+  // only non-blocking transport, blocking calls are converted (b2nb)
+  tlm_utils::simple_target_socket<Target>        nb_socket;
+  tlm_utils::simple_target_socket_tagged<Target> nb_tagged_socket;
+  // only blocking transport, non-blocking calls are converted (nb2b)
+  tlm_utils::simple_target_socket<Target>        b_socket;
+  tlm_utils::simple_target_socket_tagged<Target> b_tagged_socket;
+
+  SC_CTOR(Target)
+  : nb_socket("nb_socket")
+  , nb_tagged_socket("nb_tagged_socket")
+  , b_socket("b_socket")
+  , b_tagged_socket("b_tagged_socket")
+  , m_peq(this, &Target::peq_cb)
+  {
+    nb_socket.register_nb_transport_fw(this, &Target::nb_transport_fw);
+    nb_tagged_socket.register_nb_transport_fw(this, &Target::nb_transport_fw_tagged, 1);
+    b_socket.register_b_transport(this, &Target::b_transport);
+    b_tagged_socket.register_b_transport(this, &Target::b_transport_tagged, 2);
+  }
+
+  tlm::tlm_sync_enum nb_transport_fw(tlm::tlm_generic_payload& trans,
+                                     tlm::tlm_phase& phase, sc_time& delay)
+  {
+    return nb_transport_fw_tagged(0, trans, phase, delay);
+  }
+
+  tlm::tlm_sync_enum nb_transport_fw_tagged(int id, tlm::tlm_generic_payload& trans,
+                                            tlm::tlm_phase& phase, sc_time& delay)
+  {
+    sc_assert(phase == tlm::BEGIN_REQ);
+    // respond later, in reverse order of the addresses
+    sc_time latency((num_trans - trans.get_address() % num_trans) * 10.0, SC_NS);
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+    m_sockets[&trans] = id;
+    m_peq.notify(trans, tlm::BEGIN_RESP, delay + latency);
+    return tlm::TLM_ACCEPTED;
+  }
+
+  void peq_cb(tlm::tlm_generic_payload& trans, const tlm::tlm_phase& phase)
+  {
+    tlm::tlm_phase ph = phase;
+    sc_time delay = SC_ZERO_TIME;
+    int id = m_sockets[&trans];
+    tlm::tlm_sync_enum status = ( id == 0 )
+      ? nb_socket->nb_transport_bw(trans, ph, delay)
+      : nb_tagged_socket->nb_transport_bw(trans, ph, delay);
+    sc_assert(status == tlm::TLM_COMPLETED);
+  }
+
+  void b_transport(tlm::tlm_generic_payload& trans, sc_time& delay)
+  {
+    b_transport_tagged(0, trans, delay);
+  }
+
+  void b_transport_tagged(int id, tlm::tlm_generic_payload& trans, sc_time& delay)
+  {
+    wait((num_trans - trans.get_address() % num_trans) * 10.0, SC_NS);
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+    delay = SC_ZERO_TIME;
+  }
+
+  void start_of_simulation()
+  {
+    cout << "nb2b threads at start: "
+         << count_nb2b_threads(sc_get_top_level_objects()) << endl;
+  }
+
+  std::map<tlm::tlm_generic_payload*, int> m_sockets;
+  tlm_utils::peq_with_cb_and_phase<Target> m_peq;
+};
+
+
+struct Initiator: sc_module
+{
+  tlm_utils::simple_initiator_socket<Initiator> b_socket;
+  tlm_utils::simple_initiator_socket<Initiator> b_tagged_socket;
+  tlm_utils::simple_initiator_socket<Initiator> nb_socket;
+  tlm_utils::simple_initiator_socket<Initiator> nb_tagged_socket;
+
+  SC_CTOR(Initiator)
+  : b_socket("b_socket")
+  , b_tagged_socket("b_tagged_socket")
+  , nb_socket("nb_socket")
+  , nb_tagged_socket("nb_tagged_socket")
+  , completed(0)
+  {
+    nb_socket.register_nb_transport_bw(this, &Initiator::nb_transport_bw);
+    nb_tagged_socket.register_nb_transport_bw(this, &Initiator::nb_transport_bw);
+
+    for (int i = 0; i < num_trans; ++i) {
+      sc_spawn(sc_bind(&Initiator::b_thread, this, i, &b_socket));
+      sc_spawn(sc_bind(&Initiator::b_thread, this, i, &b_tagged_socket));
+    }
+    SC_THREAD(nb_thread);
+  }
+
+  // blocking calls to a non-blocking target
+  void b_thread(int i, tlm_utils::simple_initiator_socket<Initiator>* socket)
+  {
+    tlm::tlm_generic_payload trans;
+    for (int round = 0; round < 2; ++round) {
+      sc_time delay = SC_ZERO_TIME;
+      trans.set_command(tlm::TLM_READ_COMMAND);
+      trans.set_address(i);
+      trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+      (*socket)->b_transport(trans, delay);
+      sc_assert(trans.is_response_ok());
+      completed++;
+    }
+  }
+
+  // non-blocking calls to a blocking target, the second round
+  // reuses the suspended nb2b threads
+  void nb_thread()
+  {
+    tlm::tlm_generic_payload trans[2][num_trans];
+    for (int round = 0; round < 2; ++round) {
+      for (int i = 0; i < num_trans; ++i) {
+        for (int s = 0; s < 2; ++s) {
+          tlm::tlm_generic_payload& t = trans[s][i];
+          tlm::tlm_phase phase = tlm::BEGIN_REQ;
+          sc_time delay = SC_ZERO_TIME;
+          t.set_command(tlm::TLM_WRITE_COMMAND);
+          t.set_address(i);
+          t.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+          tlm::tlm_sync_enum status = ( s == 0 )
+            ? nb_socket->nb_transport_fw(t, phase, delay)
+            : nb_tagged_socket->nb_transport_fw(t, phase, delay);
+          sc_assert(status == tlm::TLM_ACCEPTED);
+        }
+      }
+      wait(responses);
+      wait(SC_ZERO_TIME);
+    }
+  }
+
+  tlm::tlm_sync_enum nb_transport_bw(tlm::tlm_generic_payload& trans,
+                                     tlm::tlm_phase& phase, sc_time& delay)
+  {
+    sc_assert(phase == tlm::BEGIN_RESP);
+    sc_assert(trans.is_response_ok());
+    if (++completed % (2 * num_trans) == 0)
+      responses.notify(SC_ZERO_TIME);
+    phase = tlm::END_RESP;
+    return tlm::TLM_COMPLETED;
+  }
+
+  int      completed;
+  sc_event responses;
+};
+
+
+int count_nb2b_threads(const std::vector<sc_object*>& objects)
+{
+  int count = 0;
+  for (size_t i = 0; i < objects.size(); ++i) {
+    if (std::string(objects[i]->basename()).find("nb2b_thread") == 0)
+      ++count;
+    count += count_nb2b_threads(objects[i]->get_child_objects());
+  }
+  return count;
+}
+
+
+int sc_main(int argc, char* argv[])
+{
+  Initiator initiator("initiator");
+  Target    target("target");
+
+  initiator.b_socket.bind(target.nb_socket);
+  initiator.b_tagged_socket.bind(target.nb_tagged_socket);
+  initiator.nb_socket.bind(target.b_socket);
+  initiator.nb_tagged_socket.bind(target.b_tagged_socket);
+
+  // some of the nb2b threads are spawned in advance, the others on demand
+  target.b_socket.set_nb2b_thread_pool_size(num_trans / 2);
+  target.b_tagged_socket.set_nb2b_thread_pool_size(num_trans);
+
+  sc_start();
+
+  cout << "completed " << initiator.completed << " transactions at "
+       << sc_time_stamp() << endl;
+
+  cout << "nb2b threads: " << count_nb2b_threads(sc_get_top_level_objects())
+       << endl;
+
+  return 0;
+}
@@ -0,0 +1,166 @@
+// Unit test for tlm_utils::tlm_adaptive_quantumkeeper: a temporally
+// decoupled writer updates a mailbox that a reader polls in lock step with
+// SystemC time. Reads that see a write from their future are reported to
+// the keeper of the writer. The adaptive writer shrinks its quantum while
+// such stale accesses are reported and grows it again when the reader
+// stops, the fixed writer keeps the global quantum. Both keepers record
+// their synchronization statistics.
+
+#include "systemc"
+using namespace sc_core;
+using namespace std;
+
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "tlm_utils/tlm_adaptive_quantumkeeper.h"
+
+static const sc_time step(10, SC_NS);
+
+struct Mailbox: sc_module
+{
+  tlm_utils::simple_target_socket<Mailbox> write_socket;
+  tlm_utils::simple_target_socket<Mailbox> read_socket;
+
+  Mailbox(sc_module_name name, tlm_utils::tlm_adaptive_quantumkeeper& writer_qk)
+  : sc_module(name)
+  , write_socket("write_socket")
+  , read_socket("read_socket")
+  , m_writer_qk(writer_qk)
+  , m_value(0)
+  , m_write_time(SC_ZERO_TIME)
+  {
+    write_socket.register_b_transport(this, &Mailbox::write);
+    read_socket.register_b_transport(this, &Mailbox::read);
+  }
+
+  void write(tlm::tlm_generic_payload& trans, sc_time& t)
+  {
+    memcpy(&m_value, trans.get_data_ptr(), sizeof(m_value));
+    m_write_time = sc_time_stamp() + t;
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+  }
+
+  void read(tlm::tlm_generic_payload& trans, sc_time& t)
+  {
+    if (sc_time_stamp() + t < m_write_time)
+      m_writer_qk.report_stale_access();
+    memcpy(trans.get_data_ptr(), &m_value, sizeof(m_value));
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+  }
+
+  tlm_utils::tlm_adaptive_quantumkeeper& m_writer_qk;
+  unsigned int m_value;
+  sc_time m_write_time;
+};
+
+static void transport(tlm::tlm_fw_transport_if<>& fw, tlm::tlm_command cmd,
+                      unsigned int& data, sc_time& t)
+{
+  tlm::tlm_generic_payload trans;
+  trans.set_command(cmd);
+  trans.set_address(0);
+  trans.set_data_ptr(reinterpret_cast<unsigned char*>(&data));
+  trans.set_data_length(sizeof(data));
+  trans.set_streaming_width(sizeof(data));
+  fw.b_transport(trans, t);
+  sc_assert(trans.is_response_ok());
+}
+
+struct Writer: sc_module
+{
+  tlm_utils::simple_initiator_socket<Writer> socket;
+  tlm_utils::tlm_adaptive_quantumkeeper qk;
+
+  SC_CTOR(Writer)
+  : socket("socket")
+  {
+    SC_THREAD(run);
+  }
+
+  void print_statistics(const char* phase)
+  {
+    cout << name() << " " << phase << ": quantum " << qk.get_quantum()
+         << ", " << qk.get_num_syncs() << " syncs, average overshoot "
+         << qk.get_average_overshoot() << ", waited "
+         << qk.get_total_sync_time() << ", "
+         << qk.get_num_stale_accesses() << " stale accesses" << endl;
+    sc_assert(qk.get_host_wait_time() >= 0.0);
+  }
+
+  void run()
+  {
+    qk.reset();
+    for (unsigned int i = 0; i < 2000; ++i) {
+      if (i == 1000) {
+        print_statistics("with reader");
+        qk.reset_statistics();
+      }
+      sc_time t = qk.get_local_time();
+      transport(*socket[0], tlm::TLM_WRITE_COMMAND, i, t);
+      qk.set(t);
+      qk.inc(step);
+      if (qk.need_sync())
+        qk.sync();
+    }
+    qk.sync();
+    print_statistics("without reader");
+  }
+};
+
+struct Reader: sc_module
+{
+  tlm_utils::simple_initiator_socket<Reader> socket;
+
+  SC_CTOR(Reader)
+  : socket("socket")
+  {
+    SC_THREAD(run);
+  }
+
+  // poll the mailbox until the writer has written 1000 values
+  void run()
+  {
+    unsigned int value = 0;
+    while (value < 999) {
+      wait(step);
+      sc_time t = SC_ZERO_TIME;
+      transport(*socket[0], tlm::TLM_READ_COMMAND, value, t);
+    }
+  }
+};
+
+SC_MODULE(Top)
+{
+  Writer adaptive_writer;
+  Writer fixed_writer;
+  Reader reader1;
+  Reader reader2;
+  Mailbox mailbox1;
+  Mailbox mailbox2;
+
+  SC_CTOR(Top)
+  : adaptive_writer("adaptive_writer")
+  , fixed_writer("fixed_writer")
+  , reader1("reader1")
+  , reader2("reader2")
+  , mailbox1("mailbox1", adaptive_writer.qk)
+  , mailbox2("mailbox2", fixed_writer.qk)
+  {
+    adaptive_writer.qk.set_quantum_bounds(sc_time(10, SC_NS), sc_time(2, SC_US));
+    adaptive_writer.socket.bind(mailbox1.write_socket);
+    reader1.socket.bind(mailbox1.read_socket);
+    fixed_writer.socket.bind(mailbox2.write_socket);
+    reader2.socket.bind(mailbox2.read_socket);
+  }
+};
+
+int sc_main(int, char*[])
+{
+  tlm_utils::tlm_quantumkeeper::set_global_quantum(sc_time(1, SC_US));
+
+  Top top("top");
+  sc_start();
+  cout << "done at " << sc_time_stamp() << endl;
+  return 0;
+}
@@ -0,0 +1,291 @@
+// Unit test for tlm::tlm_blocking_transport_batch_if: batches of
+// transactions are passed to targets registering a batch callback in one
+// call and split into b_transport calls for all other targets, including
+// targets only providing nb_transport_fw and plain tlm_fw_transport_if
+// implementations
+
+#include "systemc"
+using namespace sc_core;
+using namespace std;
+
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "tlm_utils/passthrough_target_socket.h"
+#include "tlm_utils/multi_passthrough_initiator_socket.h"
+#include "tlm_utils/multi_passthrough_target_socket.h"
+
+static const int batch_size = 8;
+static const int mem_size = 64;
+
+// memory shared by all targets below
+struct Memory
+{
+  Memory() : batch_calls(0), b_calls(0)
+    { memset(mem, 0, sizeof(mem)); }
+
+  void access(tlm::tlm_generic_payload& trans, sc_time& t)
+  {
+    ++b_calls;
+    sc_dt::uint64 adr = trans.get_address();
+    unsigned int len = trans.get_data_length();
+    if (adr + len > mem_size) {
+      trans.set_response_status(tlm::TLM_ADDRESS_ERROR_RESPONSE);
+      return;
+    }
+    if (trans.is_write())
+      memcpy(&mem[adr], trans.get_data_ptr(), len);
+    else
+      memcpy(trans.get_data_ptr(), &mem[adr], len);
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+    t += sc_time(10, SC_NS);
+  }
+
+  void access_batch(tlm::tlm_generic_payload* const* trans, unsigned int n,
+                    sc_time& t)
+  {
+    ++batch_calls;
+    for (unsigned int i = 0; i < n; ++i) {
+      access(*trans[i], t);
+    }
+  }
+
+  unsigned char mem[mem_size];
+  int batch_calls;
+  int b_calls;
+};
+
+struct SimpleTarget: sc_module, Memory
+{
+  tlm_utils::simple_target_socket<SimpleTarget> socket;
+
+  SimpleTarget(sc_module_name name, bool batch)
+  : sc_module(name)
+  , socket("socket")
+  {
+    socket.register_b_transport(this, &SimpleTarget::b_transport);
+    if (batch)
+      socket.register_b_transport_batch(this, &SimpleTarget::b_transport_batch);
+  }
+
+  void b_transport(tlm::tlm_generic_payload& trans, sc_time& t)
+    { access(trans, t); }
+
+  void b_transport_batch(tlm::tlm_generic_payload* const* trans,
+                         unsigned int n, sc_time& t)
+    { access_batch(trans, n, t); }
+};
+
+// non-blocking only target, batches pass the b->nb conversion
+struct NbTarget: sc_module, Memory
+{
+  tlm_utils::simple_target_socket<NbTarget> socket;
+
+  SC_CTOR(NbTarget)
+  : socket("socket")
+  {
+    socket.register_nb_transport_fw(this, &NbTarget::nb_transport_fw);
+  }
+
+  tlm::tlm_sync_enum nb_transport_fw(tlm::tlm_generic_payload& trans,
+                                     tlm::tlm_phase& phase, sc_time& t)
+  {
+    sc_assert(phase == tlm::BEGIN_REQ);
+    access(trans, t);
+    return tlm::TLM_COMPLETED;
+  }
+};
+
+struct PassthroughTarget: sc_module, Memory
+{
+  tlm_utils::passthrough_target_socket<PassthroughTarget> socket;
+  tlm_utils::passthrough_target_socket_tagged<PassthroughTarget> tagged_socket;
+
+  SC_CTOR(PassthroughTarget)
+  : socket("socket")
+  , tagged_socket("tagged_socket")
+  {
+    socket.register_b_transport(this, &PassthroughTarget::b_transport);
+    socket.register_b_transport_batch(this,
+                                      &PassthroughTarget::b_transport_batch);
+    tagged_socket.register_b_transport(this,
+                                       &PassthroughTarget::b_transport_tagged, 1);
+  }
+
+  void b_transport(tlm::tlm_generic_payload& trans, sc_time& t)
+    { access(trans, t); }
+
+  void b_transport_batch(tlm::tlm_generic_payload* const* trans,
+                         unsigned int n, sc_time& t)
+    { access_batch(trans, n, t); }
+
+  void b_transport_tagged(int id, tlm::tlm_generic_payload& trans, sc_time& t)
+    { sc_assert(id == 1); tagged.access(trans, t); }
+
+  Memory tagged;
+};
+
+struct MultiTarget: sc_module, Memory
+{
+  tlm_utils::multi_passthrough_target_socket<MultiTarget> socket;
+
+  SC_CTOR(MultiTarget)
+  : socket("socket")
+  , ids(0)
+  {
+    socket.register_b_transport(this, &MultiTarget::b_transport);
+    socket.register_b_transport_batch(this, &MultiTarget::b_transport_batch);
+  }
+
+  void b_transport(int, tlm::tlm_generic_payload& trans, sc_time& t)
+    { access(trans, t); }
+
+  void b_transport_batch(int id, tlm::tlm_generic_payload* const* trans,
+                         unsigned int n, sc_time& t)
+    { ids |= 1 << id; access_batch(trans, n, t); }
+
+  int ids;
+};
+
+// plain implementation of the forward interface without batch support
+struct PlainTarget
+  : sc_module, Memory
+  , tlm::tlm_fw_transport_if<>
+{
+  tlm::tlm_target_socket<> socket;
+
+  SC_CTOR(PlainTarget)
+  : socket("socket")
+  {
+    socket.bind(*this);
+  }
+
+  void b_transport(tlm::tlm_generic_payload& trans, sc_time& t)
+    { access(trans, t); }
+  tlm::tlm_sync_enum nb_transport_fw(tlm::tlm_generic_payload&,
+                                     tlm::tlm_phase&, sc_time&)
+    { sc_assert(false); return tlm::TLM_COMPLETED; }
+  bool get_direct_mem_ptr(tlm::tlm_generic_payload&, tlm::tlm_dmi&)
+    { return false; }
+  unsigned int transport_dbg(tlm::tlm_generic_payload&)
+    { return 0; }
+};
+
+struct Initiator: sc_module
+{
+  tlm_utils::simple_initiator_socket<Initiator> socket;
+
+  Initiator(sc_module_name name, Memory* target)
+  : sc_module(name)
+  , socket("socket")
+  , m_target(target)
+  {
+    SC_THREAD(run);
+  }
+
+  void run()
+  {
+    tlm::tlm_generic_payload trans[batch_size];
+    tlm::tlm_generic_payload* batch[batch_size];
+    unsigned char data[batch_size][4];
+    sc_time t = SC_ZERO_TIME;
+
+    for (int pass = 0; pass < 2; ++pass) {
+      for (int i = 0; i < batch_size; ++i) {
+        for (int j = 0; j < 4; ++j)
+          data[i][j] = pass ? 0 : static_cast<unsigned char>(i * 4 + j + 1);
+        trans[i].set_command(pass ? tlm::TLM_READ_COMMAND
+                                  : tlm::TLM_WRITE_COMMAND);
+        trans[i].set_address(i * 4);
+        trans[i].set_data_ptr(data[i]);
+        trans[i].set_data_length(4);
+        trans[i].set_streaming_width(4);
+        trans[i].set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        batch[i] = &trans[i];
+      }
+      socket.b_transport_batch(batch, batch_size, t);
+    }
+    wait(t);
+
+    int errors = 0;
+    for (int i = 0; i < batch_size; ++i) {
+      errors += !trans[i].is_response_ok();
+      for (int j = 0; j < 4; ++j)
+        errors += data[i][j] != i * 4 + j + 1;
+    }
+    cout << name() << ": " << m_target->batch_calls << " batch calls, "
+         << m_target->b_calls << " transactions, " << errors << " errors, "
+         << "done at " << sc_time_stamp() << endl;
+  }
+
+  Memory* m_target;
+};
+
+SC_MODULE(MultiInitiator)
+{
+  tlm_utils::multi_passthrough_initiator_socket<MultiInitiator> socket;
+
+  SC_CTOR(MultiInitiator)
+  : socket("socket")
+  {
+    SC_THREAD(run);
+  }
+
+  void run()
+  {
+    tlm::tlm_generic_payload trans[batch_size];
+    tlm::tlm_generic_payload* batch[batch_size];
+    unsigned int data[batch_size];
+    for (int i = 0; i < batch_size; ++i) {
+      data[i] = i;
+      trans[i].set_command(tlm::TLM_WRITE_COMMAND);
+      trans[i].set_address(i * 4);
+      trans[i].set_data_ptr(reinterpret_cast<unsigned char*>(&data[i]));
+      trans[i].set_data_length(4);
+      trans[i].set_streaming_width(4);
+      batch[i] = &trans[i];
+    }
+
+    sc_time t = SC_ZERO_TIME;
+    for (unsigned int i = 0; i < socket.size(); ++i) {
+      socket.b_transport_batch(batch, batch_size, t, i);
+    }
+    wait(t);
+    cout << name() << ": " << socket.size() << " targets, done at "
+         << sc_time_stamp() << endl;
+  }
+};
+
+int sc_main(int, char*[])
+{
+  SimpleTarget      batch_target("batch_target", true);
+  SimpleTarget      simple_target("simple_target", false);
+  NbTarget          nb_target("nb_target");
+  PassthroughTarget passthrough_target("passthrough_target");
+  MultiTarget       multi_target("multi_target");
+  PlainTarget       plain_target("plain_target");
+
+  Initiator init1("init_batch", &batch_target);
+  Initiator init2("init_simple", &simple_target);
+  Initiator init3("init_nb", &nb_target);
+  Initiator init4("init_passthrough", &passthrough_target);
+  Initiator init5("init_tagged", &passthrough_target.tagged);
+  Initiator init6("init_plain", &plain_target);
+  MultiInitiator multi_init("multi_init");
+
+  init1.socket.bind(batch_target.socket);
+  init2.socket.bind(simple_target.socket);
+  init3.socket.bind(nb_target.socket);
+  init4.socket.bind(passthrough_target.socket);
+  init5.socket.bind(passthrough_target.tagged_socket);
+  init6.socket.bind(plain_target.socket);
+  multi_init.socket.bind(multi_target.socket);
+  multi_init.socket.bind(multi_target.socket);
+
+  sc_start();
+
+  cout << "multi_target: " << multi_target.batch_calls << " batch calls, "
+       << multi_target.b_calls << " transactions from ids "
+       << multi_target.ids << endl;
+  return 0;
+}
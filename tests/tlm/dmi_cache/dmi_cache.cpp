@@ -0,0 +1,252 @@
+// Unit test for tlm_utils::tlm_dmi_cache: lookups honour region bounds and
+// access permissions, inserted regions replace the regions they overlap,
+// and a cache registered with a simple_initiator_socket drops regions on
+// invalidate_direct_mem_ptr before the module callback is called
+
+#include "systemc"
+using namespace sc_core;
+using namespace std;
+
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "tlm_utils/tlm_dmi_cache.h"
+#include "tlm_utils/tlm_router.h"
+
+static const sc_dt::uint64 page_size = 0x100;
+
+static tlm::tlm_dmi make_dmi(sc_dt::uint64 start, sc_dt::uint64 end,
+                             tlm::tlm_dmi::dmi_access_e access)
+{
+  tlm::tlm_dmi dmi;
+  dmi.set_start_address(start);
+  dmi.set_end_address(end);
+  dmi.set_granted_access(access);
+  return dmi;
+}
+
+static void print_lookup(const tlm_utils::tlm_dmi_cache& cache,
+                         sc_dt::uint64 adr, unsigned int len,
+                         tlm::tlm_command cmd)
+{
+  const tlm::tlm_dmi* dmi = cache.lookup(adr, len, cmd);
+  cout << "lookup 0x" << hex << adr << "+" << len
+       << (cmd == tlm::TLM_READ_COMMAND ? " read" :
+           cmd == tlm::TLM_WRITE_COMMAND ? " write" : " any");
+  if (dmi)
+    cout << ": [0x" << dmi->get_start_address() << ", 0x"
+         << dmi->get_end_address() << "]";
+  else
+    cout << ": miss";
+  cout << dec << endl;
+}
+
+static void print_cache(const char* what, const tlm_utils::tlm_dmi_cache& cache)
+{
+  cout << what << ": " << cache.size() << " regions";
+  for (sc_dt::uint64 adr = 0; adr < 0x1000; adr += 0x80) {
+    const tlm::tlm_dmi* dmi = cache.lookup(adr);
+    if (dmi && dmi->get_start_address() >= adr)
+      cout << hex << " [0x" << dmi->get_start_address() << ", 0x"
+           << dmi->get_end_address() << "]" << dec;
+  }
+  cout << endl;
+}
+
+static void test_cache()
+{
+  tlm_utils::tlm_dmi_cache cache;
+  print_lookup(cache, 0, 1, tlm::TLM_IGNORE_COMMAND);
+
+  cache.insert(make_dmi(0x100, 0x1ff, tlm::tlm_dmi::DMI_ACCESS_READ_WRITE));
+  cache.insert(make_dmi(0x400, 0x4ff, tlm::tlm_dmi::DMI_ACCESS_READ));
+  cache.insert(make_dmi(0x200, 0x2ff, tlm::tlm_dmi::DMI_ACCESS_NONE));
+  cache.insert(make_dmi(0x600, 0x7ff, tlm::tlm_dmi::DMI_ACCESS_WRITE));
+  print_cache("inserted", cache);
+
+  print_lookup(cache, 0x0ff, 1, tlm::TLM_IGNORE_COMMAND);
+  print_lookup(cache, 0x100, 1, tlm::TLM_READ_COMMAND);
+  print_lookup(cache, 0x1fc, 4, tlm::TLM_WRITE_COMMAND);
+  print_lookup(cache, 0x1fd, 4, tlm::TLM_WRITE_COMMAND);
+  print_lookup(cache, 0x200, 4, tlm::TLM_READ_COMMAND);
+  print_lookup(cache, 0x200, 4, tlm::TLM_IGNORE_COMMAND);
+  print_lookup(cache, 0x480, 4, tlm::TLM_READ_COMMAND);
+  print_lookup(cache, 0x480, 4, tlm::TLM_WRITE_COMMAND);
+  print_lookup(cache, 0x500, 4, tlm::TLM_IGNORE_COMMAND);
+  print_lookup(cache, 0x7ff, 1, tlm::TLM_WRITE_COMMAND);
+  print_lookup(cache, 0x7ff, 1, tlm::TLM_READ_COMMAND);
+
+  // a larger region replaces the regions it overlaps
+  cache.insert(make_dmi(0x180, 0x47f, tlm::tlm_dmi::DMI_ACCESS_READ_WRITE));
+  print_cache("replaced", cache);
+  print_lookup(cache, 0x200, 4, tlm::TLM_READ_COMMAND);
+
+  cache.invalidate(0x480, 0x600);
+  print_cache("invalidated [0x480, 0x600]", cache);
+  cache.invalidate(0x47f, 0x47f);
+  print_cache("invalidated [0x47f, 0x47f]", cache);
+  cache.invalidate(0, ~sc_dt::uint64(0));
+  print_cache("invalidated all", cache);
+}
+
+struct Memory: sc_module
+{
+  tlm_utils::simple_target_socket<Memory> socket;
+
+  Memory(sc_module_name name)
+  : sc_module(name)
+  , socket("socket")
+  {
+    socket.register_b_transport(this, &Memory::b_transport);
+    socket.register_get_direct_mem_ptr(this, &Memory::get_direct_mem_ptr);
+    for (unsigned int i = 0; i < sizeof(mem); ++i)
+      mem[i] = static_cast<unsigned char>(i * 7);
+  }
+
+  void b_transport(tlm::tlm_generic_payload& trans, sc_time& t)
+  {
+    sc_dt::uint64 adr = trans.get_address();
+    sc_assert(adr + trans.get_data_length() <= sizeof(mem));
+    memcpy(trans.get_data_ptr(), &mem[adr], trans.get_data_length());
+    trans.set_dmi_allowed(true);
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+    t += sc_time(10, SC_NS);
+  }
+
+  // DMI is granted one page at a time
+  bool get_direct_mem_ptr(tlm::tlm_generic_payload& trans, tlm::tlm_dmi& dmi)
+  {
+    sc_dt::uint64 page = trans.get_address() & ~(page_size - 1);
+    dmi.allow_read();
+    dmi.set_dmi_ptr(&mem[page]);
+    dmi.set_start_address(page);
+    dmi.set_end_address(page + page_size - 1);
+    dmi.set_read_latency(sc_time(1, SC_NS));
+    return true;
+  }
+
+  unsigned char mem[0x400];
+};
+
+struct Cpu: sc_module
+{
+  tlm_utils::simple_initiator_socket<Cpu> socket;
+  tlm_utils::tlm_dmi_cache dmi_cache;
+
+  SC_CTOR(Cpu)
+  : socket("socket")
+  , transactions(0)
+  , dmi_requests(0)
+  , dmi_hits(0)
+  , checksum(0)
+  {
+    socket.register_invalidate_direct_mem_ptr(this, &Cpu::invalidate_direct_mem_ptr);
+    socket.register_dmi_cache(dmi_cache);
+  }
+
+  unsigned char fetch(sc_dt::uint64 adr, sc_time& t)
+  {
+    unsigned char data;
+    const tlm::tlm_dmi* dmi = dmi_cache.lookup(adr, 1, tlm::TLM_READ_COMMAND);
+    if (dmi) {
+      ++dmi_hits;
+      t += dmi->get_read_latency();
+      return dmi->get_dmi_ptr()[adr - dmi->get_start_address()];
+    }
+
+    tlm::tlm_generic_payload trans;
+    trans.set_read();
+    trans.set_address(adr);
+    trans.set_data_ptr(&data);
+    trans.set_data_length(1);
+    trans.set_streaming_width(1);
+    socket->b_transport(trans, t);
+    ++transactions;
+    if (trans.is_dmi_allowed()) {
+      tlm::tlm_dmi dmi_data;
+      ++dmi_requests;
+      trans.set_address(adr);   // modified by the router
+      if (socket->get_direct_mem_ptr(trans, dmi_data))
+        dmi_cache.insert(dmi_data);
+    }
+    return data;
+  }
+
+  // walk over the address map a few times
+  void run(int loops)
+  {
+    static const sc_dt::uint64 base[] = { 0x0000, 0x1000, 0x2000 };
+    sc_time t = SC_ZERO_TIME;
+    for (int loop = 0; loop < loops; ++loop) {
+      for (int r = 0; r < 3; ++r) {
+        for (sc_dt::uint64 adr = 0; adr < 0x400; adr += 4) {
+          checksum = checksum * 31 + fetch(base[r] + adr, t);
+        }
+      }
+    }
+    wait(t);
+  }
+
+  void invalidate_direct_mem_ptr(sc_dt::uint64 start, sc_dt::uint64 end)
+  {
+    cout << name() << ": invalidate [0x" << hex << start << ", 0x" << end
+         << "]" << dec << ", " << dmi_cache.size() << " regions left" << endl;
+  }
+
+  int transactions;
+  int dmi_requests;
+  int dmi_hits;
+  unsigned int checksum;
+};
+
+SC_MODULE(Top)
+{
+  Cpu cpu;
+  tlm_utils::tlm_router<> router;
+  Memory mem0;
+  Memory mem1;
+
+  SC_CTOR(Top)
+  : cpu("cpu")
+  , router("router")
+  , mem0("mem0")
+  , mem1("mem1")
+  {
+    cpu.socket.bind(router.target_socket);
+    router.initiator_socket.bind(mem0.socket);
+    router.initiator_socket.bind(mem1.socket);
+    router.add_region(0, 0x0000, 0x03ff);
+    router.add_region(1, 0x1000, 0x13ff);
+    router.add_region(0, 0x2000, 0x23ff);
+
+    SC_THREAD(run);
+  }
+
+  void run()
+  {
+    cpu.run(10);
+    cout << "transactions " << cpu.transactions << ", DMI requests "
+         << cpu.dmi_requests << ", DMI hits " << cpu.dmi_hits
+         << ", regions " << cpu.dmi_cache.size() << ", checksum "
+         << cpu.checksum << " at " << sc_time_stamp() << endl;
+
+    mem1.socket->invalidate_direct_mem_ptr(0x100, 0x1ff);
+    mem0.socket->invalidate_direct_mem_ptr(0x000, 0x0ff);
+    mem0.socket->invalidate_direct_mem_ptr(0, ~sc_dt::uint64(0));
+
+    cpu.run(1);
+    cout << "transactions " << cpu.transactions << ", DMI requests "
+         << cpu.dmi_requests << ", DMI hits " << cpu.dmi_hits
+         << ", regions " << cpu.dmi_cache.size() << ", checksum "
+         << cpu.checksum << " at " << sc_time_stamp() << endl;
+  }
+};
+
+int sc_main(int, char*[])
+{
+  test_cache();
+
+  Top top("top");
+  sc_start();
+  return 0;
+}
@@ -0,0 +1,214 @@
+// Unit test for tlm_utils::tlm_mm_pool: payloads of a pipelined initiator
+// are recycled with their data and byte enable buffers, pooled extensions
+// are reset instead of freed and auto extensions are freed, also when
+// payloads are allocated and freed by several host threads
+
+#include "systemc"
+using namespace sc_core;
+using namespace std;
+
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "tlm_utils/peq_with_cb_and_phase.h"
+#include "tlm_utils/tlm_mm_pool.h"
+
+#include <thread>
+
+static const int num_trans = 64;
+static const int pipeline_depth = 4;
+
+struct tag_extension : tlm::tlm_extension<tag_extension>
+{
+  tag_extension() : tag(-1) {}
+  virtual tlm_extension_base* clone() const
+    { tag_extension* ext = new tag_extension; ext->tag = tag; return ext; }
+  virtual void copy_from(tlm_extension_base const& ext)
+    { tag = static_cast<tag_extension const&>(ext).tag; }
+  int tag;
+};
+
+struct counted_extension : tlm::tlm_extension<counted_extension>
+{
+  counted_extension() { ++live; }
+  ~counted_extension() { --live; }
+  virtual tlm_extension_base* clone() const { return new counted_extension; }
+  virtual void copy_from(tlm_extension_base const&) {}
+  static int live;
+};
+
+int counted_extension::live = 0;
+
+struct Initiator: sc_module
+{
+  tlm_utils::simple_initiator_socket<Initiator> socket;
+
+  SC_CTOR(Initiator)
+  : socket("socket")
+  , completed(0)
+  , errors(0)
+  {
+    socket.register_nb_transport_bw(this, &Initiator::nb_transport_bw);
+    SC_THREAD(run);
+  }
+
+  void run()
+  {
+    for (int i = 0; i < num_trans; ++i) {
+      while (outstanding.size() == pipeline_depth)
+        wait(done);
+
+      unsigned int length = 4 << (i % 3);
+      tlm::tlm_generic_payload* trans =
+        pool.allocate(length, i % 2 ? length : 0);
+      trans->acquire();
+
+      tag_extension* tag = pool.set_pooled_extension<tag_extension>(*trans);
+      if (tag->tag != -1)
+        ++errors; // not reset
+      tag->tag = i;
+      trans->set_auto_extension(new counted_extension);
+
+      trans->set_write();
+      trans->set_address(i * 16);
+      for (unsigned int b = 0; b < length; ++b)
+        trans->get_data_ptr()[b] = static_cast<unsigned char>(i + b);
+      if (trans->get_byte_enable_ptr())
+        for (unsigned int b = 0; b < length; ++b)
+          trans->get_byte_enable_ptr()[b] = TLM_BYTE_ENABLED;
+
+      outstanding.push_back(trans);
+      tlm::tlm_phase phase = tlm::BEGIN_REQ;
+      sc_time delay = SC_ZERO_TIME;
+      tlm::tlm_sync_enum status = socket->nb_transport_fw(*trans, phase, delay);
+      sc_assert(status == tlm::TLM_ACCEPTED);
+      wait(1, SC_NS);
+    }
+    while (!outstanding.empty())
+      wait(done);
+  }
+
+  tlm::tlm_sync_enum nb_transport_bw(tlm::tlm_generic_payload& trans,
+                                     tlm::tlm_phase& phase, sc_time& delay)
+  {
+    sc_assert(phase == tlm::BEGIN_RESP);
+    tag_extension* tag = trans.get_extension<tag_extension>();
+    if (!trans.is_response_ok() || !tag ||
+        trans.get_address() != static_cast<sc_dt::uint64>(tag->tag * 16))
+      ++errors;
+    outstanding.erase(std::find(outstanding.begin(), outstanding.end(), &trans));
+    trans.release();
+    ++completed;
+    done.notify();
+    phase = tlm::END_RESP;
+    return tlm::TLM_COMPLETED;
+  }
+
+  tlm_utils::tlm_mm_pool pool;
+  std::vector<tlm::tlm_generic_payload*> outstanding;
+  sc_event done;
+  int completed;
+  int errors;
+};
+
+struct Target: sc_module
+{
+  tlm_utils::simple_target_socket<Target> socket;
+
+  SC_CTOR(Target)
+  : socket("socket")
+  , m_peq(this, &Target::peq_cb)
+  {
+    socket.register_nb_transport_fw(this, &Target::nb_transport_fw);
+  }
+
+  tlm::tlm_sync_enum nb_transport_fw(tlm::tlm_generic_payload& trans,
+                                     tlm::tlm_phase& phase, sc_time& delay)
+  {
+    sc_assert(phase == tlm::BEGIN_REQ);
+    // a write of length n takes n ns
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+    m_peq.notify(trans, tlm::BEGIN_RESP,
+                 delay + sc_time(trans.get_data_length(), SC_NS));
+    return tlm::TLM_ACCEPTED;
+  }
+
+  void peq_cb(tlm::tlm_generic_payload& trans, const tlm::tlm_phase& phase)
+  {
+    tlm::tlm_phase ph = phase;
+    sc_time delay = SC_ZERO_TIME;
+    socket->nb_transport_bw(trans, ph, delay);
+  }
+
+  tlm_utils::peq_with_cb_and_phase<Target> m_peq;
+};
+
+// allocate and free payloads of one pool from several host threads
+void host_thread(tlm_utils::tlm_mm_pool* pool, int* errors)
+{
+  for (int i = 0; i < 10000; ++i) {
+    tlm::tlm_generic_payload* trans = pool->allocate(8);
+    trans->acquire();
+    tag_extension* tag = pool->set_pooled_extension<tag_extension>(*trans);
+    if (tag->tag != -1 || trans->get_data_length() != 8 ||
+        trans->get_command() != tlm::TLM_IGNORE_COMMAND ||
+        trans->get_gp_option() != tlm::TLM_MIN_PAYLOAD)
+      ++*errors;
+    tag->tag = i;
+    trans->set_read();
+    trans->set_gp_option(tlm::TLM_FULL_PAYLOAD);
+    trans->release();
+  }
+}
+
+int sc_main(int argc, char* argv[])
+{
+  Initiator initiator("initiator");
+  Target    target("target");
+
+  initiator.socket.bind(target.socket);
+
+  sc_start();
+
+  cout << "completed " << initiator.completed << " transactions at "
+       << sc_time_stamp() << " with " << initiator.errors << " errors" << endl;
+  cout << "payloads allocated: " << initiator.pool.get_num_allocated()
+       << ", free: " << initiator.pool.get_num_free() << endl;
+  cout << "auto extensions alive: " << counted_extension::live << endl;
+
+  tlm_utils::tlm_mm_pool pool;
+  int errors[4] = { 0, 0, 0, 0 };
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+    threads.push_back(std::thread(host_thread, &pool, &errors[i]));
+  for (int i = 0; i < 4; ++i)
+    threads[i].join();
+  cout << "host threads: " << errors[0] + errors[1] + errors[2] + errors[3]
+       << " errors, at most " << ( pool.get_num_allocated() <= 4 )
+       << " payload per thread, all free "
+       << ( pool.get_num_free() == pool.get_num_allocated() ) << endl;
+
+  // a payload still in use outlives its pool
+  tlm::tlm_generic_payload* kept;
+  {
+    tlm_utils::tlm_mm_pool local;
+    kept = local.allocate(4);
+    kept->acquire();
+    tag_extension* other = new tag_extension;
+    kept->set_extension(other);
+    try {
+      local.set_pooled_extension<tag_extension>(*kept);
+    } catch (const sc_report& rep) {
+      cout << "set_pooled_extension: " << rep.get_msg_type() << endl;
+    }
+    if (kept->get_extension<tag_extension>() != other)
+      cout << "extension replaced" << endl;
+    kept->clear_extension(other);
+    delete other;
+  }
+  cout << "payload detached from the destroyed pool: "
+       << !kept->has_mm() << endl;
+  delete kept;
+
+  return 0;
+}
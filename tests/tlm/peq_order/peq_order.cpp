@@ -0,0 +1,146 @@
+// Unit test for the ordering of tlm_utils::peq_with_cb_and_phase: timed
+// notifications are delivered in time order and in notification order for
+// equal times, also when callbacks add new notifications
+//
+// Compile with -DBENCHMARK to measure timed notifications for a varying
+// number of pending payloads.
+
+#include "systemc"
+using namespace sc_core;
+using namespace std;
+
+#include "tlm.h"
+#include "tlm_utils/peq_with_cb_and_phase.h"
+
+#ifdef BENCHMARK
+# include <chrono>
+#endif
+
+static const int num_trans = 1000;
+
+SC_MODULE(Test)
+{
+  SC_CTOR(Test)
+  : m_peq("peq", this, &Test::peq_cb)
+  , m_rand(1)
+  , m_seq(0)
+  , m_last_seq(0)
+  , m_received(0)
+  , m_errors(0)
+  , m_checksum(0)
+  , m_limit(0)
+  {
+    SC_THREAD(thread);
+  }
+
+  unsigned int rand_delay(unsigned int range)
+  {
+    m_rand = m_rand * 1103515245 + 12345;
+    return (m_rand >> 16) % range;
+  }
+
+  void notify(tlm::tlm_generic_payload& trans, const tlm::tlm_phase& phase,
+              const sc_time& delay)
+  {
+    m_notified[trans.get_address()] = ++m_seq;
+    m_peq.notify(trans, phase, delay);
+  }
+
+  void thread()
+  {
+    for (int i = 0; i < num_trans; ++i) {
+      m_trans[i].set_address(i);
+      notify(m_trans[i], tlm::BEGIN_REQ, sc_time(rand_delay(50) + 1, SC_NS));
+      if (i % 100 == 99)
+        wait(sc_time(rand_delay(10), SC_NS));
+    }
+    wait(m_done);
+
+    cout << "received " << m_received << " notifications at "
+         << sc_time_stamp() << " with " << m_errors
+         << " errors, checksum " << m_checksum << endl;
+
+#ifdef BENCHMARK
+    benchmark();
+#endif
+  }
+
+  void peq_cb(tlm::tlm_generic_payload& trans, const tlm::tlm_phase& phase)
+  {
+#ifdef BENCHMARK
+    if (m_limit) {
+      if (++m_received < m_limit)
+        m_peq.notify(trans, phase, sc_time(rand_delay(1000) + 1, SC_NS));
+      else if (m_received == m_limit)
+        m_done.notify();
+      return;
+    }
+#endif
+    unsigned int id = static_cast<unsigned int>(trans.get_address());
+    sc_dt::uint64 seq = m_notified[id];
+
+    // time order, notification order for equal times
+    if (sc_time_stamp() == m_last_time && seq < m_last_seq)
+      ++m_errors;
+    if (sc_time_stamp() < m_last_time)
+      ++m_errors;
+    m_last_time = sc_time_stamp();
+    m_last_seq = seq;
+
+    ++m_received;
+    m_checksum = m_checksum * 31 + id;
+
+    // every 3rd request is answered with a response, often at equal times
+    if (phase == tlm::BEGIN_REQ && id % 3 == 0)
+      notify(trans, tlm::BEGIN_RESP, sc_time(rand_delay(4) + 1, SC_NS));
+    else if (m_received == num_trans + (num_trans + 2) / 3)
+      m_done.notify();
+  }
+
+#ifdef BENCHMARK
+  void benchmark()
+  {
+    typedef std::chrono::steady_clock clock;
+    static const unsigned int depths[] = { 10, 100, 1000, 10000, 100000 };
+
+    std::vector<tlm::tlm_generic_payload> trans(100000);
+    for (unsigned int i = 0; i < sizeof(depths) / sizeof(depths[0]); ++i) {
+      m_received = 0;
+      m_limit = 2000000;
+      clock::time_point start = clock::now();
+      for (unsigned int j = 0; j < depths[i]; ++j) {
+        m_peq.notify(trans[j], tlm::BEGIN_REQ,
+                     sc_time(rand_delay(1000) + 1, SC_NS));
+      }
+      wait(m_done);
+      clock::time_point end = clock::now();
+      m_peq.cancel_all();
+
+      cout << "benchmark: " << depths[i] << " pending, "
+           << std::chrono::duration<double, std::nano>( end - start ).count()
+              / m_limit
+           << " ns per notification" << endl;
+    }
+  }
+#endif
+
+  tlm_utils::peq_with_cb_and_phase<Test> m_peq;
+  tlm::tlm_generic_payload m_trans[num_trans];
+  sc_dt::uint64 m_notified[num_trans];
+  unsigned int m_rand;
+  sc_dt::uint64 m_seq;
+  sc_dt::uint64 m_last_seq;
+  sc_time m_last_time;
+  unsigned int m_received;
+  unsigned int m_errors;
+  unsigned int m_checksum;
+  unsigned int m_limit;
+  sc_event m_done;
+};
+
+int sc_main(int, char*[])
+{
+  Test test("test");
+  sc_start();
+  return 0;
+}
@@ -0,0 +1,148 @@
+// Unit test for the ordering of tlm_utils::peq_with_get: timed and
+// immediate notifications are delivered in time order and in notification
+// order for equal times, also when the receiver adds new notifications
+//
+// Compile with -DBENCHMARK to measure timed notifications for a varying
+// number of pending payloads.
+
+#include "systemc"
+using namespace sc_core;
+using namespace std;
+
+#include "tlm.h"
+#include "tlm_utils/peq_with_get.h"
+
+#ifdef BENCHMARK
+# include <chrono>
+#endif
+
+static const int num_trans = 1000;
+
+SC_MODULE(Test)
+{
+  SC_CTOR(Test)
+  : m_peq("peq")
+  , m_rand(1)
+  , m_seq(0)
+  , m_last_seq(0)
+  , m_received(0)
+  , m_errors(0)
+  , m_checksum(0)
+  {
+    SC_THREAD(producer);
+    SC_THREAD(consumer);
+  }
+
+  unsigned int rand_delay(unsigned int range)
+  {
+    m_rand = m_rand * 1103515245 + 12345;
+    return (m_rand >> 16) % range;
+  }
+
+  void notify(tlm::tlm_generic_payload& trans, const sc_time& delay)
+  {
+    m_notified[trans.get_address()] = ++m_seq;
+    m_peq.notify(trans, delay);
+  }
+
+  void producer()
+  {
+    for (int i = 0; i < num_trans; ++i) {
+      m_trans[i].set_address(i);
+      m_trans[i].set_command(tlm::TLM_READ_COMMAND);
+      if (i % 10 == 5) {
+        m_notified[i] = ++m_seq;
+        m_peq.notify(m_trans[i]); // immediate
+      } else {
+        notify(m_trans[i], sc_time(rand_delay(50), SC_NS));
+      }
+      if (i % 100 == 99)
+        wait(sc_time(rand_delay(10), SC_NS));
+    }
+  }
+
+  void consumer()
+  {
+    while (m_received < num_trans + (num_trans + 2) / 3) {
+      wait(m_peq.get_event());
+      tlm::tlm_generic_payload* trans;
+      while ((trans = m_peq.get_next_transaction()) != 0) {
+        unsigned int id = static_cast<unsigned int>(trans->get_address());
+        sc_dt::uint64 seq = m_notified[id];
+
+        // time order, notification order for equal times
+        if (sc_time_stamp() == m_last_time && seq < m_last_seq)
+          ++m_errors;
+        m_last_time = sc_time_stamp();
+        m_last_seq = seq;
+
+        ++m_received;
+        m_checksum = m_checksum * 31 + id;
+
+        // every 3rd read is answered with a write, often at equal times
+        if (trans->is_read() && id % 3 == 0) {
+          trans->set_command(tlm::TLM_WRITE_COMMAND);
+          notify(*trans, sc_time(rand_delay(4), SC_NS));
+        }
+      }
+    }
+
+    cout << "received " << m_received << " notifications at "
+         << sc_time_stamp() << " with " << m_errors
+         << " errors, checksum " << m_checksum << endl;
+
+#ifdef BENCHMARK
+    benchmark();
+#endif
+  }
+
+#ifdef BENCHMARK
+  void benchmark()
+  {
+    typedef std::chrono::steady_clock clock;
+    static const unsigned int depths[] = { 10, 100, 1000, 10000, 100000 };
+    static const unsigned int limit = 2000000;
+
+    std::vector<tlm::tlm_generic_payload> trans(100000);
+    for (unsigned int i = 0; i < sizeof(depths) / sizeof(depths[0]); ++i) {
+      clock::time_point start = clock::now();
+      for (unsigned int j = 0; j < depths[i]; ++j) {
+        m_peq.notify(trans[j], sc_time(rand_delay(1000) + 1, SC_NS));
+      }
+      for (unsigned int received = 0; received < limit; ) {
+        wait(m_peq.get_event());
+        tlm::tlm_generic_payload* t;
+        while ((t = m_peq.get_next_transaction()) != 0) {
+          if (++received < limit)
+            m_peq.notify(*t, sc_time(rand_delay(10) + 1, SC_NS));
+        }
+      }
+      clock::time_point end = clock::now();
+      m_peq.cancel_all();
+
+      cout << "benchmark: " << depths[i] << " pending, "
+           << std::chrono::duration<double, std::nano>( end - start ).count()
+              / limit
+           << " ns per notification" << endl;
+    }
+  }
+#endif
+
+  tlm_utils::peq_with_get<tlm::tlm_generic_payload> m_peq;
+  tlm::tlm_generic_payload m_trans[num_trans];
+  sc_dt::uint64 m_notified[num_trans];
+  unsigned int m_rand;
+  sc_dt::uint64 m_seq;
+  sc_dt::uint64 m_last_seq;
+  sc_time m_last_time;
+  unsigned int m_received;
+  unsigned int m_errors;
+  unsigned int m_checksum;
+};
+
+int sc_main(int, char*[])
+{
+  Test test("test");
+  sc_start();
+  return 0;
+}
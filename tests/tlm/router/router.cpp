@@ -0,0 +1,382 @@
+// Unit test for tlm_utils::tlm_router: two routers in series decode
+// blocking, debug, batch and non-blocking transactions, translate the
+// addresses of DMI regions and DMI invalidations and reject accesses to
+// unmapped and overlapping regions
+//
+// Address map of the initiators:
+//   0x0000 - 0x07ff  mem0 0x000 - 0x7ff    (relative)
+//   0x0800 - 0x0fff  mem0 0x800 - 0xfff    (absolute)
+//   0x1000 - 0x1fff  mem1 0x000 - 0xfff    (router2, relative)
+//   0x2000 - 0x2fff  mem2 0x1000 - 0x1fff  (router2, absolute)
+
+#include "systemc"
+using namespace sc_core;
+using namespace std;
+
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "tlm_utils/peq_with_get.h"
+#include "tlm_utils/tlm_router.h"
+
+#include <iomanip>
+
+static const sc_dt::uint64 mem_size = 0x1000;
+
+struct Memory: sc_module
+{
+  tlm_utils::simple_target_socket<Memory> socket;
+
+  Memory(sc_module_name name, sc_dt::uint64 base)
+  : sc_module(name)
+  , socket("socket")
+  , m_base(base)
+  , m_peq("peq")
+  , batch_calls(0)
+  {
+    socket.register_b_transport(this, &Memory::b_transport);
+    socket.register_b_transport_batch(this, &Memory::b_transport_batch);
+    socket.register_nb_transport_fw(this, &Memory::nb_transport_fw);
+    socket.register_transport_dbg(this, &Memory::transport_dbg);
+    socket.register_get_direct_mem_ptr(this, &Memory::get_direct_mem_ptr);
+    memset(mem, 0, sizeof(mem));
+
+    SC_THREAD(response_thread);
+  }
+
+  bool access(tlm::tlm_generic_payload& trans)
+  {
+    sc_dt::uint64 adr = trans.get_address();
+    unsigned int len = trans.get_data_length();
+    if (adr < m_base || adr + len > m_base + mem_size) {
+      trans.set_response_status(tlm::TLM_ADDRESS_ERROR_RESPONSE);
+      return false;
+    }
+    if (trans.is_write())
+      memcpy(&mem[adr - m_base], trans.get_data_ptr(), len);
+    else
+      memcpy(trans.get_data_ptr(), &mem[adr - m_base], len);
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+    trans.set_dmi_allowed(true);
+    return true;
+  }
+
+  void b_transport(tlm::tlm_generic_payload& trans, sc_time& t)
+  {
+    access(trans);
+    t += sc_time(10, SC_NS);
+  }
+
+  void b_transport_batch(tlm::tlm_generic_payload* const* trans,
+                         unsigned int n, sc_time& t)
+  {
+    ++batch_calls;
+    for (unsigned int i = 0; i < n; ++i) {
+      b_transport(*trans[i], t);
+    }
+  }
+
+  tlm::tlm_sync_enum nb_transport_fw(tlm::tlm_generic_payload& trans,
+                                     tlm::tlm_phase& phase, sc_time& t)
+  {
+    if (phase == tlm::BEGIN_REQ) {
+      m_peq.notify(trans, t + sc_time(10, SC_NS));
+      phase = tlm::END_REQ;
+      return tlm::TLM_UPDATED;
+    }
+    sc_assert(phase == tlm::END_RESP);
+    cout << name() << ": END_RESP at " << sc_time_stamp() << endl;
+    return tlm::TLM_COMPLETED;
+  }
+
+  void response_thread()
+  {
+    while (true) {
+      wait(m_peq.get_event());
+      tlm::tlm_generic_payload* trans;
+      while ((trans = m_peq.get_next_transaction()) != 0) {
+        access(*trans);
+        tlm::tlm_phase phase = tlm::BEGIN_RESP;
+        sc_time t = SC_ZERO_TIME;
+        socket->nb_transport_bw(*trans, phase, t);
+      }
+    }
+  }
+
+  unsigned int transport_dbg(tlm::tlm_generic_payload& trans)
+  {
+    return access(trans) ? trans.get_data_length() : 0;
+  }
+
+  bool get_direct_mem_ptr(tlm::tlm_generic_payload&, tlm::tlm_dmi& dmi)
+  {
+    dmi.allow_read_write();
+    dmi.set_dmi_ptr(mem);
+    dmi.set_start_address(m_base);
+    dmi.set_end_address(m_base + mem_size - 1);
+    return true;
+  }
+
+  void invalidate()
+  {
+    socket->invalidate_direct_mem_ptr(m_base, m_base + mem_size - 1);
+  }
+
+  sc_dt::uint64 m_base;
+  tlm_utils::peq_with_get<tlm::tlm_generic_payload> m_peq;
+  unsigned char mem[mem_size];
+  int batch_calls;
+};
+
+struct Initiator: sc_module
+{
+  tlm_utils::simple_initiator_socket<Initiator> socket;
+
+  Initiator(sc_module_name name)
+  : sc_module(name)
+  , socket("socket")
+  {
+    socket.register_nb_transport_bw(this, &Initiator::nb_transport_bw);
+    socket.register_invalidate_direct_mem_ptr(this,
+      &Initiator::invalidate_direct_mem_ptr);
+  }
+
+  // the routers are destroyed first, a transaction left pending keeps no
+  // extension of theirs
+  ~Initiator()
+  {
+    for (int i = 0; i < num_nb_trans; ++i) {
+      for (unsigned int j = 0; j < tlm::max_num_extensions(); ++j) {
+        if (m_nb_trans[i].get_extension(j))
+          cout << name() << ": extension left on transaction " << i << endl;
+      }
+    }
+  }
+
+  void setup(tlm::tlm_generic_payload& trans, tlm::tlm_command cmd,
+             sc_dt::uint64 adr, unsigned int* data)
+  {
+    trans.set_command(cmd);
+    trans.set_address(adr);
+    trans.set_data_ptr(reinterpret_cast<unsigned char*>(data));
+    trans.set_data_length(4);
+    trans.set_streaming_width(4);
+    trans.set_byte_enable_ptr(0);
+    trans.set_dmi_allowed(false);
+    trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+  }
+
+  // blocking access, returns the address seen by the target
+  sc_dt::uint64 access(tlm::tlm_command cmd, sc_dt::uint64 adr,
+                       unsigned int& data)
+  {
+    tlm::tlm_generic_payload trans;
+    sc_time t = SC_ZERO_TIME;
+    setup(trans, cmd, adr, &data);
+    socket->b_transport(trans, t);
+    cout << name() << ": " << (cmd == tlm::TLM_WRITE_COMMAND ? "write" : "read")
+         << " 0x" << hex << adr << " -> 0x" << trans.get_address() << dec
+         << " " << trans.get_response_string() << endl;
+    return trans.get_address();
+  }
+
+  void dmi(sc_dt::uint64 adr)
+  {
+    tlm::tlm_generic_payload trans;
+    tlm::tlm_dmi dmi_data;
+    unsigned int data;
+    setup(trans, tlm::TLM_READ_COMMAND, adr, &data);
+    bool ok = socket->get_direct_mem_ptr(trans, dmi_data);
+    cout << name() << ": DMI 0x" << hex << adr << " " << (ok ? "granted" : "denied")
+         << " [0x" << dmi_data.get_start_address()
+         << ", 0x" << dmi_data.get_end_address() << "]" << dec;
+    if (ok) {
+      unsigned int value;
+      memcpy(&value, dmi_data.get_dmi_ptr() + (adr - dmi_data.get_start_address()), 4);
+      cout << " value 0x" << hex << value << dec;
+    }
+    cout << endl;
+  }
+
+  tlm::tlm_sync_enum nb_transport_bw(tlm::tlm_generic_payload& trans,
+                                     tlm::tlm_phase& phase, sc_time&)
+  {
+    sc_assert(phase == tlm::BEGIN_RESP);
+    int mode = static_cast<int>(&trans - m_nb_trans);
+    cout << name() << ": BEGIN_RESP 0x" << hex << trans.get_address() << dec
+         << " " << trans.get_response_string() << " at " << sc_time_stamp() << endl;
+    switch (mode) {
+    case 0:
+      m_end_resp_event.notify(5, SC_NS);
+      return tlm::TLM_ACCEPTED;
+    case 1:
+      phase = tlm::END_RESP;
+      return tlm::TLM_UPDATED;
+    case 4: // left pending until the end of the simulation
+      return tlm::TLM_ACCEPTED;
+    default:
+      return tlm::TLM_COMPLETED;
+    }
+  }
+
+  void invalidate_direct_mem_ptr(sc_dt::uint64 start, sc_dt::uint64 end)
+  {
+    cout << name() << ": invalidate [0x" << hex << start
+         << ", 0x" << end << "]" << dec << endl;
+  }
+
+  // non-blocking requests through both routers, each completed in a
+  // different way
+  void nb_requests()
+  {
+    static const sc_dt::uint64 adr[] =
+      { 0x0020, 0x1020, 0x2020, 0x3020, 0x1030 };
+    for (int i = 0; i < num_nb_trans; ++i) {
+      m_nb_data[i] = 0xbeef0000 + i;
+      setup(m_nb_trans[i], tlm::TLM_WRITE_COMMAND, adr[i], &m_nb_data[i]);
+      tlm::tlm_phase phase = tlm::BEGIN_REQ;
+      sc_time t = SC_ZERO_TIME;
+      tlm::tlm_sync_enum status = socket->nb_transport_fw(m_nb_trans[i], phase, t);
+      cout << name() << ": BEGIN_REQ 0x" << hex << adr[i] << dec << " returned "
+           << (status == tlm::TLM_COMPLETED ? "completed" :
+               status == tlm::TLM_UPDATED ? "updated" : "accepted")
+           << " " << m_nb_trans[i].get_response_string() << endl;
+    }
+
+    wait(m_end_resp_event);
+    tlm::tlm_phase phase = tlm::END_RESP;
+    sc_time t = SC_ZERO_TIME;
+    socket->nb_transport_fw(m_nb_trans[0], phase, t);
+  }
+
+  static const int num_nb_trans = 5;
+  tlm::tlm_generic_payload m_nb_trans[num_nb_trans];
+  unsigned int m_nb_data[num_nb_trans];
+  sc_event m_end_resp_event;
+};
+
+SC_MODULE(Top)
+{
+  Initiator init0;
+  Initiator init1;
+  tlm_utils::tlm_router<> router1;
+  tlm_utils::tlm_router<> router2;
+  Memory mem0;
+  Memory mem1;
+  Memory mem2;
+
+  SC_CTOR(Top)
+  : init0("init0")
+  , init1("init1")
+  , router1("router1")
+  , router2("router2")
+  , mem0("mem0", 0)
+  , mem1("mem1", 0)
+  , mem2("mem2", 0x1000)
+  {
+    init0.socket.bind(router1.target_socket);
+    init1.socket.bind(router1.target_socket);
+    router1.initiator_socket.bind(mem0.socket);
+    router1.initiator_socket.bind(router2.target_socket);
+    router2.initiator_socket.bind(mem1.socket);
+    router2.initiator_socket.bind(mem2.socket);
+
+    router1.add_region(1, 0x1000, 0x2fff);
+    router1.add_region(0, 0x0800, 0x0fff, false);
+    router1.add_region(0, 0x0000, 0x07ff);
+    router2.add_region(1, 0x1000, 0x1fff, false);
+    router2.add_region(0, 0x0000, 0x0fff);
+
+    add_overlapping_region(0x2f00, 0x3000);
+    add_overlapping_region(0x0000, 0x0000);
+    add_overlapping_region(0x3000, 0x2fff);
+
+    SC_THREAD(run);
+  }
+
+  void add_overlapping_region(sc_dt::uint64 start, sc_dt::uint64 end)
+  {
+    try {
+      router1.add_region(0, start, end);
+    } catch (const sc_report& e) {
+      cout << e.get_msg_type() << ": " << e.get_msg() << endl;
+    }
+  }
+
+  void run()
+  {
+    cout << "regions: " << router1.get_num_regions() << " + "
+         << router2.get_num_regions() << endl;
+
+    // blocking transport, alternating between the initiators
+    static const sc_dt::uint64 adr[] = { 0x0010, 0x0810, 0x1010, 0x2010, 0x3010 };
+    for (int i = 0; i < 5; ++i) {
+      unsigned int data = 0xcafe0000 + i;
+      (i % 2 ? init1 : init0).access(tlm::TLM_WRITE_COMMAND, adr[i], data);
+    }
+    for (int i = 0; i < 5; ++i) {
+      unsigned int data = 0;
+      (i % 2 ? init0 : init1).access(tlm::TLM_READ_COMMAND, adr[i], data);
+      cout << "  data 0x" << hex << data << dec << endl;
+    }
+
+    // debug transport
+    for (int i = 3; i < 5; ++i) {
+      tlm::tlm_generic_payload trans;
+      unsigned int data = 0;
+      init0.setup(trans, tlm::TLM_READ_COMMAND, adr[i], &data);
+      unsigned int n = init0.socket->transport_dbg(trans);
+      cout << "debug 0x" << hex << adr[i] << ": " << dec << n
+           << " bytes, data 0x" << hex << data << dec << endl;
+    }
+
+    // DMI, address ranges are translated and clipped to the regions
+    for (int i = 0; i < 5; ++i) {
+      init1.dmi(adr[i]);
+    }
+
+    // DMI invalidation, translated to the address map of the initiators
+    mem0.invalidate();
+    mem2.invalidate();
+
+    // batch transport, split at target changes and unmapped addresses
+    static const sc_dt::uint64 batch_adr[] =
+      { 0x0000, 0x0804, 0x1000, 0x1004, 0x3000, 0x2000, 0x2004, 0x0008 };
+    const int batch_size = sizeof(batch_adr) / sizeof(batch_adr[0]);
+    tlm::tlm_generic_payload trans[batch_size];
+    tlm::tlm_generic_payload* batch[batch_size];
+    unsigned int data[batch_size];
+    for (int i = 0; i < batch_size; ++i) {
+      data[i] = 0x5a5a0000 + i;
+      init0.setup(trans[i], tlm::TLM_WRITE_COMMAND, batch_adr[i], &data[i]);
+      batch[i] = &trans[i];
+    }
+    sc_time t = SC_ZERO_TIME;
+    init0.socket.b_transport_batch(batch, batch_size, t);
+    for (int i = 0; i < batch_size; ++i) {
+      cout << "batch 0x" << hex << batch_adr[i] << " -> 0x"
+           << trans[i].get_address() << dec << " "
+           << trans[i].get_response_string() << endl;
+    }
+    cout << "batch calls: " << mem0.batch_calls << " " << mem1.batch_calls
+         << " " << mem2.batch_calls << ", delay " << t << endl;
+
+    // non-blocking transport
+    init1.nb_requests();
+    wait(20, SC_NS);
+
+    for (int i = 0; i < 3; ++i) {
+      unsigned int value = 0;
+      init0.access(tlm::TLM_READ_COMMAND, 0x1000 * i + 0x20, value);
+      cout << "  data 0x" << hex << value << dec << endl;
+    }
+  }
+};
+
+int sc_main(int, char*[])
+{
+  Top top("top");
+  sc_start();
+  cout << "done at " << sc_time_stamp() << endl;
+  return 0;
+}